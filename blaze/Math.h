@@ -43,8 +43,10 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/AssemblyMatrix.h>
 #include <blaze/math/Band.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
@@ -65,17 +67,21 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Ordering.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
+#include <blaze/math/SymmetricCompressedMatrix.h>
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
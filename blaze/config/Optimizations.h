@@ -120,3 +120,37 @@
 #define BLAZE_USE_OPTIMIZED_KERNELS 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the Strassen-Winograd matrix multiplication.
+// \ingroup config
+//
+// This configuration switch enables/disables the recursive Strassen-Winograd algorithm for
+// large dense matrix/dense matrix multiplications. In case the switch is set to \a true, the
+// multiplication of two row-major or two column-major dense matrices, whose dimensions are
+// all equal or larger than the Strassen threshold (see the BLAZE_STRASSEN_THRESHOLD setting),
+// is recursively split into seven instead of eight half-sized products. The recursion stops
+// at the threshold, where the default kernels (or the BLAS kernels, if enabled) are used. In
+// case the switch is set to \a false, the Strassen-Winograd algorithm is never used.
+//
+// Possible settings for the Strassen-Winograd algorithm:
+//  - Disabled: \b 0 (default)
+//  - Enabled : \b 1
+//
+// \warning Note that the Strassen-Winograd algorithm is numerically less stable than the
+// conventional matrix multiplication. The rounding errors grow with every level of recursion
+// and are typically one or two orders of magnitude larger than for the conventional kernels.
+//
+// \note It is possible to (de-)activate the Strassen-Winograd algorithm via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_STRASSEN 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_STRASSEN
+#define BLAZE_USE_STRASSEN 0
+#endif
+//*************************************************************************************************
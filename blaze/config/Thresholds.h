@@ -375,6 +375,63 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Narrow matrix multiplication threshold.
+// \ingroup config
+//
+// This setting specifies the maximum number of columns of a row-major dense matrix, which is
+// multiplied with a row-major dense or sparse matrix, for which the specialized narrow matrix
+// multiplication kernels are used (as for instance for the block of vectors of a block Krylov
+// method). In case the number of columns of the right-hand side dense matrix is equal or lower
+// than this value, the kernel for narrow matrices is preferred. Otherwise the general kernels
+// for small or large matrices are used.
+//
+// The default setting for this threshold is 32. Note that in case the Blaze debug mode is
+// active, this threshold will be replaced by the blaze::NARROW_MMM_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_NARROW_MMM_THRESHOLD 32UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_NARROW_MMM_THRESHOLD
+#define BLAZE_NARROW_MMM_THRESHOLD 32UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Strassen-Winograd matrix multiplication threshold.
+// \ingroup config
+//
+// This setting specifies the threshold for the recursion of the Strassen-Winograd algorithm
+// for dense matrix/dense matrix multiplications (see the BLAZE_USE_STRASSEN switch). In case
+// the number of rows and columns of the target matrix and the number of columns of the left-
+// hand side operand are all equal or higher than this value, the multiplication is split into
+// seven half-sized products. Otherwise the default kernels or the BLAS kernels are used.
+//
+// The default setting for this threshold is 1024, i.e. the multiplication of two
+// \f$ 4000 \times 4000 \f$ matrices performs two levels of recursion. Note that in case the
+// Blaze debug mode is active, this threshold will be replaced by the
+// blaze::STRASSEN_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_STRASSEN_THRESHOLD 1024UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_STRASSEN_THRESHOLD
+#define BLAZE_STRASSEN_THRESHOLD 1024UL
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2032,3 +2089,225 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix triplet construction threshold.
+// \ingroup config
+//
+// This threshold specifies when the construction of a sparse matrix from a set of (row, column,
+// value) triplets can be executed in parallel. In case the number of triplets is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of triplets is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRIPLETS_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRIPLETS_THRESHOLD
+#define BLAZE_SMP_SMATTRIPLETS_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the assignment of a sparse matrix to a compressed matrix with
+// opposite storage order (as for instance the conversion between row-major and column-major
+// compressed matrices, the assignment of a transposed sparse matrix, or the in-place transpose
+// of a compressed matrix) can be executed in parallel. In case the number of non-zero elements
+// of the sparse matrix is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of non-zero elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SMATTRANSPOSE_THRESHOLD=65536UL ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRANSPOSE_THRESHOLD
+#define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse pattern operation threshold.
+// \ingroup config
+//
+// This threshold specifies when the symbolic and numeric phases of a sparse matrix operation
+// with precomputed sparsity pattern (see the SMatSMatAddPattern and SMatSMatMultPattern class
+// templates) can be executed in parallel. In case the number of scalar operations is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of operations
+// is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SPARSEPATTERN_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SPARSEPATTERN_THRESHOLD
+#define BLAZE_SMP_SPARSEPATTERN_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP SELL matrix/dense vector multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a SELL matrix/dense vector multiplication or a dense vector/SELL
+// matrix multiplication (see the SellMatrix class template) can be executed in parallel. In case
+// the number of stored elements of the SELL matrix (including the padding elements) is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of stored
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SELLDVECMULT_THRESHOLD=32768UL ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SELLDVECMULT_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SELLDVECMULT_THRESHOLD
+#define BLAZE_SMP_SELLDVECMULT_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP block-sparse matrix multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a multiplication between a block-sparse matrix (see the
+// BlockCompressedMatrix class template) and a dense vector or a dense matrix can be executed in
+// parallel. In case the number of scalar multiplications (i.e. the number of stored elements of
+// the block-sparse matrix times the number of columns of the right-hand side operand) is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of scalar
+// multiplications is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_BLOCKMATMULT_THRESHOLD=32768UL ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_BLOCKMATMULT_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BLOCKMATMULT_THRESHOLD
+#define BLAZE_SMP_BLOCKMATMULT_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP half-storage symmetric sparse matrix/dense vector multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a multiplication between a half-storage symmetric sparse matrix
+// (see the SymmetricCompressedMatrix class template) and a dense vector can be executed in
+// parallel. In case the number of stored elements of the upper triangle of the matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of stored
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SYMDVECMULT_THRESHOLD=32768UL ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SYMDVECMULT_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SYMDVECMULT_THRESHOLD
+#define BLAZE_SMP_SYMDVECMULT_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/Fusion.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/DVecDVecAddExpr.h>
 #include <blaze/math/expressions/DVecDVecCrossExpr.h>
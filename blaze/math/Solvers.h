@@ -0,0 +1,61 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Solvers.h
+//  \brief Header file for the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_H_
+#define _BLAZE_MATH_SOLVERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/solvers/Arnoldi.h>
+#include <blaze/math/solvers/BiCGSTAB.h>
+#include <blaze/math/solvers/BlockJacobiPreconditioner.h>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/GMRES.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/ILUPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+#include <blaze/math/solvers/Lanczos.h>
+#include <blaze/math/solvers/MINRES.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/solvers/Solvers.h>
+#include <blaze/math/solvers/SparseCholesky.h>
+#include <blaze/math/solvers/SparseTriangularSolver.h>
+#include <blaze/math/solvers/SpectrumFlag.h>
+#include <blaze/math/solvers/SSORPreconditioner.h>
+
+#endif
@@ -75,6 +75,7 @@
 #include <blaze/math/typetraits/HasMult.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasPow.h>
+#include <blaze/math/typetraits/HasRowOffsets.h>
 #include <blaze/math/typetraits/HasReal.h>
 #include <blaze/math/typetraits/HasRound.h>
 #include <blaze/math/typetraits/HasSign.h>
@@ -155,6 +156,7 @@
 #include <blaze/math/typetraits/IsDivExpr.h>
 #include <blaze/math/typetraits/IsElements.h>
 #include <blaze/math/typetraits/IsEvalExpr.h>
+#include <blaze/math/typetraits/IsEpilogueFusable.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsGeneral.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -383,6 +384,17 @@ class DynamicMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasConstDataAccess_v<MT> &&
+        IsSame_v< Type, ElementType_t<MT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -458,7 +470,12 @@ class DynamicMatrix
    template< typename MT >
    inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,!SO>& rhs ) -> DisableIf_t< TransposeAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,!SO>& rhs ) -> EnableIf_t< TransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -1867,23 +1884,9 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
-   using std::swap;
-
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-      }
+      dmattrans( v_, nn_, n_ );
    }
    else
    {
@@ -2444,7 +2447,8 @@ inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2468,6 +2472,33 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Transpose kernel based implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( v_, nn_, (~rhs).data(), (~rhs).spacing(), n_, m_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3341,6 +3372,15 @@ class DynamicMatrix<Type,true>
         IsSIMDCombinable_v< Type, ElementType_t<MT> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasConstDataAccess_v<MT> &&
+        IsSame_v< Type, ElementType_t<MT> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT >
@@ -3410,7 +3450,12 @@ class DynamicMatrix<Type,true>
    template< typename MT >
    inline auto assign( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,false>& rhs ) -> DisableIf_t< TransposeAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,false>& rhs ) -> EnableIf_t< TransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -4829,23 +4874,9 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
-   using std::swap;
-
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-      }
+      dmattrans( v_, mm_, m_ );
    }
    else
    {
@@ -5416,7 +5447,8 @@ inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5441,6 +5473,34 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose kernel based implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( v_, mm_, (~rhs).data(), (~rhs).spacing(), m_, n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -0,0 +1,742 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Fusion.h
+//  \brief Header file for the fused evaluation of several dense vector assignments
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FUSION_H_
+#define _BLAZE_MATH_DENSE_FUSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecNormExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/expressions/VecScalarDivExpr.h>
+#include <blaze/math/expressions/VecScalarMultExpr.h>
+#include <blaze/math/expressions/VecVecAddExpr.h>
+#include <blaze/math/expressions/VecVecMultExpr.h>
+#include <blaze/math/expressions/VecVecSubExpr.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Cbrt.h>
+#include <blaze/math/functors/L1Norm.h>
+#include <blaze/math/functors/L2Norm.h>
+#include <blaze/math/functors/L3Norm.h>
+#include <blaze/math/functors/L4Norm.h>
+#include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/Pow2.h>
+#include <blaze/math/functors/Pow3.h>
+#include <blaze/math/functors/Pow4.h>
+#include <blaze/math/functors/Qdrt.h>
+#include <blaze/math/functors/Sqrt.h>
+#include <blaze/math/functors/SqrNorm.h>
+#include <blaze/math/shims/Evaluate.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsVector.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the blockwise reduction of a fused dense vector assignment.
+// \ingroup dense_vector
+//
+// The primary template handles all binary reduction operations (as for instance blaze::Add,
+// blaze::Mult, blaze::Max, and blaze::Min). Each block is reduced via the reduce() function
+// and the partial results are combined by means of the same reduction operation.
+*/
+template< typename OP >  // Type of the reduction operation
+struct FusionReduction
+{
+   //**********************************************************************************************
+   template< typename VT, bool TF >
+   static inline auto reduce( const DenseVector<VT,TF>& dv, OP op ) {
+      return blaze::reduce( ~dv, op );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static inline T combine( const T& a, const T& b, OP op ) {
+      return op( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static inline auto finalize( const T& a, OP /*op*/ ) {
+      return a;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the blockwise norm computation of a fused dense vector
+//        assignment.
+// \ingroup dense_vector
+//
+// The partial norms of all blocks are accumulated without the final root operation, which is
+// applied once after all blocks have been processed.
+*/
+template< typename Abs      // Type of the abs operation
+        , typename Power    // Type of the power operation
+        , typename Root >   // Type of the root operation
+struct FusionNormReduction
+{
+   //**********************************************************************************************
+   template< typename VT, bool TF, typename OP >
+   static inline auto reduce( const DenseVector<VT,TF>& dv, OP /*op*/ ) {
+      return norm_backend( ~dv, Abs(), Power(), Noop() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T, typename OP >
+   static inline T combine( const T& a, const T& b, OP /*op*/ ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T, typename OP >
+   static inline auto finalize( const T& a, OP /*op*/ ) {
+      return evaluate( Root()( a ) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template<> struct FusionReduction<SqrNorm> : public FusionNormReduction<Noop,Pow2,Noop> {};
+template<> struct FusionReduction<L1Norm>  : public FusionNormReduction<Abs,Noop,Noop> {};
+template<> struct FusionReduction<L2Norm>  : public FusionNormReduction<Noop,Pow2,Sqrt> {};
+template<> struct FusionReduction<L3Norm>  : public FusionNormReduction<Abs,Pow3,Cbrt> {};
+template<> struct FusionReduction<L4Norm>  : public FusionNormReduction<Noop,Pow4,Qdrt> {};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element during the evaluation of a vector.
+// \ingroup dense_vector
+//
+// \param vec The given vector.
+// \return The estimated number of bytes per element.
+//
+// This function returns the number of bytes that have to be loaded in order to compute a single
+// element of the given vector. A return value of 0 indicates that the vector cannot be evaluated
+// blockwise without excessive overhead.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline size_t fusionBytes( const Vector<VT,TF>& vec )
+{
+   UNUSED_PARAMETER( vec );
+
+   return sizeof( ElementType_t<VT> );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element during the evaluation of a
+//        matrix/vector multiplication.
+// \ingroup dense_vector
+//
+// \param vec The given matrix/vector multiplication.
+// \return The estimated number of bytes per element (i.e. per row of the matrix operand).
+//
+// For dense matrices all elements of a row have to be loaded, for row-major sparse matrices
+// the average number of non-zero elements per row. Column-major sparse matrices cannot be
+// split into row blocks efficiently and are therefore excluded from blocking.
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const MatVecMultExpr<VT>& vec )
+{
+   BLAZE_DECLTYPE_AUTO( A, (~vec).leftOperand() );
+
+   using MT = RemoveCV_t< RemoveReference_t< decltype( A ) > >;
+   using ET = ElementType_t<MT>;
+
+   if( IsDenseMatrix_v<MT> ) {
+      return A.columns() * sizeof( ET );
+   }
+   else if( IsRowMajorMatrix_v<MT> && A.rows() != 0UL ) {
+      return ( A.nonZeros() / A.rows() + 1UL ) * ( sizeof( ET ) + sizeof( size_t ) );
+   }
+   else return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a binary vector expression.
+// \ingroup dense_vector
+//
+// \param lhs The estimate for the left-hand side operand.
+// \param rhs The estimate for the right-hand side operand.
+// \return The combined estimate (0 in case one of the operands cannot be evaluated blockwise).
+*/
+inline size_t fusionBytes( size_t lhs, size_t rhs )
+{
+   return ( lhs != 0UL && rhs != 0UL )?( lhs + rhs ):( 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a vector addition.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const VecVecAddExpr<VT>& vec )
+{
+   return fusionBytes( fusionBytes( (~vec).leftOperand() ), fusionBytes( (~vec).rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a vector subtraction.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const VecVecSubExpr<VT>& vec )
+{
+   return fusionBytes( fusionBytes( (~vec).leftOperand() ), fusionBytes( (~vec).rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a componentwise vector multiplication.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const VecVecMultExpr<VT>& vec )
+{
+   return fusionBytes( fusionBytes( (~vec).leftOperand() ), fusionBytes( (~vec).rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a vector/scalar multiplication.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const VecScalarMultExpr<VT>& vec )
+{
+   return fusionBytes( (~vec).leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the number of bytes read per element of a vector/scalar division.
+// \ingroup dense_vector
+*/
+template< typename VT >  // Vector base type of the expression
+inline size_t fusionBytes( const VecScalarDivExpr<VT>& vec )
+{
+   return fusionBytes( (~vec).leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminal case for the iteration over the target/expression pairs of a fused assignment.
+// \ingroup dense_vector
+*/
+template< typename F >  // Type of the function to be applied
+inline void fusionForEach( F f )
+{
+   UNUSED_PARAMETER( f );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given function to all target/expression pairs of a fused assignment.
+// \ingroup dense_vector
+//
+// \param f The function to be applied to each pair.
+// \param lhs The target dense vector of the first pair.
+// \param rhs The right-hand side vector of the first pair.
+// \param args The remaining target/expression pairs.
+// \return void
+*/
+template< typename F          // Type of the function to be applied
+        , typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args >  // Types of the remaining pairs
+inline void fusionForEach( F f, DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   f( ~lhs, ~rhs );
+   fusionForEach( f, args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of all fused dense vector assignments.
+// \ingroup dense_vector
+//
+// \param resizable \a true in case the targets are resized to the size of the expressions.
+// \param op The (compound) assignment operation.
+// \param args The target/expression pairs.
+// \return The common size of all targets and the block size for the evaluation.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates all given target/expression pairs in a single, blockwise sweep. All
+// targets are split into blocks of equal size, which are chosen such that the data of all
+// operands required by a single block fits into the cache. For every block all assignments are
+// performed before proceeding to the next block, which implies that operands shared by several
+// expressions (as for instance the matrix in \f$ y_1 = A x_1; y_2 = A x_2 \f$) are loaded from
+// main memory only once. The given \a reduce function is called for every evaluated block.
+// In case any of the expressions is aliased with any of the targets or in case any of the
+// expressions cannot be evaluated blockwise, the assignments are performed one after another.
+*/
+template< typename OP         // Type of the assignment operation
+        , typename RF         // Type of the per-block function
+        , typename... Args >  // Types of the target/expression pairs
+void fusedAssign_backend( bool resizable, OP op, RF reduce, Args&&... args )
+{
+   size_t n( 0UL );
+   bool first( true );
+
+   fusionForEach( [&]( const auto& lhs, const auto& rhs )
+   {
+      if( first ) {
+         n = rhs.size();
+         first = false;
+      }
+
+      if( rhs.size() != n || ( !resizable && lhs.size() != n ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+      }
+   }, args... );
+
+   if( resizable ) {
+      fusionForEach( [n]( auto& lhs, const auto& /*rhs*/ ) {
+         resize( lhs, n, false );
+      }, args... );
+   }
+
+   bool aliased  ( false );
+   bool blockable( true  );
+   size_t bytes( 0UL );
+
+   fusionForEach( [&]( const auto& lhs1, const auto& rhs1 )
+   {
+      using ET = ElementType_t< RemoveCV_t< RemoveReference_t< decltype( lhs1 ) > > >;
+
+      const size_t tmp( fusionBytes( rhs1 ) );
+      blockable = blockable && ( tmp != 0UL );
+      bytes += tmp + sizeof( ET );
+
+      fusionForEach( [&]( const auto& /*lhs2*/, const auto& rhs2 ) {
+         aliased = aliased || rhs2.canAlias( &lhs1 );
+      }, args... );
+   }, args... );
+
+   const size_t block( ( blockable )
+                       ?( max( 256UL, ( cacheSize / ( 2UL * bytes ) ) & size_t(-64) ) )
+                       :( n ) );
+
+   if( aliased || block >= n ) {
+      fusionForEach( [op]( auto& lhs, const auto& rhs ) { op( lhs, rhs ); }, args... );
+      reduce( 0UL, n );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; i+=block )
+   {
+      const size_t size( min( block, n - i ) );
+
+      fusionForEach( [op,i,size]( auto& lhs, const auto& rhs ) {
+         auto target( subvector( lhs, i, size, unchecked ) );
+         op( target, subvector( rhs, i, size, unchecked ) );
+      }, args... );
+
+      reduce( i, size );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of all fused dense vector assignments with subsequent reduction.
+// \ingroup dense_vector
+//
+// \param resizable \a true in case the targets are resized to the size of the expressions.
+// \param op The (compound) assignment operation.
+// \param red The reduction operation.
+// \param lhs The target dense vector of the first pair, which is reduced after the assignment.
+// \param rhs The right-hand side vector of the first pair.
+// \param args The remaining target/expression pairs.
+// \return The result of the reduction of the first target.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename OP         // Type of the assignment operation
+        , typename RED        // Type of the reduction operation
+        , typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args >  // Types of the remaining pairs
+decltype(auto) fusedReduce_backend( bool resizable, OP op, RED red,
+                                    DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   using Reduction = FusionReduction<RED>;
+   using RT = RemoveCV_t< RemoveReference_t< decltype( Reduction::reduce( ~lhs, red ) ) > >;
+
+   RT result{};
+   bool first( true );
+
+   fusedAssign_backend( resizable, op, [&]( size_t index, size_t size )
+   {
+      const RT tmp( Reduction::reduce( subvector( ~lhs, index, size, unchecked ), red ) );
+      result = ( first )?( tmp ):( Reduction::combine( result, tmp, red ) );
+      first = false;
+   }, ~lhs, ~rhs, args... );
+
+   return Reduction::finalize( result, red );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Fused assignment of several vector expressions to dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The first target dense vector.
+// \param rhs The vector expression to be assigned to the first target.
+// \param args The remaining target/expression pairs.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector assignments at once. Instead of evaluating the
+// assignments one after another, which requires a full pass through memory for every single
+// assignment, all assignments are evaluated in a single sweep in cache-sized blocks. This
+// drastically reduces the memory traffic in case several expressions share a large operand:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x1, x2, y1, y2;
+   // ... Resizing and initialization
+
+   // Equivalent to 'y1 = A * x1; y2 = A * x2;', but traverses A only once
+   fusedAssign( y1, A * x1, y2, A * x2 );
+   \endcode
+
+// All targets are resized to the (common) size of the expressions, if possible and necessary.
+// In case the expressions have different sizes or a fixed size target has a different size,
+// a \a std::invalid_argument exception is thrown. Note that the blockwise evaluation is only
+// applied if none of the expressions is aliased with any of the targets. Otherwise the function
+// falls back to the sequential evaluation of the given assignments.
+*/
+template< typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args >  // Types of the remaining pairs
+inline void fusedAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   fusedAssign_backend( true, []( auto& a, const auto& b ) { a = b; },
+                        []( size_t, size_t ) {}, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused assignment of several vector expressions to dense vectors with subsequent
+//        reduction of the first target.
+// \ingroup dense_vector
+//
+// \param red The reduction operation.
+// \param lhs The first target dense vector, which is reduced after the assignment.
+// \param rhs The vector expression to be assigned to the first target.
+// \param args The remaining target/expression pairs.
+// \return The result of the reduction of the first target.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector assignments at once (see fusedAssign()) and in
+// the same sweep reduces the first target by means of the given reduction operation. Since the
+// reduction is applied to every block right after its assignment, the target does not have to
+// be loaded again from main memory. The reduction operation can either be a binary reduction
+// operation (as for instance blaze::Add, blaze::Mult, blaze::Max, or blaze::Min) or one of the
+// norm functors blaze::SqrNorm, blaze::L1Norm, blaze::L2Norm, blaze::L3Norm, or blaze::L4Norm:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, r, x;
+   // ... Resizing and initialization
+
+   // Equivalent to 'r = b - A * x; rr = sqrNorm( r );', but traverses r only once
+   const double rr = fusedAssign( blaze::SqrNorm(), r, b - A * x );
+   \endcode
+*/
+template< typename RED        // Type of the reduction operation
+        , typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args    // Types of the remaining pairs
+        , typename = EnableIf_t< !IsVector_v<RED> > >
+inline decltype(auto)
+   fusedAssign( RED red, DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return fusedReduce_backend( true, []( auto& a, const auto& b ) { a = b; },
+                               red, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused addition assignment of several vector expressions to dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The first target dense vector.
+// \param rhs The vector expression to be added to the first target.
+// \param args The remaining target/expression pairs.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector addition assignments in a single, blockwise
+// sweep (see fusedAssign()):
+
+   \code
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha;
+   // ... Resizing and initialization
+
+   // Equivalent to 'x += alpha * d; r += alpha * h;'
+   fusedAddAssign( x, alpha * d, r, alpha * h );
+   \endcode
+
+// In case the sizes of the targets and the expressions don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args >  // Types of the remaining pairs
+inline void fusedAddAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   fusedAssign_backend( false, []( auto& a, const auto& b ) { a += b; },
+                        []( size_t, size_t ) {}, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused addition assignment of several vector expressions to dense vectors with
+//        subsequent reduction of the first target.
+// \ingroup dense_vector
+//
+// \param red The reduction operation.
+// \param lhs The first target dense vector, which is reduced after the assignment.
+// \param rhs The vector expression to be added to the first target.
+// \param args The remaining target/expression pairs.
+// \return The result of the reduction of the first target.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector addition assignments in a single, blockwise
+// sweep and reduces the first target by means of the given reduction operation (see the
+// reducing fusedAssign() function):
+
+   \code
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha;
+   // ... Resizing and initialization
+
+   // Equivalent to 'r += alpha * h; x += alpha * d; beta = sqrNorm( r );'
+   const double beta = fusedAddAssign( blaze::SqrNorm(), r, alpha * h, x, alpha * d );
+   \endcode
+*/
+template< typename RED        // Type of the reduction operation
+        , typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args    // Types of the remaining pairs
+        , typename = EnableIf_t< !IsVector_v<RED> > >
+inline decltype(auto)
+   fusedAddAssign( RED red, DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return fusedReduce_backend( false, []( auto& a, const auto& b ) { a += b; },
+                               red, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused subtraction assignment of several vector expressions to dense vectors.
+// \ingroup dense_vector
+//
+// \param lhs The first target dense vector.
+// \param rhs The vector expression to be subtracted from the first target.
+// \param args The remaining target/expression pairs.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector subtraction assignments in a single, blockwise
+// sweep (see fusedAssign()). In case the sizes of the targets and the expressions don't match,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args >  // Types of the remaining pairs
+inline void fusedSubAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   fusedAssign_backend( false, []( auto& a, const auto& b ) { a -= b; },
+                        []( size_t, size_t ) {}, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused subtraction assignment of several vector expressions to dense vectors with
+//        subsequent reduction of the first target.
+// \ingroup dense_vector
+//
+// \param red The reduction operation.
+// \param lhs The first target dense vector, which is reduced after the assignment.
+// \param rhs The vector expression to be subtracted from the first target.
+// \param args The remaining target/expression pairs.
+// \return The result of the reduction of the first target.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs several dense vector subtraction assignments in a single, blockwise
+// sweep and reduces the first target by means of the given reduction operation (see the
+// reducing fusedAssign() function).
+*/
+template< typename RED        // Type of the reduction operation
+        , typename VT1        // Type of the left-hand side dense vector
+        , bool TF             // Transpose flag
+        , typename VT2        // Type of the right-hand side vector
+        , typename... Args    // Types of the remaining pairs
+        , typename = EnableIf_t< !IsVector_v<RED> > >
+inline decltype(auto)
+   fusedSubAssign( RED red, DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs, Args&&... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return fusedReduce_backend( false, []( auto& a, const auto& b ) { a -= b; },
+                               red, ~lhs, ~rhs, args... );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
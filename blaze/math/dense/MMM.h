@@ -57,6 +57,7 @@
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/functors/Noop.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/Serial.h>
@@ -77,6 +78,274 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition of a bias to a single element of the result of a dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param value The element to be updated.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param bias The bias operation.
+// \return void
+*/
+template< typename T     // Type of the element
+        , typename BI >  // Type of the bias operation
+BLAZE_ALWAYS_INLINE void mmmBias( T& value, size_t i, size_t j, const BI& bias )
+{
+   value += bias( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition of an empty bias to a single element of the result of a dense matrix
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \return void
+*/
+template< typename T >  // Type of the element
+BLAZE_ALWAYS_INLINE void mmmBias( T&, size_t, size_t, const Noop& )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Write-back of a single element of a general dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param value The partial result of the current outer block.
+// \param beta The scaling factor for \f$ C \f$.
+// \param first \a true in case this is the first contribution to the element.
+// \param bias The bias operation to be added to the result.
+// \return void
+//
+// This function updates the element \f$ C(i,j) \f$ with the given partial result. The first
+// contribution is combined with \f$ \beta*C(i,j) \f$ and the bias \c bias(i,j). Thus no
+// additional pass over \a C is required for scaling or bias operations. Since the bias is
+// evaluated before the element is written for the first time, it may refer to the same
+// element of \a C.
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename T     // Type of the partial result
+        , typename ST    // Type of the scaling factor
+        , typename BI >  // Type of the bias operation
+BLAZE_ALWAYS_INLINE void
+   mmmStore( MT& C, size_t i, size_t j, const T& value, ST beta, bool first, const BI& bias )
+{
+   if( !first ) {
+      C(i,j) += value;
+   }
+   else {
+      ElementType_t<MT> tmp( value );
+      if( !isDefault( beta ) )
+         tmp += beta * C(i,j);
+      mmmBias( tmp, i, j, bias );
+      C(i,j) = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the target matrix of a dense matrix multiplication
+//        (\f$ C=\beta*C+bias \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param beta The scaling factor for \f$ C \f$.
+// \param bias The bias operation.
+// \return void
+//
+// This function initializes the target matrix of a dense matrix multiplication, which is
+// subsequently updated by adding the product. The bias of each element is evaluated before
+// the element is written, therefore it may refer to the same element of \a C.
+*/
+template< typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename ST    // Type of the scaling factor
+        , typename BI >  // Type of the bias operation
+void mmmInit( DenseMatrix<MT,SO>& C, ST beta, const BI& bias )
+{
+   const size_t M( (~C).rows()    );
+   const size_t N( (~C).columns() );
+
+   const size_t outer( SO ? N : M );
+   const size_t inner( SO ? M : N );
+
+   for( size_t o=0UL; o<outer; ++o ) {
+      for( size_t n=0UL; n<inner; ++n )
+      {
+         const size_t i( SO ? n : o );
+         const size_t j( SO ? o : n );
+
+         ElementType_t<MT> tmp( bias( i, j ) );
+         if( !isDefault( beta ) )
+            tmp += beta * (~C)(i,j);
+         (~C)(i,j) = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the target matrix of a dense matrix multiplication without bias
+//        (\f$ C=\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+*/
+template< typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename ST >  // Type of the scaling factor
+void mmmInit( DenseMatrix<MT,SO>& C, ST beta, const Noop& )
+{
+   if( isDefault( beta ) ) {
+      reset( ~C );
+   }
+   else if( !isOne( beta ) ) {
+      (~C) *= beta;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an epilogue operation to a block of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param row The index of the first row of the block.
+// \param column The index of the first column of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param epilogue The epilogue operation to be applied.
+// \return void
+//
+// This function applies the given epilogue operation to all elements of the specified block
+// of \a C. It is used for all parts of a multiplication that are not computed by the fused
+// write-back of the vectorized kernels.
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename EP >  // Type of the epilogue operation
+void mmmEpilogue( DenseMatrix<MT,false>& C, size_t row, size_t column, size_t m, size_t n,
+                  const EP& epilogue )
+{
+   for( size_t i=row; i<row+m; ++i ) {
+      for( size_t j=column; j<column+n; ++j ) {
+         (~C)(i,j) = epilogue( i, j, (~C)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an epilogue operation to a block of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param row The index of the first row of the block.
+// \param column The index of the first column of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param epilogue The epilogue operation to be applied.
+// \return void
+//
+// This function applies the given epilogue operation to all elements of the specified block
+// of \a C. It is used for all parts of a multiplication that are not computed by the fused
+// write-back of the vectorized kernels.
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename EP >  // Type of the epilogue operation
+void mmmEpilogue( DenseMatrix<MT,true>& C, size_t row, size_t column, size_t m, size_t n,
+                  const EP& epilogue )
+{
+   for( size_t j=column; j<column+n; ++j ) {
+      for( size_t i=row; i<row+m; ++i ) {
+         (~C)(i,j) = epilogue( i, j, (~C)(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an empty epilogue operation to a block of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \return void
+*/
+template< typename MT >  // Type of the target dense matrix
+inline void mmmEpilogue( DenseMatrix<MT,false>&, size_t, size_t, size_t, size_t, const Noop& )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an empty epilogue operation to a block of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \return void
+*/
+template< typename MT >  // Type of the target dense matrix
+inline void mmmEpilogue( DenseMatrix<MT,true>&, size_t, size_t, size_t, size_t, const Noop& )
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of an epilogue operation to all elements of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param epilogue The epilogue operation to be applied.
+// \return void
+*/
+template< typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename EP >  // Type of the epilogue operation
+inline void mmmEpilogue( DenseMatrix<MT,SO>& C, const EP& epilogue )
+{
+   mmmEpilogue( ~C, 0UL, 0UL, (~C).rows(), (~C).columns(), epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
@@ -86,7 +355,7 @@ namespace blaze {
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
+//        (\f$ C=op(\alpha*A*B+\beta*C+bias) \f$).
 // \ingroup dense_matrix
 //
 // \param C The target left-hand side row-major dense matrix.
@@ -94,16 +363,29 @@ namespace blaze {
 // \param B The right-hand side multiplication operand.
 // \param alpha The scaling factor for \f$ A*B \f$.
 // \param beta The scaling factor for \f$ C \f$.
+// \param bias The bias operation to be added to each element of the result.
+// \param epilogue The epilogue operation to be applied to each element of the result.
 // \return void
 //
 // This function implements the compute kernel for a general dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// multiplication of the form \f$ C=op(\alpha*A*B+\beta*C+bias) \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // row-major dense matrix type. The element types of all three matrices must be SIMD
 // combinable, i.e. must provide a common SIMD interface.
+//
+// The bias operation is called as \c bias(i,j) and returns the value to be added to the
+// element \f$ C(i,j) \f$. It is evaluated before the element is written for the first time
+// and may therefore refer to the same element of \a C. The epilogue operation is called as
+// \c epilogue(i,j,value) with the row and column index and the final value of an element and
+// returns the value to be stored in \a C. In case neither \a A nor \a B is a lower or upper
+// matrix, the scaling of \a C and the bias are fused into the write-back of the micro kernels
+// and the epilogue operation is applied to each panel of \a C right after its last update,
+// while the panel still resides in cache. Thus no separate pass over \a C is required.
+// Passing a \a Noop functor as bias or epilogue operation disables the according operation.
 */
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+template< typename MT1, typename MT2, typename MT3, typename ST, typename BI, typename EP >
+void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta,
+          const BI& bias, const EP& epilogue )
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -127,6 +409,7 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool fusable( !IsLower_v<MT2> && !IsUpper_v<MT2> && !IsLower_v<MT3> && !IsUpper_v<MT3> );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -143,11 +426,10 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
-   if( isDefault( beta ) ) {
-      reset( ~C );
-   }
-   else if( !isOne( beta ) ) {
-      (~C) *= beta;
+   const bool init( !fusable || K < ( remainder ? SIMDSIZE : 1UL ) );
+
+   if( init ) {
+      mmmInit( ~C, beta, bias );
    }
 
    size_t kk( 0UL );
@@ -162,6 +444,9 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
       }
 
+      const bool first( !init && kk == 0UL );
+      const bool last ( fusable && kk+kblock == K );
+
       const size_t ibegin( IsLower_v<MT2> ? kk : 0UL );
       const size_t iend  ( IsUpper_v<MT2> ? kk+kblock : M );
       const size_t isize ( iend - ibegin );
@@ -218,16 +503,16 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                      xmm10 += a5 * b2;
                   }
 
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j    ) += sum( xmm9  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j+1UL) += sum( xmm10 ) * alpha;
+                  mmmStore( ~C, ibegin+i    , jj+j    , sum( xmm1  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i    , jj+j+1UL, sum( xmm2  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j    , sum( xmm3  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j+1UL, sum( xmm4  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j    , sum( xmm5  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j+1UL, sum( xmm6  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j    , sum( xmm7  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j+1UL, sum( xmm8  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+4UL, jj+j    , sum( xmm9  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+4UL, jj+j+1UL, sum( xmm10 ) * alpha, beta, first, bias );
                }
 
                if( j<jblock )
@@ -251,11 +536,11 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                      xmm5 += a5 * b1;
                   }
 
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j) += sum( xmm5 ) * alpha;
+                  mmmStore( ~C, ibegin+i    , jj+j, sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j, sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j, sum( xmm4 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+4UL, jj+j, sum( xmm5 ) * alpha, beta, first, bias );
                }
             }
          }
@@ -289,14 +574,14 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                      xmm8 += a4 * b2;
                   }
 
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8 ) * alpha;
+                  mmmStore( ~C, ibegin+i    , jj+j    , sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i    , jj+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j    , sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j+1UL, sum( xmm4 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j    , sum( xmm5 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j+1UL, sum( xmm6 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j    , sum( xmm7 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j+1UL, sum( xmm8 ) * alpha, beta, first, bias );
                }
 
                if( j<jblock )
@@ -318,10 +603,10 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                      xmm4 += a4 * b1;
                   }
 
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
+                  mmmStore( ~C, ibegin+i    , jj+j, sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+1UL, jj+j, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+2UL, jj+j, sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ibegin+i+3UL, jj+j, sum( xmm4 ) * alpha, beta, first, bias );
                }
             }
          }
@@ -354,14 +639,14 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                   xmm8 += a2 * b4;
                }
 
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+2UL) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+3UL) += sum( xmm4 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+2UL) += sum( xmm7 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+3UL) += sum( xmm8 ) * alpha;
+               mmmStore( ~C, ibegin+i    , jj+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i    , jj+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i    , jj+j+2UL, sum( xmm3 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i    , jj+j+3UL, sum( xmm4 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j    , sum( xmm5 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j+1UL, sum( xmm6 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j+2UL, sum( xmm7 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j+3UL, sum( xmm8 ) * alpha, beta, first, bias );
             }
 
             for( ; (j+2UL) <= jblock; j+=2UL )
@@ -382,10 +667,10 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                   xmm4 += a2 * b2;
                }
 
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
+               mmmStore( ~C, ibegin+i    , jj+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i    , jj+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j    , sum( xmm3 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j+1UL, sum( xmm4 ) * alpha, beta, first, bias );
             }
 
             if( j<jblock )
@@ -403,8 +688,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                   xmm2 += a2 * b1;
                }
 
-               (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
+               mmmStore( ~C, ibegin+i    , jj+j, sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i+1UL, jj+j, sum( xmm2 ) * alpha, beta, first, bias );
             }
          }
 
@@ -424,8 +709,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                   xmm2 += a1 * B2.load(k,j+1UL);
                }
 
-               (~C)(ibegin+i,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i,jj+j+1UL) += sum( xmm2 ) * alpha;
+               mmmStore( ~C, ibegin+i, jj+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ibegin+i, jj+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
             }
 
             if( j<jblock )
@@ -439,10 +724,14 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
                   xmm1 += a1 * B2.load(k,j);
                }
 
-               (~C)(ibegin+i,jj+j) += sum( xmm1 ) * alpha;
+               mmmStore( ~C, ibegin+i, jj+j, sum( xmm1 ) * alpha, beta, first, bias );
             }
          }
 
+         if( last ) {
+            mmmEpilogue( ~C, ibegin, jj, isize, jblock, epilogue );
+         }
+
          jj += jblock;
       }
 
@@ -575,9 +864,17 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
             }
          }
 
+         if( fusable ) {
+            mmmEpilogue( ~C, ibegin, jj, isize, jblock, epilogue );
+         }
+
          jj += jblock;
       }
    }
+
+   if( !fusable || K == 0UL ) {
+      mmmEpilogue( ~C, epilogue );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -586,7 +883,7 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
+//        (\f$ C=op(\alpha*A*B+\beta*C+bias) \f$).
 // \ingroup dense_matrix
 //
 // \param C The target left-hand side column-major dense matrix.
@@ -594,16 +891,29 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 // \param B The right-hand side multiplication operand.
 // \param alpha The scaling factor for \f$ A*B \f$.
 // \param beta The scaling factor for \f$ C \f$.
+// \param bias The bias operation to be added to each element of the result.
+// \param epilogue The epilogue operation to be applied to each element of the result.
 // \return void
 //
 // This function implements the compute kernel for a general dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// multiplication of the form \f$ C=op(\alpha*A*B+\beta*C+bias) \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // column-major dense matrix type. The element types of all three matrices must be SIMD
 // combinable, i.e. must provide a common SIMD interface.
+//
+// The bias operation is called as \c bias(i,j) and returns the value to be added to the
+// element \f$ C(i,j) \f$. It is evaluated before the element is written for the first time
+// and may therefore refer to the same element of \a C. The epilogue operation is called as
+// \c epilogue(i,j,value) with the row and column index and the final value of an element and
+// returns the value to be stored in \a C. In case neither \a A nor \a B is a lower or upper
+// matrix, the scaling of \a C and the bias are fused into the write-back of the micro kernels
+// and the epilogue operation is applied to each panel of \a C right after its last update,
+// while the panel still resides in cache. Thus no separate pass over \a C is required.
+// Passing a \a Noop functor as bias or epilogue operation disables the according operation.
 */
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+template< typename MT1, typename MT2, typename MT3, typename ST, typename BI, typename EP >
+void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta,
+          const BI& bias, const EP& epilogue )
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -627,6 +937,7 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
+   constexpr bool fusable( !IsLower_v<MT2> && !IsUpper_v<MT2> && !IsLower_v<MT3> && !IsUpper_v<MT3> );
 
    constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
    constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
@@ -643,11 +954,10 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
-   if( isDefault( beta ) ) {
-      reset( ~C );
-   }
-   else if( !isOne( beta ) ) {
-      (~C) *= beta;
+   const bool init( !fusable || K < ( remainder ? SIMDSIZE : 1UL ) );
+
+   if( init ) {
+      mmmInit( ~C, beta, bias );
    }
 
    size_t kk( 0UL );
@@ -662,6 +972,9 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
          kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
       }
 
+      const bool first( !init && kk == 0UL );
+      const bool last ( fusable && kk+kblock == K );
+
       const size_t jbegin( IsUpper_v<MT3> ? kk : 0UL );
       const size_t jend  ( IsLower_v<MT3> ? kk+kblock : N );
       const size_t jsize ( jend - jbegin );
@@ -718,16 +1031,16 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                      xmm10 += a2 * b5;
                   }
 
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+4UL) += sum( xmm5  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm6  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm7  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm8  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm9  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+4UL) += sum( xmm10 ) * alpha;
+                  mmmStore( ~C, ii+i    , jbegin+j    , sum( xmm1  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+1UL, sum( xmm2  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+2UL, sum( xmm3  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+3UL, sum( xmm4  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+4UL, sum( xmm5  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j    , sum( xmm6  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+1UL, sum( xmm7  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+2UL, sum( xmm8  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+3UL, sum( xmm9  ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+4UL, sum( xmm10 ) * alpha, beta, first, bias );
                }
 
                if( i<iblock )
@@ -745,11 +1058,11 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                      xmm5 += a1 * B2.load(k,j+4UL);
                   }
 
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i,jbegin+j+4UL) += sum( xmm5 ) * alpha;
+                  mmmStore( ~C, ii+i, jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+2UL, sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+3UL, sum( xmm4 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+4UL, sum( xmm5 ) * alpha, beta, first, bias );
                }
             }
          }
@@ -783,14 +1096,14 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                      xmm8 += a2 * b4;
                   }
 
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm7 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm8 ) * alpha;
+                  mmmStore( ~C, ii+i    , jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+2UL, sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i    , jbegin+j+3UL, sum( xmm4 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j    , sum( xmm5 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+1UL, sum( xmm6 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+2UL, sum( xmm7 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i+1UL, jbegin+j+3UL, sum( xmm8 ) * alpha, beta, first, bias );
                }
 
                if( i<iblock )
@@ -807,10 +1120,10 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                      xmm4 += a1 * B2.load(k,j+3UL);
                   }
 
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
+                  mmmStore( ~C, ii+i, jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+2UL, sum( xmm3 ) * alpha, beta, first, bias );
+                  mmmStore( ~C, ii+i, jbegin+j+3UL, sum( xmm4 ) * alpha, beta, first, bias );
                }
             }
          }
@@ -843,14 +1156,14 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                   xmm8 += a4 * b2;
                }
 
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j    ) += sum( xmm7 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j+1UL) += sum( xmm8 ) * alpha;
+               mmmStore( ~C, ii+i    , jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i    , jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+1UL, jbegin+j    , sum( xmm3 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+1UL, jbegin+j+1UL, sum( xmm4 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+2UL, jbegin+j    , sum( xmm5 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+2UL, jbegin+j+1UL, sum( xmm6 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+3UL, jbegin+j    , sum( xmm7 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+3UL, jbegin+j+1UL, sum( xmm8 ) * alpha, beta, first, bias );
             }
 
             for( ; (i+2UL) <= iblock; i+=2UL )
@@ -871,10 +1184,10 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                   xmm4 += a2 * b2;
                }
 
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
+               mmmStore( ~C, ii+i    , jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i    , jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+1UL, jbegin+j    , sum( xmm3 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+1UL, jbegin+j+1UL, sum( xmm4 ) * alpha, beta, first, bias );
             }
 
             if( i<iblock )
@@ -889,8 +1202,8 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                   xmm2 += a1 * B2.load(k,j+1UL);
                }
 
-               (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
+               mmmStore( ~C, ii+i, jbegin+j    , sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i, jbegin+j+1UL, sum( xmm2 ) * alpha, beta, first, bias );
             }
          }
 
@@ -910,8 +1223,8 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                   xmm2 += A2.load(i+1UL,k) * b1;
                }
 
-               (~C)(ii+i    ,jbegin+j) += sum( xmm1 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j) += sum( xmm2 ) * alpha;
+               mmmStore( ~C, ii+i    , jbegin+j, sum( xmm1 ) * alpha, beta, first, bias );
+               mmmStore( ~C, ii+i+1UL, jbegin+j, sum( xmm2 ) * alpha, beta, first, bias );
             }
 
             if( i<iblock )
@@ -923,10 +1236,14 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
                   xmm1 += A2.load(i,k) * B2.load(k,j);
                }
 
-               (~C)(ii+i,jbegin+j) += sum( xmm1 ) * alpha;
+               mmmStore( ~C, ii+i, jbegin+j, sum( xmm1 ) * alpha, beta, first, bias );
             }
          }
 
+         if( last ) {
+            mmmEpilogue( ~C, ii, jbegin, iblock, jsize, epilogue );
+         }
+
          ii += iblock;
       }
 
@@ -1059,9 +1376,45 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
             }
          }
 
+         if( fusable ) {
+            mmmEpilogue( ~C, ii, jbegin, iblock, jsize, epilogue );
+         }
+
          ii += iblock;
       }
    }
+
+   if( !fusable || K == 0UL ) {
+      mmmEpilogue( ~C, epilogue );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor
+// dense matrix type. The element types of all three matrices must be SIMD combinable,
+// i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+inline void mmm( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   mmm( C, A, B, alpha, beta, Noop(), Noop() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,515 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NarrowMMM.h
+//  \brief Header file for the narrow matrix multiplication kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_NARROWMMM_H_
+#define _BLAZE_MATH_DENSE_NARROWMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SIMDCombinable.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a single SIMD vector of a narrow matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param i The row index of the SIMD vector.
+// \param j The column index of the SIMD vector.
+// \param xmm The accumulated SIMD vector of the product \f$ A*B \f$.
+// \param a The SIMD vector of the scaling factor \f$ \alpha \f$.
+// \param b The SIMD vector of the scaling factor \f$ \beta \f$.
+// \param init \a true in case \f$ \beta \f$ is 0 and \a C must not be read, \a false if not.
+// \return void
+*/
+template< typename MT          // Type of the target matrix
+        , typename SIMDType >  // Type of the SIMD vectors
+BLAZE_ALWAYS_INLINE void nmmmStore( MT& C, size_t i, size_t j, const SIMDType& xmm,
+                                    const SIMDType& a, const SIMDType& b, bool init )
+{
+   if( init )
+      C.store( i, j, xmm * a );
+   else
+      C.store( i, j, C.load(i,j) * b + xmm * a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NARROW MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a dense matrix/narrow dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side row-major dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of a dense matrix with a
+// narrow, row-major dense matrix (i.e. a matrix with only a few columns, as for instance the
+// block of vectors of a block Krylov method). In contrast to the general kernels, which iterate
+// over blocks of columns in the outermost loop, this kernel computes complete rows of \a C with
+// all accumulators held in registers. Thus the (potentially large) matrix \a A is traversed
+// exactly once. \a C must be a non-expression, row-major dense matrix type, \a B must be a
+// non-expression, row-major dense matrix type. The element types of all three matrices must be
+// SIMD combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side dense matrix
+        , typename MT3   // Type of the right-hand side dense matrix
+        , typename ST >  // Type of the scaling factors
+EnableIf_t< IsDenseMatrix_v<MT2> >
+   nmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+   using SIMDType = SIMDTrait_t<ET1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
+
+   constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<MT3> );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( K == B.rows()      , "Invalid matrix sizes detected" );
+   BLAZE_INTERNAL_ASSERT( M == (~C).rows()   , "Invalid matrix sizes detected" );
+   BLAZE_INTERNAL_ASSERT( N == (~C).columns(), "Invalid matrix sizes detected" );
+
+   const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const bool init( isDefault( beta ) );
+   const SIMDType a( set( ET1( alpha ) ) );
+   const SIMDType b( set( ET1( beta  ) ) );
+
+   size_t i( 0UL );
+
+   for( ; (i+2UL) <= M; i+=2UL )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i    ,k) ) );
+            const SIMDType a2( set( A(i+1UL,k) ) );
+            const SIMDType b1( B.load(k,j             ) );
+            const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
+            const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
+            const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
+            xmm1 += a1 * b1;
+            xmm2 += a1 * b2;
+            xmm3 += a1 * b3;
+            xmm4 += a1 * b4;
+            xmm5 += a2 * b1;
+            xmm6 += a2 * b2;
+            xmm7 += a2 * b3;
+            xmm8 += a2 * b4;
+         }
+
+         nmmmStore( ~C, i    , j             , xmm1, a, b, init );
+         nmmmStore( ~C, i    , j+SIMDSIZE    , xmm2, a, b, init );
+         nmmmStore( ~C, i    , j+SIMDSIZE*2UL, xmm3, a, b, init );
+         nmmmStore( ~C, i    , j+SIMDSIZE*3UL, xmm4, a, b, init );
+         nmmmStore( ~C, i+1UL, j             , xmm5, a, b, init );
+         nmmmStore( ~C, i+1UL, j+SIMDSIZE    , xmm6, a, b, init );
+         nmmmStore( ~C, i+1UL, j+SIMDSIZE*2UL, xmm7, a, b, init );
+         nmmmStore( ~C, i+1UL, j+SIMDSIZE*3UL, xmm8, a, b, init );
+      }
+
+      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i    ,k) ) );
+            const SIMDType a2( set( A(i+1UL,k) ) );
+            const SIMDType b1( B.load(k,j         ) );
+            const SIMDType b2( B.load(k,j+SIMDSIZE) );
+            xmm1 += a1 * b1;
+            xmm2 += a1 * b2;
+            xmm3 += a2 * b1;
+            xmm4 += a2 * b2;
+         }
+
+         nmmmStore( ~C, i    , j         , xmm1, a, b, init );
+         nmmmStore( ~C, i    , j+SIMDSIZE, xmm2, a, b, init );
+         nmmmStore( ~C, i+1UL, j         , xmm3, a, b, init );
+         nmmmStore( ~C, i+1UL, j+SIMDSIZE, xmm4, a, b, init );
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE )
+      {
+         SIMDType xmm1, xmm2;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i    ,k) ) );
+            const SIMDType a2( set( A(i+1UL,k) ) );
+            const SIMDType b1( B.load(k,j) );
+            xmm1 += a1 * b1;
+            xmm2 += a2 * b1;
+         }
+
+         nmmmStore( ~C, i    , j, xmm1, a, b, init );
+         nmmmStore( ~C, i+1UL, j, xmm2, a, b, init );
+      }
+
+      for( ; remainder && j<N; ++j )
+      {
+         ET1 value1{}, value2{};
+
+         for( size_t k=0UL; k<K; ++k ) {
+            value1 += A(i    ,k) * B(k,j);
+            value2 += A(i+1UL,k) * B(k,j);
+         }
+
+         (~C)(i    ,j) = ( init )?( alpha*value1 ):( beta*(~C)(i    ,j) + alpha*value1 );
+         (~C)(i+1UL,j) = ( init )?( alpha*value2 ):( beta*(~C)(i+1UL,j) + alpha*value2 );
+      }
+   }
+
+   if( i < M )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE*7UL) < jpos; j+=SIMDSIZE*8UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i,k) ) );
+            xmm1 += a1 * B.load(k,j             );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+            xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+            xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+            xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
+            xmm6 += a1 * B.load(k,j+SIMDSIZE*5UL);
+            xmm7 += a1 * B.load(k,j+SIMDSIZE*6UL);
+            xmm8 += a1 * B.load(k,j+SIMDSIZE*7UL);
+         }
+
+         nmmmStore( ~C, i, j             , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE    , xmm2, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*2UL, xmm3, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*3UL, xmm4, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*4UL, xmm5, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*5UL, xmm6, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*6UL, xmm7, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*7UL, xmm8, a, b, init );
+      }
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i,k) ) );
+            xmm1 += a1 * B.load(k,j             );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+            xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+            xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+         }
+
+         nmmmStore( ~C, i, j             , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE    , xmm2, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*2UL, xmm3, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*3UL, xmm4, a, b, init );
+      }
+
+      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
+      {
+         SIMDType xmm1, xmm2;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i,k) ) );
+            xmm1 += a1 * B.load(k,j         );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE);
+         }
+
+         nmmmStore( ~C, i, j         , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE, xmm2, a, b, init );
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE )
+      {
+         SIMDType xmm1;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( set( A(i,k) ) );
+            xmm1 += a1 * B.load(k,j);
+         }
+
+         nmmmStore( ~C, i, j, xmm1, a, b, init );
+      }
+
+      for( ; remainder && j<N; ++j )
+      {
+         ET1 value{};
+
+         for( size_t k=0UL; k<K; ++k ) {
+            value += A(i,k) * B(k,j);
+         }
+
+         (~C)(i,j) = ( init )?( alpha*value ):( beta*(~C)(i,j) + alpha*value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a row-major sparse matrix/narrow dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of a row-major sparse
+// matrix with a narrow, row-major dense matrix (i.e. a matrix with only a few columns, as for
+// instance the block of vectors of a block Krylov method). For every row of \a A all columns of
+// the corresponding row of \a C are accumulated in registers and stored only once. Thus each
+// non-zero element of \a A is loaded exactly once from main memory and used for all columns of
+// \a B. \a C must be a non-expression, row-major dense matrix type, \a B must be a non-expression,
+// row-major dense matrix type. The element types of all three matrices must be SIMD combinable,
+// i.e. must provide a common SIMD interface.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side sparse matrix
+        , typename MT3   // Type of the right-hand side dense matrix
+        , typename ST >  // Type of the scaling factors
+EnableIf_t< IsSparseMatrix_v<MT2> >
+   nmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+   using SIMDType = SIMDTrait_t<ET1>;
+   using ConstIterator = ConstIterator_t<MT2>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
+
+   constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<MT3> );
+
+   const size_t M( A.rows() );
+   const size_t N( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+   BLAZE_INTERNAL_ASSERT( M == (~C).rows()       , "Invalid matrix sizes detected" );
+   BLAZE_INTERNAL_ASSERT( N == (~C).columns()    , "Invalid matrix sizes detected" );
+
+   const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const bool init( isDefault( beta ) );
+   const SIMDType a( set( ET1( alpha ) ) );
+   const SIMDType b( set( ET1( beta  ) ) );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const ConstIterator begin( A.begin(i) );
+      const ConstIterator end  ( A.end(i)   );
+
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE*7UL) < jpos; j+=SIMDSIZE*8UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         for( ConstIterator element=begin; element!=end; ++element ) {
+            const SIMDType a1( set( element->value() ) );
+            const size_t k( element->index() );
+            xmm1 += a1 * B.load(k,j             );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+            xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+            xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+            xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
+            xmm6 += a1 * B.load(k,j+SIMDSIZE*5UL);
+            xmm7 += a1 * B.load(k,j+SIMDSIZE*6UL);
+            xmm8 += a1 * B.load(k,j+SIMDSIZE*7UL);
+         }
+
+         nmmmStore( ~C, i, j             , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE    , xmm2, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*2UL, xmm3, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*3UL, xmm4, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*4UL, xmm5, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*5UL, xmm6, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*6UL, xmm7, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*7UL, xmm8, a, b, init );
+      }
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+
+         for( ConstIterator element=begin; element!=end; ++element ) {
+            const SIMDType a1( set( element->value() ) );
+            const size_t k( element->index() );
+            xmm1 += a1 * B.load(k,j             );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+            xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+            xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+         }
+
+         nmmmStore( ~C, i, j             , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE    , xmm2, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*2UL, xmm3, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE*3UL, xmm4, a, b, init );
+      }
+
+      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
+      {
+         SIMDType xmm1, xmm2;
+
+         for( ConstIterator element=begin; element!=end; ++element ) {
+            const SIMDType a1( set( element->value() ) );
+            const size_t k( element->index() );
+            xmm1 += a1 * B.load(k,j         );
+            xmm2 += a1 * B.load(k,j+SIMDSIZE);
+         }
+
+         nmmmStore( ~C, i, j         , xmm1, a, b, init );
+         nmmmStore( ~C, i, j+SIMDSIZE, xmm2, a, b, init );
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE )
+      {
+         SIMDType xmm1;
+
+         for( ConstIterator element=begin; element!=end; ++element ) {
+            const SIMDType a1( set( element->value() ) );
+            const size_t k( element->index() );
+            xmm1 += a1 * B.load(k,j);
+         }
+
+         nmmmStore( ~C, i, j, xmm1, a, b, init );
+      }
+
+      for( ; remainder && j<N; ++j )
+      {
+         ET1 value{};
+
+         for( ConstIterator element=begin; element!=end; ++element ) {
+            value += element->value() * B(element->index(),j);
+         }
+
+         (~C)(i,j) = ( init )?( alpha*value ):( beta*(~C)(i,j) + alpha*value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Strassen.h
+//  \brief Header file for the Strassen-Winograd matrix multiplication
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRASSEN_H_
+#define _BLAZE_MATH_DENSE_STRASSEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculation of the size of the workspace for a Strassen-Winograd matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param k The number of columns of the left-hand side operand.
+// \return The number of elements of the workspace.
+//
+// This function returns the number of elements required as workspace for all recursion levels
+// of a Strassen-Winograd matrix multiplication. Each level requires one temporary for the sums
+// of blocks of the left-hand side operand (which is reused for a product) and one temporary for
+// the sums of blocks of the right-hand side operand.
+*/
+inline size_t strassenWorkspace( size_t m, size_t n, size_t k )
+{
+   size_t size( 0UL );
+
+   while( min( m, n, k ) >= STRASSEN_THRESHOLD ) {
+      m /= 2UL;
+      n /= 2UL;
+      k /= 2UL;
+      size += m*max( k, n ) + k*n;
+   }
+
+   return size;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creation of a view on a block of a custom matrix.
+// \ingroup dense_matrix
+//
+// \param M The custom matrix.
+// \param row The index of the first row of the block.
+// \param column The index of the first column of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \return Custom matrix representing the specified block.
+*/
+template< typename MT >  // Type of the custom matrix
+inline MT strassenBlock( MT& M, size_t row, size_t column, size_t m, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( row    + m <= M.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= M.columns(), "Invalid number of columns" );
+
+   const size_t spacing( M.spacing() );
+   const size_t offset( IsColumnMajorMatrix_v<MT> ? row + column*spacing : row*spacing + column );
+
+   return MT( M.data() + offset, m, n, spacing );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRASSEN-WINOGRAD MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the Strassen-Winograd matrix multiplication (\f$ C=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side custom matrix.
+// \param A The left-hand side custom matrix operand.
+// \param B The right-hand side custom matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param work The workspace for the current and all subsequent recursion levels.
+// \return void
+//
+// This function performs one recursion level of the Strassen-Winograd algorithm on the even
+// part of the given matrices. The seven half-sized products are scheduled such that only two
+// temporaries are required (see Boyer, Dumas, Pernet, Zhou: "Memory efficient scheduling of
+// Strassen-Winograd's matrix multiplication algorithm"), the blocks of \a C serve as storage
+// for the intermediate products. Odd rows and columns are peeled off and handled by means of
+// the default kernels. In case any dimension is smaller than the Strassen threshold, the
+// product is computed by the default kernels (or the BLAS kernels, if enabled).
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void strassenBackend( MT1& C, MT2& A, MT3& B, ST alpha, ElementType_t<MT1>* work )
+{
+   using ET = ElementType_t<MT1>;
+
+   const size_t M( C.rows() );
+   const size_t N( C.columns() );
+   const size_t K( A.columns() );
+
+   if( min( M, N, K ) < STRASSEN_THRESHOLD ) {
+      assign( C, ( A * B ) * alpha );
+      return;
+   }
+
+   const size_t m( M / 2UL );
+   const size_t n( N / 2UL );
+   const size_t k( K / 2UL );
+
+   ET* const X( work );
+   ET* const Y( X + m*max( k, n ) );
+   ET* const next( Y + k*n );
+
+   MT1 C11( strassenBlock( C, 0UL, 0UL, m, n ) );
+   MT1 C12( strassenBlock( C, 0UL, n  , m, n ) );
+   MT1 C21( strassenBlock( C, m  , 0UL, m, n ) );
+   MT1 C22( strassenBlock( C, m  , n  , m, n ) );
+
+   MT2 A11( strassenBlock( A, 0UL, 0UL, m, k ) );
+   MT2 A12( strassenBlock( A, 0UL, k  , m, k ) );
+   MT2 A21( strassenBlock( A, m  , 0UL, m, k ) );
+   MT2 A22( strassenBlock( A, m  , k  , m, k ) );
+
+   MT3 B11( strassenBlock( B, 0UL, 0UL, k, n ) );
+   MT3 B12( strassenBlock( B, 0UL, n  , k, n ) );
+   MT3 B21( strassenBlock( B, k  , 0UL, k, n ) );
+   MT3 B22( strassenBlock( B, k  , n  , k, n ) );
+
+   MT2 S( X, m, k, IsColumnMajorMatrix_v<MT2> ? m : k );  // Sums of blocks of A
+   MT3 T( Y, k, n, IsColumnMajorMatrix_v<MT3> ? k : n );  // Sums of blocks of B
+   MT1 P( X, m, n, IsColumnMajorMatrix_v<MT1> ? m : n );  // Product P1
+
+   assign( S, A11 - A21 );                         // S3 = A11 - A21
+   assign( T, B22 - B12 );                         // T3 = B22 - B12
+   strassenBackend( C21, S, T, alpha, next );    // P7 = S3 * T3
+   assign( S, A21 + A22 );                         // S1 = A21 + A22
+   assign( T, B12 - B11 );                         // T1 = B12 - B11
+   strassenBackend( C22, S, T, alpha, next );    // P5 = S1 * T1
+   subAssign( S, A11 );                            // S2 = S1 - A11
+   assign( T, B22 - T );                           // T2 = B22 - T1
+   strassenBackend( C12, S, T, alpha, next );    // P6 = S2 * T2
+   assign( S, A12 - S );                           // S4 = A12 - S2
+   strassenBackend( C11, S, B22, alpha, next );   // P3 = S4 * B22
+   strassenBackend( P, A11, B11, alpha, next );    // P1 = A11 * B11
+   addAssign( C12, P );                            // U2 = P1 + P6
+   addAssign( C21, C12 );                          // U3 = U2 + P7
+   addAssign( C12, C22 );                          // U4 = U2 + P5
+   addAssign( C22, C21 );                          // U7 = U3 + P5 = C22
+   addAssign( C12, C11 );                          // U5 = U4 + P3 = C12
+   subAssign( T, B21 );                            // T4 = T2 - B21
+   strassenBackend( C11, A22, T, alpha, next );   // P4 = A22 * T4
+   subAssign( C21, C11 );                          // U6 = U3 - P4 = C21
+   strassenBackend( C11, A12, B21, alpha, next );  // P2 = A12 * B21
+   addAssign( C11, P );                            // U1 = P1 + P2 = C11
+
+   if( K > 2UL*k ) {
+      MT1 C1( strassenBlock( C, 0UL, 0UL, 2UL*m, 2UL*n ) );
+      addAssign( C1, ( strassenBlock( A, 0UL, 2UL*k, 2UL*m, 1UL ) *
+                       strassenBlock( B, 2UL*k, 0UL, 1UL, 2UL*n ) ) * alpha );
+   }
+
+   if( N > 2UL*n ) {
+      MT1 C2( strassenBlock( C, 0UL, 2UL*n, M, 1UL ) );
+      assign( C2, ( A * strassenBlock( B, 0UL, 2UL*n, K, 1UL ) ) * alpha );
+   }
+
+   if( M > 2UL*m ) {
+      MT1 C3( strassenBlock( C, 2UL*m, 0UL, 1UL, 2UL*n ) );
+      assign( C3, ( strassenBlock( A, 2UL*m, 0UL, 1UL, K ) *
+                    strassenBlock( B, 0UL, 0UL, K, 2UL*n ) ) * alpha );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Strassen-Winograd dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements the recursive Strassen-Winograd algorithm for a dense matrix/dense
+// matrix multiplication of the form \f$ C=\alpha*A*B \f$. Each recursion level computes the
+// product by means of seven instead of eight half-sized products, which reduces the number of
+// floating point operations by 12.5% per level. The recursion stops as soon as any dimension
+// is smaller than the Strassen threshold (see the BLAZE_STRASSEN_THRESHOLD setting), where the
+// default kernels (or the BLAS kernels, if enabled) are used. The workspace for all recursion
+// levels is allocated once up front. All three matrices are required to provide direct access
+// to their contiguous elements and to have the same element type.
+//
+// \note The Strassen-Winograd algorithm is numerically less stable than the conventional
+// matrix multiplication.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void strassen( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT3 );
+
+   using ET = ElementType_t<MT1>;
+
+   using VT1 = CustomMatrix< ET, unaligned, unpadded, SO >;
+   using VT2 = CustomMatrix< ET, unaligned, unpadded, IsColumnMajorMatrix_v<MT2> >;
+   using VT3 = CustomMatrix< ET, unaligned, unpadded, IsColumnMajorMatrix_v<MT3> >;
+
+   const size_t M( (~C).rows()    );
+   const size_t N( (~C).columns() );
+   const size_t K( A.columns()    );
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.rows()    == K, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == N, "Invalid number of columns" );
+
+   if( M == 0UL || N == 0UL ) {
+      return;
+   }
+   else if( K == 0UL ) {
+      reset( ~C );
+      return;
+   }
+
+   // The views on the operands are only read from
+   VT1 C2( (~C).data(), M, N, (~C).spacing() );
+   VT2 A2( const_cast<ET*>( A.data() ), M, K, A.spacing() );
+   VT3 B2( const_cast<ET*>( B.data() ), K, N, B.spacing() );
+
+   const size_t size( strassenWorkspace( M, N, K ) );
+   std::unique_ptr<ET[],Deallocate> work( size > 0UL ? allocate<ET>( size ) : nullptr );
+
+   strassenBackend( C2, A2, B2, alpha, work.get() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,408 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transpose.h
+//  \brief Header file for the dense matrix transpose kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TRANSPOSEKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro kernel for the transposition of a small square block of a dense matrix.
+// \ingroup dense_matrix
+//
+// The TransposeKernel class template represents the micro kernel of the dense matrix transpose
+// kernels. It transposes a square block of \a size by \a size elements, which for the built-in
+// floating point types is performed in SIMD registers by means of shuffle operations (2x2 and
+// 4x4 blocks for SSE, 4x4 and 8x8 blocks for AVX). For all other data types the block consists
+// of a single element. The \a apply() function writes the transpose of a block of the source
+// matrix to the destination matrix, the \a swap() function exchanges the transposes of two
+// blocks of the same matrix.
+*/
+template< typename T >  // Type of the elements
+struct TransposeKernel
+{
+   static constexpr size_t size = 1UL;
+
+   static BLAZE_ALWAYS_INLINE void apply( T* dst, size_t, const T* src, size_t )
+   {
+      *dst = *src;
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* a, T* b, size_t )
+   {
+      using std::swap;
+
+      swap( *a, *b );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TransposeKernel class template for single precision values.
+// \ingroup dense_matrix
+*/
+#if BLAZE_AVX_MODE
+template<>
+struct TransposeKernel<float>
+{
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m256* r ) noexcept
+   {
+      const __m256 t0( _mm256_unpacklo_ps( r[0], r[1] ) );
+      const __m256 t1( _mm256_unpackhi_ps( r[0], r[1] ) );
+      const __m256 t2( _mm256_unpacklo_ps( r[2], r[3] ) );
+      const __m256 t3( _mm256_unpackhi_ps( r[2], r[3] ) );
+      const __m256 t4( _mm256_unpacklo_ps( r[4], r[5] ) );
+      const __m256 t5( _mm256_unpackhi_ps( r[4], r[5] ) );
+      const __m256 t6( _mm256_unpacklo_ps( r[6], r[7] ) );
+      const __m256 t7( _mm256_unpackhi_ps( r[6], r[7] ) );
+
+      const __m256 s0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE(1,0,1,0) ) );
+      const __m256 s1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE(3,2,3,2) ) );
+      const __m256 s2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE(1,0,1,0) ) );
+      const __m256 s3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE(3,2,3,2) ) );
+      const __m256 s4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE(1,0,1,0) ) );
+      const __m256 s5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE(3,2,3,2) ) );
+      const __m256 s6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE(1,0,1,0) ) );
+      const __m256 s7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE(3,2,3,2) ) );
+
+      r[0] = _mm256_permute2f128_ps( s0, s4, 0x20 );
+      r[1] = _mm256_permute2f128_ps( s1, s5, 0x20 );
+      r[2] = _mm256_permute2f128_ps( s2, s6, 0x20 );
+      r[3] = _mm256_permute2f128_ps( s3, s7, 0x20 );
+      r[4] = _mm256_permute2f128_ps( s0, s4, 0x31 );
+      r[5] = _mm256_permute2f128_ps( s1, s5, 0x31 );
+      r[6] = _mm256_permute2f128_ps( s2, s6, 0x31 );
+      r[7] = _mm256_permute2f128_ps( s3, s7, 0x31 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void apply( float* dst, size_t ds, const float* src, size_t ss ) noexcept
+   {
+      __m256 r[8];
+      for( size_t k=0UL; k<8UL; ++k )
+         r[k] = _mm256_loadu_ps( src + k*ss );
+      transpose( r );
+      for( size_t k=0UL; k<8UL; ++k )
+         _mm256_storeu_ps( dst + k*ds, r[k] );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( float* a, float* b, size_t nn ) noexcept
+   {
+      __m256 ra[8], rb[8];
+      for( size_t k=0UL; k<8UL; ++k ) {
+         ra[k] = _mm256_loadu_ps( a + k*nn );
+         rb[k] = _mm256_loadu_ps( b + k*nn );
+      }
+      transpose( ra );
+      transpose( rb );
+      for( size_t k=0UL; k<8UL; ++k ) {
+         _mm256_storeu_ps( a + k*nn, rb[k] );
+         _mm256_storeu_ps( b + k*nn, ra[k] );
+      }
+   }
+};
+#elif BLAZE_SSE_MODE
+template<>
+struct TransposeKernel<float>
+{
+   static constexpr size_t size = 4UL;
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m128* r ) noexcept
+   {
+      _MM_TRANSPOSE4_PS( r[0], r[1], r[2], r[3] );
+   }
+
+   static BLAZE_ALWAYS_INLINE void apply( float* dst, size_t ds, const float* src, size_t ss ) noexcept
+   {
+      __m128 r[4];
+      for( size_t k=0UL; k<4UL; ++k )
+         r[k] = _mm_loadu_ps( src + k*ss );
+      transpose( r );
+      for( size_t k=0UL; k<4UL; ++k )
+         _mm_storeu_ps( dst + k*ds, r[k] );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( float* a, float* b, size_t nn ) noexcept
+   {
+      __m128 ra[4], rb[4];
+      for( size_t k=0UL; k<4UL; ++k ) {
+         ra[k] = _mm_loadu_ps( a + k*nn );
+         rb[k] = _mm_loadu_ps( b + k*nn );
+      }
+      transpose( ra );
+      transpose( rb );
+      for( size_t k=0UL; k<4UL; ++k ) {
+         _mm_storeu_ps( a + k*nn, rb[k] );
+         _mm_storeu_ps( b + k*nn, ra[k] );
+      }
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TransposeKernel class template for double precision values.
+// \ingroup dense_matrix
+*/
+#if BLAZE_AVX_MODE
+template<>
+struct TransposeKernel<double>
+{
+   static constexpr size_t size = 4UL;
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m256d* r ) noexcept
+   {
+      const __m256d t0( _mm256_unpacklo_pd( r[0], r[1] ) );
+      const __m256d t1( _mm256_unpackhi_pd( r[0], r[1] ) );
+      const __m256d t2( _mm256_unpacklo_pd( r[2], r[3] ) );
+      const __m256d t3( _mm256_unpackhi_pd( r[2], r[3] ) );
+
+      r[0] = _mm256_permute2f128_pd( t0, t2, 0x20 );
+      r[1] = _mm256_permute2f128_pd( t1, t3, 0x20 );
+      r[2] = _mm256_permute2f128_pd( t0, t2, 0x31 );
+      r[3] = _mm256_permute2f128_pd( t1, t3, 0x31 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void apply( double* dst, size_t ds, const double* src, size_t ss ) noexcept
+   {
+      __m256d r[4];
+      for( size_t k=0UL; k<4UL; ++k )
+         r[k] = _mm256_loadu_pd( src + k*ss );
+      transpose( r );
+      for( size_t k=0UL; k<4UL; ++k )
+         _mm256_storeu_pd( dst + k*ds, r[k] );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( double* a, double* b, size_t nn ) noexcept
+   {
+      __m256d ra[4], rb[4];
+      for( size_t k=0UL; k<4UL; ++k ) {
+         ra[k] = _mm256_loadu_pd( a + k*nn );
+         rb[k] = _mm256_loadu_pd( b + k*nn );
+      }
+      transpose( ra );
+      transpose( rb );
+      for( size_t k=0UL; k<4UL; ++k ) {
+         _mm256_storeu_pd( a + k*nn, rb[k] );
+         _mm256_storeu_pd( b + k*nn, ra[k] );
+      }
+   }
+};
+#elif BLAZE_SSE2_MODE
+template<>
+struct TransposeKernel<double>
+{
+   static constexpr size_t size = 2UL;
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m128d* r ) noexcept
+   {
+      const __m128d t0( _mm_unpacklo_pd( r[0], r[1] ) );
+      const __m128d t1( _mm_unpackhi_pd( r[0], r[1] ) );
+
+      r[0] = t0;
+      r[1] = t1;
+   }
+
+   static BLAZE_ALWAYS_INLINE void apply( double* dst, size_t ds, const double* src, size_t ss ) noexcept
+   {
+      __m128d r[2] = { _mm_loadu_pd( src ), _mm_loadu_pd( src + ss ) };
+      transpose( r );
+      _mm_storeu_pd( dst     , r[0] );
+      _mm_storeu_pd( dst + ds, r[1] );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( double* a, double* b, size_t nn ) noexcept
+   {
+      __m128d ra[2] = { _mm_loadu_pd( a ), _mm_loadu_pd( a + nn ) };
+      __m128d rb[2] = { _mm_loadu_pd( b ), _mm_loadu_pd( b + nn ) };
+      transpose( ra );
+      transpose( rb );
+      _mm_storeu_pd( a     , rb[0] );
+      _mm_storeu_pd( a + nn, rb[1] );
+      _mm_storeu_pd( b     , ra[0] );
+      _mm_storeu_pd( b + nn, ra[1] );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE MATRIX TRANSPOSE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Out-of-place transpose kernel for dense matrices (\f$ B=A^T \f$).
+// \ingroup dense_matrix
+//
+// \param dst Pointer to the first element of the target matrix \f$ B \f$.
+// \param ds The spacing between two rows of the target matrix.
+// \param src Pointer to the first element of the source matrix \f$ A \f$.
+// \param ss The spacing between two rows of the source matrix.
+// \param m The number of rows of the source matrix.
+// \param n The number of columns of the source matrix.
+// \return void
+//
+// This function writes the transpose of the \f$ m \times n \f$ source matrix to the
+// \f$ n \times m \f$ target matrix, i.e. \c dst[j*ds+i] is set to \c src[i*ss+j]. Both matrices
+// are described in terms of row-major storage; for a column-major matrix the spacing between
+// two columns is passed instead and the roles of rows and columns are exchanged. The matrices
+// are traversed in tiles of TRANSPOSE_BLOCK_SIZE elements, which reside in the L1 cache, and
+// each tile is transposed by means of the SIMD micro kernel of the TransposeKernel class. The
+// source and the target matrix must not overlap.
+*/
+template< typename T >  // Type of the elements
+void dmattrans( T* dst, size_t ds, const T* src, size_t ss, size_t m, size_t n )
+{
+   using Kernel = TransposeKernel<T>;
+
+   constexpr size_t KS   ( Kernel::size );
+   constexpr size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   const size_t mpos( m - m % KS );
+   const size_t npos( n - n % KS );
+
+   for( size_t ii=0UL; ii<mpos; ii+=block ) {
+      const size_t iend( min( ii+block, mpos ) );
+      for( size_t jj=0UL; jj<npos; jj+=block ) {
+         const size_t jend( min( jj+block, npos ) );
+         for( size_t i=ii; i<iend; i+=KS ) {
+            for( size_t j=jj; j<jend; j+=KS ) {
+               Kernel::apply( dst+j*ds+i, ds, src+i*ss+j, ss );
+            }
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<mpos; ++i ) {
+      for( size_t j=npos; j<n; ++j ) {
+         dst[j*ds+i] = src[i*ss+j];
+      }
+   }
+
+   for( size_t i=mpos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         dst[j*ds+i] = src[i*ss+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transpose kernel for square dense matrices (\f$ A=A^T \f$).
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first element of the square matrix.
+// \param nn The spacing between two rows (or columns) of the matrix.
+// \param n The number of rows and columns of the matrix.
+// \return void
+//
+// This function transposes the given \f$ n \times n \f$ matrix in-place. Pairs of tiles of
+// TRANSPOSE_BLOCK_SIZE elements, which are located symmetrically to the diagonal, are processed
+// together, where each pair of mirrored blocks is exchanged and transposed in SIMD registers
+// by means of the micro kernel of the TransposeKernel class.
+*/
+template< typename T >  // Type of the elements
+void dmattrans( T* A, size_t nn, size_t n )
+{
+   using std::swap;
+
+   using Kernel = TransposeKernel<T>;
+
+   constexpr size_t KS   ( Kernel::size );
+   constexpr size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   const size_t npos( n - n % KS );
+
+   for( size_t ii=0UL; ii<npos; ii+=block ) {
+      const size_t iend( min( ii+block, npos ) );
+      for( size_t jj=0UL; jj<=ii; jj+=block ) {
+         const size_t jend( min( jj+block, npos ) );
+         for( size_t i=ii; i<iend; i+=KS ) {
+            const size_t jpos( min( jend, i+1UL ) );
+            for( size_t j=jj; j<jpos; j+=KS ) {
+               Kernel::swap( A+i*nn+j, A+j*nn+i, nn );
+            }
+         }
+      }
+   }
+
+   for( size_t i=npos; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         swap( A[i*nn+j], A[j*nn+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
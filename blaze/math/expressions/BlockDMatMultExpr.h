@@ -0,0 +1,548 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/BlockDMatMultExpr.h
+//  \brief Header file for the block-sparse matrix/dense matrix multiplication expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_BLOCKDMATMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_BLOCKDMATMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/BlockCompressedMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BLOCKDMATMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for block-sparse matrix-dense matrix multiplications.
+// \ingroup dense_matrix_expression
+//
+// The BlockDMatMultExpr class represents the compile time expression for multiplications between
+// block-sparse matrices and dense matrices. The expression is always evaluated by means of the
+// multiply() kernel of the BlockCompressedMatrix class template, which is parallelized internally.
+*/
+template< typename MT1    // Type of the left-hand side block-sparse matrix
+        , typename MT2 >  // Type of the right-hand side dense matrix
+class BlockDMatMultExpr
+   : public MatMatMultExpr< DenseMatrix< BlockDMatMultExpr<MT1,MT2>, false > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT2 = ResultType_t<MT2>;     //!< Result type of the right-hand side dense matrix expression.
+   using CT2 = CompositeType_t<MT2>;  //!< Composite type of the right-hand side dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense matrix expression.
+   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this BlockDMatMultExpr instance.
+   using This = BlockDMatMultExpr<MT1,MT2>;
+
+   //! Resulting element type.
+   using ElementType = MultTrait_t< ElementType_t<MT1>, ElementType_t<MT2> >;
+
+   //! Result type for expression template evaluations.
+   using ResultType = DynamicMatrix<ElementType,false>;
+
+   using OppositeType  = OppositeType_t<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side block-sparse matrix operand.
+   using LeftOperand = const MT1&;
+
+   //! Composite type of the right-hand side dense matrix operand.
+   using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the right-hand side dense matrix operand.
+   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BlockDMatMultExpr class.
+   //
+   // \param lhs The left-hand side block-sparse matrix operand of the multiplication expression.
+   // \param rhs The right-hand side dense matrix operand of the multiplication expression.
+   */
+   explicit inline BlockDMatMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side block-sparse matrix of the multiplication expression
+      , rhs_( rhs )  // Right-hand side dense matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < rhs_.columns(), "Invalid column access index" );
+      return lhs_.multiply( i, j, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= rhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side block-sparse matrix operand.
+   //
+   // \return The left-hand side block-sparse matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense matrix operand.
+   //
+   // \return The right-hand side dense matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return rhs_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a false, since the expression is parallelized internally.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side block-sparse matrix of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block-sparse matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block-sparse matrix-dense
+   // matrix multiplication expression to a dense matrix by means of the multiply() kernel of the
+   // block-sparse matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO>& lhs, const BlockDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      rhs.lhs_.multiply( ~lhs, B, []( auto& a, const auto& b ){ a = b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block-sparse matrix-dense matrix multiplication to a sparse matrix
+   //        (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block-sparse matrix-dense
+   // matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO>& lhs, const BlockDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO, OppositeType, ResultType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block-sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a block-sparse
+   // matrix-dense matrix multiplication expression to a dense matrix by means of the multiply()
+   // kernel of the block-sparse matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO>& lhs, const BlockDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      rhs.lhs_.multiply( ~lhs, B, []( auto& a, const auto& b ){ a += b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block-sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a block-sparse
+   // matrix-dense matrix multiplication expression to a dense matrix by means of the multiply()
+   // kernel of the block-sparse matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO>& lhs, const BlockDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      rhs.lhs_.multiply( ~lhs, B, []( auto& a, const auto& b ){ a -= b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a block-sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ A\circ=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a
+   // block-sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT,SO>& lhs, const BlockDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   // No special implementation for the SMP assignment to dense matrices. The multiplication is
+   // parallelized internally by the multiply() kernel of the block-sparse matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a block-sparse matrix and a dense
+//        matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side block-sparse matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication between a block-sparse matrix and a dense matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedMatrix<double,rowMajor> A;
+   blaze::DynamicMatrix<double,rowMajor> X, Y;
+   // ... Resizing and initialization
+   const blaze::BlockCompressedMatrix<double,3UL> S( A );
+   Y = S * X;
+   \endcode
+
+// The operator returns an expression representing a row-major dense matrix of the higher-order
+// element type of the two involved element types \a Type and \a MT::ElementType. In case the
+// current number of columns of \a lhs and the current number of rows of \a rhs don't match, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename Type  // Data type of the left-hand side block-sparse matrix
+        , size_t B       // Block size of the left-hand side block-sparse matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const BlockCompressedMatrix<Type,B>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const BlockDMatMultExpr< BlockCompressedMatrix<Type,B>, MT >;
+   return ReturnType( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2 >
+struct IsAligned< BlockDMatMultExpr<MT1,MT2> >
+   : public IsAligned<MT2>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -52,11 +52,13 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatAddExpr.h>
+#include <blaze/math/functors/Noop.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsEpilogueFusable.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -145,6 +147,35 @@ class DMatDMatAddExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Epilogue evaluation strategy****************************************************************
+   //! Compilation switch for the fusion of the addition into the evaluation of an operand.
+   /*! The \a useEpilogue compile time constant expression represents a compilation switch for
+       the fusion of the addition into the evaluation of one of the two operands. In case one of
+       the two operands supports epilogue operations (see the IsEpilogueFusable type trait) and
+       the other operand does not require an intermediate evaluation, \a useEpilogue will be
+       set to 1 and the other operand is added element-wise during the write-back of the first
+       operand. Otherwise \a useEpilogue will be set to 0. */
+   static constexpr bool useEpilogue =
+      ( ( IsEpilogueFusable_v<MT1> && !RequiresEvaluation_v<MT2> ) ||
+        ( IsEpilogueFusable_v<MT2> && !RequiresEvaluation_v<MT1> ) );
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseEpilogueAssign_v = useEpilogue;
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseLeftEpilogue_v =
+      ( IsEpilogueFusable_v<MT1> && !RequiresEvaluation_v<MT2> );
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseRightEpilogue_v =
+      ( !UseLeftEpilogue_v<MT> && IsEpilogueFusable_v<MT2> && !RequiresEvaluation_v<MT1> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -638,7 +669,7 @@ class DMatDMatAddExpr
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO2 >   // Storage order of the target dense matrix
-   friend inline EnableIf_t< UseAssign_v<MT> >
+   friend inline EnableIf_t< UseAssign_v<MT> && !UseEpilogueAssign_v<MT> >
       assign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -664,6 +695,199 @@ class DMatDMatAddExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix addition to a dense matrix by means of an
+   //        epilogue operation.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix addition expression
+   // to a dense matrix, where one of the two operands supports epilogue operations (see the
+   // IsEpilogueFusable type trait). The other operand is passed as bias to this operand and is
+   // added during its write-back, which avoids a separate pass over the target matrix. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case one of the two operands supports epilogue operations and the other
+   // operand does not require an intermediate evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseEpilogueAssign_v<MT> >
+      assign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !IsOperation_v<MT1> && isSame( ~lhs, rhs.lhs_ ) ) {
+         addAssign( ~lhs, rhs.rhs_ );
+      }
+      else if( !IsOperation_v<MT2> && isSame( ~lhs, rhs.rhs_ ) ) {
+         addAssign( ~lhs, rhs.lhs_ );
+      }
+      else {
+         epilogueAssign( ~lhs, rhs, Noop(), Noop() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix addition with epilogue operation to a
+   //        dense matrix (\f$ C=op(A+B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix addition with
+   // epilogue operation to a dense matrix in case the left-hand side operand supports
+   // epilogue operations. The right-hand side operand is passed as bias to the
+   // left-hand side operand.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO2       // Storage order of the target dense matrix
+           , typename EP >  // Type of the epilogue operation
+   friend inline EnableIf_t< UseLeftEpilogue_v<MT> >
+      epilogueAssign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs,
+                      const Noop&, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const RightOperand& B( rhs.rhs_ );
+
+      epilogueAssign( ~lhs, rhs.lhs_, [&B]( size_t i, size_t j ) {
+         return B(i,j);
+      }, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix addition with bias and epilogue
+   //        operation to a dense matrix (\f$ C=op(A+B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix addition with bias
+   // and epilogue operation to a dense matrix in case the left-hand side operand supports
+   // epilogue operations. The right-hand side operand is added to the bias of the
+   // left-hand side operand.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO2       // Storage order of the target dense matrix
+           , typename BI    // Type of the bias operation
+           , typename EP >  // Type of the epilogue operation
+   friend inline EnableIf_t< UseLeftEpilogue_v<MT> >
+      epilogueAssign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs,
+                      const BI& bias, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const RightOperand& B( rhs.rhs_ );
+
+      epilogueAssign( ~lhs, rhs.lhs_, [&B,&bias]( size_t i, size_t j ) {
+         return bias( i, j ) + B(i,j);
+      }, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix addition with epilogue operation to a
+   //        dense matrix (\f$ C=op(A+B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix addition with
+   // epilogue operation to a dense matrix in case the right-hand side operand supports
+   // epilogue operations. The left-hand side operand is passed as bias to the
+   // right-hand side operand.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO2       // Storage order of the target dense matrix
+           , typename EP >  // Type of the epilogue operation
+   friend inline EnableIf_t< UseRightEpilogue_v<MT> >
+      epilogueAssign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs,
+                      const Noop&, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const LeftOperand& A( rhs.lhs_ );
+
+      epilogueAssign( ~lhs, rhs.rhs_, [&A]( size_t i, size_t j ) {
+         return A(i,j);
+      }, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix addition with bias and epilogue
+   //        operation to a dense matrix (\f$ C=op(A+B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix addition with bias
+   // and epilogue operation to a dense matrix in case the right-hand side operand supports
+   // epilogue operations. The left-hand side operand is added to the bias of the
+   // right-hand side operand.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO2       // Storage order of the target dense matrix
+           , typename BI    // Type of the bias operation
+           , typename EP >  // Type of the epilogue operation
+   friend inline EnableIf_t< UseRightEpilogue_v<MT> >
+      epilogueAssign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs,
+                      const BI& bias, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const LeftOperand& A( rhs.lhs_ );
+
+      epilogueAssign( ~lhs, rhs.rhs_, [&A,&bias]( size_t i, size_t j ) {
+         return bias( i, j ) + A(i,j);
+      }, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense matrix addition to a sparse matrix.
@@ -1103,6 +1327,25 @@ inline decltype(auto)
 
 
 
+//=================================================================================================
+//
+//  ISEPILOGUEFUSABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsEpilogueFusable< DMatDMatAddExpr<MT1,MT2,SO> >
+   : public BoolConstant< ( IsEpilogueFusable_v<MT1> && !RequiresEvaluation_v<MT2> ) ||
+                          ( IsEpilogueFusable_v<MT2> && !RequiresEvaluation_v<MT1> ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISALIGNED SPECIALIZATIONS
@@ -51,6 +51,8 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/NarrowMMM.h>
+#include <blaze/math/dense/Strassen.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -85,10 +87,12 @@
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsEpilogueFusable.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
@@ -228,6 +232,25 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the types of all three involved matrices are suited for the Strassen-Winograd
+       algorithm, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseStrassenKernel_v =
+      ( useStrassen &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        !IsTriangular_v<T2> && !IsTriangular_v<T3> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -246,6 +269,32 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the vectorized kernel for narrow right-hand side matrices can be applied to a
+       row-major target matrix, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseNarrowKernel_v =
+      ( UseVectorizedDefaultKernel_v<T1,T2,T3> &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsRowMajorMatrix_v<T1> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case an epilogue operation can be fused into the vectorized default kernel for large
+       matrices, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseEpilogueKernel_v =
+      ( UseVectorizedDefaultKernel_v<T1,T2,T3> &&
+        !UseBlasKernel_v<T1,T2,T3> &&
+        !SYM && !HERM && !LOW && !UPP );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -559,7 +608,12 @@ class DMatDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowAssignKernel( C, A, B );
+      else if( UseStrassenKernel_v<MT3,MT4,MT5> &&
+               min( C.rows(), C.columns(), A.columns() ) >= STRASSEN_THRESHOLD )
+         selectStrassenAssignKernel( C, A, B );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B );
@@ -569,6 +623,56 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized assignment to row-major dense matrices (narrow matrices)************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      nmmm( C, A, B, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense matrices (narrow matrices)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSmallAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general dense matrix-general dense matrix multiplication
@@ -1629,6 +1733,56 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Strassen-Winograd assignment to dense matrices (default)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the BLAS-based or default implementation of the assignment of a
+   // large dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_t< UseStrassenKernel_v<MT3,MT4,MT5> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectBlasAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Strassen-Winograd assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Strassen-Winograd-based assignment of a large dense matrix-dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense matrix multiplication by means of the recursive
+   // Strassen-Winograd algorithm. Only available in case the BLAZE_USE_STRASSEN switch is set.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseStrassenKernel_v<MT3,MT4,MT5> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      strassen( C, A, B, ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
@@ -1691,6 +1845,136 @@ class DMatDMatMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix multiplication with bias and epilogue
+   //        operation to a dense matrix (\f$ C=op(A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-dense matrix multiplication
+   // expression to a dense matrix, where the bias \c bias(i,j) is added to each element of the
+   // result and the sum is passed through the epilogue operation \c epilogue(i,j,value). The
+   // bias of an element is evaluated before the element is written for the first time and may
+   // therefore refer to the same element of the target matrix. For large matrices both
+   // operations are fused into the write-back of the multiplication kernel, such that no
+   // additional pass over the target matrix is required. Passing a \a Noop functor as bias or
+   // epilogue operation disables the according operation.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename BI    // Type of the bias operation
+           , typename EP >  // Type of the epilogue operation
+   friend inline void
+      epilogueAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs,
+                      const BI& bias, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( CanExploitSymmetry_v<MT,MT1,MT2> || rhs.lhs_.columns() == 0UL ) {
+         mmmInit( ~lhs, ElementType(0), bias );
+         addAssign( ~lhs, rhs );
+         mmmEpilogue( ~lhs, epilogue );
+         return;
+      }
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      DMatDMatMultExpr::selectEpilogueAssignKernel( ~lhs, A, B, bias, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default epilogue assignment to dense matrices***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-dense matrix multiplication with bias and
+   //        epilogue operation (\f$ C=op(A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function initializes the target matrix with the bias, relays to the default addition
+   // assignment of the multiplication, and applies the epilogue operation in a separate pass
+   // over the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename BI     // Type of the bias operation
+           , typename EP >   // Type of the epilogue operation
+   static inline DisableIf_t< UseEpilogueKernel_v<MT3,MT4,MT5> >
+      selectEpilogueAssignKernel( MT3& C, const MT4& A, const MT5& B, const BI& bias, const EP& epilogue )
+   {
+      mmmInit( C, ElementType(0), bias );
+      selectAddAssignKernel( C, A, B );
+      mmmEpilogue( C, epilogue );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized epilogue assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a dense matrix-dense matrix multiplication with bias and
+   //        epilogue operation (\f$ C=op(A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function selects the same kernel as the assignment of the multiplication. In case
+   // the kernel for large matrices is selected, the bias and the epilogue operation are fused
+   // into its write-back. Otherwise they are applied in separate passes over the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename BI     // Type of the bias operation
+           , typename EP >   // Type of the epilogue operation
+   static inline EnableIf_t< UseEpilogueKernel_v<MT3,MT4,MT5> >
+      selectEpilogueAssignKernel( MT3& C, const MT4& A, const MT5& B, const BI& bias, const EP& epilogue )
+   {
+      if( ( UseNarrowKernel_v<MT3,MT4,MT5> && B.columns() <= NARROW_MMM_THRESHOLD ) ||
+          ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         mmmInit( C, ElementType(0), bias );
+         selectAddAssignKernel( C, A, B );
+         mmmEpilogue( C, epilogue );
+      }
+      else {
+         mmm( C, A, B, ElementType(1), ElementType(0), bias, epilogue );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense matrix multiplication to a sparse matrix
@@ -1827,7 +2111,9 @@ class DMatDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowAddAssignKernel( C, A, B );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B );
@@ -1837,6 +2123,56 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized addition assignment to row-major dense matrices (narrow matrices)***************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      nmmm( C, A, B, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense matrices (narrow matrices)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSmallAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices (general/general)*****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a general dense matrix-general dense matrix
@@ -3043,7 +3379,9 @@ class DMatDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowSubAssignKernel( C, A, B );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B );
@@ -3053,6 +3391,56 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized subtraction assignment to row-major dense matrices (narrow matrices)************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      nmmm( C, A, B, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense matrices (narrow matrices)*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-narrow dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5> >
+      selectNarrowSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSmallSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices (general/general)**************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a general dense matrix-general dense matrix
@@ -4704,6 +5092,23 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
         !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the types of all three involved matrices are suited for the Strassen-Winograd
+       algorithm, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseStrassenKernel_v =
+      ( useStrassen &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        !IsTriangular_v<T2> && !IsTriangular_v<T3> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! In case all four involved data types are suited for a vectorized computation of the
@@ -4721,6 +5126,28 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
         HasSIMDMult_v< ElementType_t<T2>, ElementType_t<T3> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the vectorized kernel for narrow right-hand side matrices can be applied to a
+       row-major target matrix, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseNarrowKernel_v =
+      ( UseVectorizedDefaultKernel_v<T1,T2,T3,T4> &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsRowMajorMatrix_v<T1> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case an epilogue operation can be fused into the vectorized default kernel for large
+       matrices, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseEpilogueKernel_v =
+      ( UseVectorizedDefaultKernel_v<T1,T2,T3,T4> &&
+        !UseBlasKernel_v<T1,T2,T3,T4> &&
+        !SYM && !HERM && !LOW && !UPP );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Type of the functor for forwarding an expression to another assign kernel.
    /*! In case a temporary matrix needs to be created, this functor is used to forward the
@@ -4998,7 +5425,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5,ST2> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowAssignKernel( C, A, B, scalar );
+      else if( UseStrassenKernel_v<MT3,MT4,MT5,ST2> &&
+               min( C.rows(), C.columns(), A.columns() ) >= STRASSEN_THRESHOLD )
+         selectStrassenAssignKernel( C, A, B, scalar );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B, scalar );
@@ -5007,6 +5439,56 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Vectorized assignment to row-major dense matrices (narrow matrices)************************
+   /*!\brief Vectorized assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      nmmm( C, A, B, ElementType( scalar ), ElementType(0) );
+   }
+   //**********************************************************************************************
+
+   //**Default assignment to dense matrices (narrow matrices)*************************************
+   /*!\brief Default assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectSmallAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*!\brief Default assignment of a scaled general dense matrix-general dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
@@ -6088,6 +6570,57 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Strassen-Winograd assignment to dense matrices (default)************************************
+   /*!\brief Default assignment of a large scaled dense matrix-dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the BLAS-based or default implementation of the assignment of a
+   // large scaled dense matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_t< UseStrassenKernel_v<MT3,MT4,MT5,ST2> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectBlasAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Strassen-Winograd assignment to dense matrices**********************************************
+   /*!\brief Strassen-Winograd-based assignment of a large scaled dense matrix-dense matrix
+   //        multiplication (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense matrix multiplication by means of the
+   // recursive Strassen-Winograd algorithm. Only available in case the BLAZE_USE_STRASSEN switch
+   // is set.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_t< UseStrassenKernel_v<MT3,MT4,MT5,ST2> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      strassen( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*!\brief Default assignment of a scaled dense matrix-dense matrix multiplication
    //        (\f$ C=s*A*B \f$).
@@ -6152,6 +6685,139 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*!\brief Assignment of a scaled dense matrix-dense matrix multiplication with bias and
+   //        epilogue operation to a dense matrix (\f$ C=op(s*A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the assignment of a scaled dense matrix-dense matrix
+   // multiplication expression to a dense matrix, where the bias \c bias(i,j) is added to each
+   // element of the result and the sum is passed through the epilogue operation
+   // \c epilogue(i,j,value). The bias of an element is evaluated before the element is written
+   // for the first time and may therefore refer to the same element of the target matrix. For
+   // large matrices both operations are fused into the write-back of the multiplication kernel,
+   // such that no additional pass over the target matrix is required.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename BI    // Type of the bias operation
+           , typename EP >  // Type of the epilogue operation
+   friend inline void
+      epilogueAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs,
+                      const BI& bias, const EP& epilogue )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( CanExploitSymmetry_v<MT,MT1,MT2> || left.columns() == 0UL ) {
+         mmmInit( ~lhs, ElementType(0), bias );
+         addAssign( ~lhs, rhs );
+         mmmEpilogue( ~lhs, epilogue );
+         return;
+      }
+
+      LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
+      RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == left.columns()  , "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == right.rows()    , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == right.columns() , "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      DMatScalarMultExpr::selectEpilogueAssignKernel( ~lhs, A, B, rhs.scalar_, bias, epilogue );
+   }
+   //**********************************************************************************************
+
+   //**Default epilogue assignment to dense matrices***********************************************
+   /*!\brief Default assignment of a scaled dense matrix-dense matrix multiplication with bias
+   //        and epilogue operation (\f$ C=op(s*A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function initializes the target matrix with the bias, relays to the default addition
+   // assignment of the scaled multiplication, and applies the epilogue operation in a separate
+   // pass over the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2    // Type of the scalar value
+           , typename BI     // Type of the bias operation
+           , typename EP >   // Type of the epilogue operation
+   static inline DisableIf_t< UseEpilogueKernel_v<MT3,MT4,MT5,ST2> >
+      selectEpilogueAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar,
+                                  const BI& bias, const EP& epilogue )
+   {
+      mmmInit( C, ST2(0), bias );
+      selectAddAssignKernel( C, A, B, scalar );
+      mmmEpilogue( C, epilogue );
+   }
+   //**********************************************************************************************
+
+   //**Vectorized epilogue assignment to dense matrices********************************************
+   /*!\brief Vectorized assignment of a scaled dense matrix-dense matrix multiplication with
+   //        bias and epilogue operation (\f$ C=op(s*A*B+bias) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \param bias The bias operation to be added to each element of the result.
+   // \param epilogue The epilogue operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function selects the same kernel as the assignment of the scaled multiplication. In
+   // case the kernel for large matrices is selected, the bias and the epilogue operation are
+   // fused into its write-back. Otherwise they are applied in separate passes over the target
+   // matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2    // Type of the scalar value
+           , typename BI     // Type of the bias operation
+           , typename EP >   // Type of the epilogue operation
+   static inline EnableIf_t< UseEpilogueKernel_v<MT3,MT4,MT5,ST2> >
+      selectEpilogueAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar,
+                                  const BI& bias, const EP& epilogue )
+   {
+      if( ( UseNarrowKernel_v<MT3,MT4,MT5,ST2> && B.columns() <= NARROW_MMM_THRESHOLD ) ||
+          ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         mmmInit( C, ST2(0), bias );
+         selectAddAssignKernel( C, A, B, scalar );
+         mmmEpilogue( C, epilogue );
+      }
+      else {
+         mmm( C, A, B, scalar, ST2(0), bias, epilogue );
+      }
+   }
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*!\brief Assignment of a scaled dense matrix-dense matrix multiplication to a sparse matrix
    //        (\f$ C=s*A*B \f$).
@@ -6289,7 +6955,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5,ST2> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowAddAssignKernel( C, A, B, scalar );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( C, A, B, scalar );
@@ -6298,6 +6966,56 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Vectorized addition assignment to row-major dense matrices (narrow matrices)***************
+   /*!\brief Vectorized addition assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      nmmm( C, A, B, ElementType( scalar ), ElementType(1) );
+   }
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense matrices (narrow matrices)****************************
+   /*!\brief Default addition assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectSmallAddAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices (general/general)*****************************
    /*!\brief Default addition assignment of a scaled general dense matrix-general dense matrix
    //        multiplication (\f$ C+=s*A*B \f$).
@@ -7402,7 +8120,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
+      if( UseNarrowKernel_v<MT3,MT4,MT5,ST2> && B.columns() <= NARROW_MMM_THRESHOLD )
+         selectNarrowSubAssignKernel( C, A, B, scalar );
+      else if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( C, A, B, scalar );
@@ -7411,6 +8131,56 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Vectorized subtraction assignment to row-major dense matrices (narrow matrices)************
+   /*!\brief Vectorized subtraction assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for the multiplication with narrow right-hand side
+   // matrices, which traverses the left-hand side dense matrix only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      nmmm( C, A, B, -ElementType( scalar ), ElementType(1) );
+   }
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense matrices (narrow matrices)*************************
+   /*!\brief Default subtraction assignment of a scaled dense matrix-narrow dense matrix multiplication
+   //        (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the kernel for small matrices in case the kernel for narrow
+   // matrices cannot be applied.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_t< UseNarrowKernel_v<MT3,MT4,MT5,ST2> >
+      selectNarrowSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectSmallSubAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices (general/general)**************************
    /*!\brief Default subtraction assignment of a scaled general dense matrix-general dense matrix
    //        multiplication (\f$ C-=s*A*B \f$).
@@ -9166,6 +9936,34 @@ struct Size< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, 1UL >
 
 
 
+//=================================================================================================
+//
+//  ISEPILOGUEFUSABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SF, bool HF, bool LF, bool UF >
+struct IsEpilogueFusable< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SF, bool HF, bool LF, bool UF, typename ST >
+struct IsEpilogueFusable< DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false > >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISALIGNED SPECIALIZATIONS
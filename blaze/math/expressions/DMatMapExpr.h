@@ -51,12 +51,14 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMapExpr.h>
+#include <blaze/math/functors/Noop.h>
 #include <blaze/math/Functors.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MapTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsEpilogueFusable.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -141,6 +143,10 @@ class DMatMapExpr
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT2 >
    static constexpr bool UseAssign_v = useAssign;
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool UseEpilogueAssign_v = IsEpilogueFusable_v<MT>;
    /*! \endcond */
    //**********************************************************************************************
 
@@ -638,8 +644,8 @@ class DMatMapExpr
    */
    template< typename MT2  // Type of the target dense matrix
            , bool SO2 >    // Storage order or the target dense matrix
-   friend inline EnableIf_t< UseAssign_v<MT2> && IsSame_v< UnderlyingNumeric_t<MT>
-                           , UnderlyingNumeric_t<MT2> > >
+   friend inline EnableIf_t< UseAssign_v<MT2> && !UseEpilogueAssign_v<MT2> &&
+                             IsSame_v< UnderlyingNumeric_t<MT>, UnderlyingNumeric_t<MT2> > >
       assign( DenseMatrix<MT2,SO2>& lhs, const DMatMapExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -653,6 +659,44 @@ class DMatMapExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Epilogue assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix map expression to a dense matrix by means of an
+   //        epilogue operation.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix map expression to a dense
+   // matrix in case the operand supports epilogue operations (see the IsEpilogueFusable type
+   // trait). The custom operation is applied during the write-back of the operand, which
+   // avoids a separate pass over the target matrix. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the operand
+   // supports epilogue operations and the underlying numeric data type of the operand and
+   // the target matrix are identical.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order or the target dense matrix
+   friend inline EnableIf_t< UseAssign_v<MT2> && UseEpilogueAssign_v<MT2> &&
+                             IsSame_v< UnderlyingNumeric_t<MT>, UnderlyingNumeric_t<MT2> > >
+      assign( DenseMatrix<MT2,SO2>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const OP& op( rhs.op_ );
+
+      epilogueAssign( ~lhs, rhs.dm_, Noop(), [&op]( size_t, size_t, const auto& value ) {
+         return op( value );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix map expression to a dense matrix.
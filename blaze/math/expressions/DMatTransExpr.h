@@ -57,6 +57,7 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -882,6 +883,24 @@ struct IsAligned< DMatTransExpr<MT,SO> >
 
 
 
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct IsContiguous< DMatTransExpr<MT,SO> >
+   : public IsContiguous<MT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISPADDED SPECIALIZATIONS
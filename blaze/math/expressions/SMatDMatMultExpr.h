@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -48,27 +49,35 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/NarrowMMM.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
 #include <blaze/math/traits/DeclSymTrait.h>
 #include <blaze/math/traits/DeclUppTrait.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasRowOffsets.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -80,6 +89,7 @@
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -167,6 +177,23 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the nonzero-balanced parallel
+       evaluation strategy. In case none of the two matrix operands requires an intermediate
+       evaluation, the sparse matrix operand provides the offsets of its rows (see the
+       HasRowOffsets type trait), the target matrix is SMP assignable, and no symmetry or
+       triangular structure can be exploited, the variable will be set to 1, otherwise it will
+       be 0. */
+   template< typename T1 >
+   static constexpr bool UseBalancedAssign_v =
+      ( !evaluateLeft && !evaluateRight &&
+        HasRowOffsets_v<MT1> && IsSMPAssignable_v<T1> &&
+        !SYM && !HERM && !LOW && !UPP );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -728,7 +755,9 @@ class SMatDMatMultExpr
    // \return void
    //
    // This function implements the vectorized assignment kernel for the sparse matrix-dense matrix
-   // multiplication.
+   // multiplication. In case the right-hand side
+   // dense matrix is narrow, the kernel for narrow matrices is used, which computes each row
+   // of the result in registers and traverses the sparse matrix only once.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -738,6 +767,11 @@ class SMatDMatMultExpr
    {
       using ConstIterator = ConstIterator_t<MT4>;
 
+      if( !SYM && !HERM && !LOW && !UPP && B.columns() <= NARROW_MMM_THRESHOLD ) {
+         nmmm( C, A, B, ElementType(1), ElementType(0) );
+         return;
+      }
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       reset( C );
@@ -1136,7 +1170,9 @@ class SMatDMatMultExpr
    // \return void
    //
    // This function implements the vectorized addition assignment kernel for the sparse matrix-
-   // dense matrix multiplication.
+   // dense matrix multiplication. In case the right-hand side
+   // dense matrix is narrow, the kernel for narrow matrices is used, which computes each row
+   // of the result in registers and traverses the sparse matrix only once.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1146,6 +1182,11 @@ class SMatDMatMultExpr
    {
       using ConstIterator = ConstIterator_t<MT4>;
 
+      if( !SYM && !HERM && !LOW && !UPP && B.columns() <= NARROW_MMM_THRESHOLD ) {
+         nmmm( C, A, B, ElementType(1), ElementType(1) );
+         return;
+      }
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       for( size_t i=0UL; i<A.rows(); ++i )
@@ -1499,7 +1540,9 @@ class SMatDMatMultExpr
    // \return void
    //
    // This function implements the vectorized subtraction assignment kernel for the sparse matrix-
-   // dense matrix multiplication.
+   // dense matrix multiplication. In case the right-hand side
+   // dense matrix is narrow, the kernel for narrow matrices is used, which computes each row
+   // of the result in registers and traverses the sparse matrix only once.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1509,6 +1552,11 @@ class SMatDMatMultExpr
    {
       using ConstIterator = ConstIterator_t<MT4>;
 
+      if( !SYM && !HERM && !LOW && !UPP && B.columns() <= NARROW_MMM_THRESHOLD ) {
+         nmmm( C, A, B, ElementType(-1), ElementType(1) );
+         return;
+      }
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       for( size_t i=0UL; i<A.rows(); ++i )
@@ -1651,6 +1699,62 @@ class SMatDMatMultExpr
    // No special implementation for the multiplication assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**SMP balanced assignment*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP assignment of a sparse matrix-dense matrix multiplication to a
+   //        dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param op The assignment operation (Assign, AddAssign, or SubAssign).
+   // \return void
+   //
+   // This function splits the rows of the sparse matrix into contiguous ranges of approximately
+   // equal work, based on the offsets of its rows, and assigns the product of each range of rows
+   // with the dense matrix to the according rows of the target matrix in parallel. In contrast
+   // to the default parallelization, which splits the target matrix into equally sized blocks,
+   // matrices with very irregular row lengths don't leave most threads idle. Since the work for
+   // each row is proportional to the number of its non-zero elements plus one (for the update of
+   // the according row of the target matrix), the ranges are chosen based on this measure.
+   */
+   template< typename MT3   // Type of the left-hand side target matrix
+           , typename MT4   // Type of the left-hand side matrix operand
+           , typename MT5   // Type of the right-hand side matrix operand
+           , typename OP >  // Type of the assignment operation
+   static inline void smpBalancedAssign( MT3& C, const MT4& A, const MT5& B, OP op )
+   {
+      const size_t m( A.rows() );
+      const size_t n( B.columns() );
+      const size_t K( A.columns() );
+
+      const size_t* offsets( A.rowOffsets() );
+      const size_t  W( offsets[m] + m );
+      const size_t  T( min( getNumThreads(), max( 1UL, m ) ) );
+
+      // Computing the first row of each range
+      std::vector<size_t> first( T+1UL );
+      for( size_t t=1UL, i=0UL; t<T; ++t ) {
+         while( i < m && offsets[i] + i < t*W/T ) ++i;
+         first[t] = i;
+      }
+      first[T] = m;
+
+      smpFor( T, [&]( size_t t )
+      {
+         const size_t begin( first[t] );
+         const size_t end  ( first[t+1UL] );
+
+         if( begin == end ) return;
+
+         auto target( submatrix( C, begin, 0UL, end-begin, n, unchecked ) );
+         op( target, submatrix( A, begin, 0UL, end-begin, K, unchecked ) * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense matrices************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a dense matrix
@@ -1691,6 +1795,52 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP assignment of a sparse
+   // matrix-dense matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the sparse matrix operand provides the offsets of its rows, none of the two matrix
+   // operands requires an intermediate evaluation, and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBalancedAssign_v<MT> >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpBalancedAssign( ~lhs, A, B, Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1774,6 +1924,52 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP addition assignment of a sparse
+   // matrix-dense matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the sparse matrix operand provides the offsets of its rows, none of the two matrix
+   // operands requires an intermediate evaluation, and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBalancedAssign_v<MT> >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpBalancedAssign( ~lhs, A, B, AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1819,6 +2015,52 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP subtraction assignment of a sparse
+   // matrix-dense matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the sparse matrix operand provides the offsets of its rows, none of the two matrix
+   // operands requires an intermediate evaluation, and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBalancedAssign_v<MT> >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( isSerialSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpBalancedAssign( ~lhs, A, B, SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnVector.h>
 #include <blaze/math/constraints/DenseVector.h>
@@ -53,15 +55,26 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasRowOffsets.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -132,11 +145,25 @@ class SMatDVecMultExpr
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case either the matrix or the vector operand requires an intermediate evaluation, the
+   /*! This variable template is a helper for the selection of the nonzero-balanced parallel
+       kernel. In case the sparse matrix operand provides the offsets of its rows (see the
+       HasRowOffsets type trait) and the elements of the target vector are not resizable, the
        variable will be set to 1, otherwise it will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = useAssign;
+   static constexpr bool UseBalancedKernel_v =
+      ( HasRowOffsets_v<MT> && !IsResizable_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case either the matrix or the vector operand requires an intermediate evaluation or
+       in case the nonzero-balanced parallel kernel can be used, the variable will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSMPAssign_v = ( useAssign || UseBalancedKernel_v<T1> );
    /*! \endcond */
    //**********************************************************************************************
 
@@ -536,6 +563,103 @@ class SMatDVecMultExpr
    // No special implementation for the division assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP balanced kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced parallel kernel for the sparse matrix-dense vector multiplication.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The operation for the update of the target vector.
+   // \return void
+   //
+   // This function implements the parallel kernel for the assignment of a sparse matrix-dense
+   // vector multiplication to a dense vector. In contrast to the default parallelization, which
+   // splits the target vector into equally sized parts, the non-zero elements of the sparse
+   // matrix are split into equally sized ranges based on the offsets of its rows. Thus matrices
+   // with very irregular row lengths (as for instance graphs with a power-law degree distribution)
+   // don't leave most threads idle. A row that spans several ranges is split among the according
+   // threads: each thread first computes the contribution of the part of the row in its range,
+   // afterwards the thread owning the first element of the row combines the contributions. Each
+   // element of the target vector is updated by exactly one thread and no atomic operations are
+   // required. In case the size of the target vector does not exceed the threshold given by
+   // SMP_SMATDVECMULT_THRESHOLD, the kernel is executed single-threaded.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the update operation
+   static inline void smpBalancedKernel( VT1& y, const MT1& A, const VT2& x, OP op )
+   {
+      using ET = ElementType_t<VT1>;
+
+      const size_t  m( A.rows() );
+      const size_t* offsets( A.rowOffsets() );
+      const size_t  N( offsets[m] );
+
+      const size_t T( ( !IsSMPAssignable_v<VT1> || isSerialSectionActive() ||
+                        isParallelSectionActive() || y.size() <= SMP_SMATDVECMULT_THRESHOLD )
+                      ?( 1UL )
+                      :( min( getNumThreads(), max( 1UL, N ) ) ) );
+
+      // Computing the first row owned by each thread
+      std::vector<size_t> first( T+1UL );
+      for( size_t t=0UL; t<T; ++t ) {
+         first[t] = std::lower_bound( offsets, offsets+m, t*N/T ) - offsets;
+      }
+      first[T] = m;
+
+      // Computing the sum of the products of the non-zero elements [lo..hi) of row i
+      const auto sum = [&A,&x,offsets]( size_t i, size_t lo, size_t hi )
+      {
+         const auto end( A.begin(i) + ( hi - offsets[i] ) );
+         auto element( A.begin(i) + ( lo - offsets[i] ) );
+
+         ET tmp{};
+         for( ; element!=end; ++element )
+            tmp += element->value() * x[element->index()];
+         return tmp;
+      };
+
+      // Computing the contributions to the rows starting in the range of the previous thread
+      std::vector<ET> carries( T );
+
+      if( T > 1UL )
+      {
+         smpFor( T, [&]( size_t t )
+         {
+            const size_t i( first[t] );
+            const size_t lo( t*N/T );
+            const size_t hi( (t+1UL)*N/T );
+
+            if( t > 0UL && i > 0UL && offsets[i] > lo ) {
+               carries[t] = sum( i-1UL, lo, min( offsets[i], hi ) );
+            }
+         } );
+      }
+
+      // Computing the rows starting in the range of each thread
+      smpFor( T, [&]( size_t t )
+      {
+         const size_t hi( (t+1UL)*N/T );
+
+         for( size_t i=first[t]; i<first[t+1UL]; ++i )
+         {
+            ET tmp( sum( i, offsets[i], min( offsets[i+1UL], hi ) ) );
+
+            if( i+1UL == first[t+1UL] ) {
+               for( size_t s=t+1UL; s<T && first[s]==i+1UL; ++s )
+                  tmp += carries[s];
+            }
+
+            y[i] = op( y[i], tmp );
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense vectors*************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a dense vector
@@ -552,7 +676,7 @@ class SMatDVecMultExpr
    // specific parallel evaluation strategy is selected.
    */
    template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedKernel_v<VT1> >
       smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -577,6 +701,52 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector by means of the nonzero-balanced parallel
+   // kernel. Due to the explicit application of the SFINAE principle, this function can only
+   // be selected by the compiler in case the sparse matrix operand provides the offsets of its
+   // rows.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedKernel_v<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      using ET = ElementType_t<VT1>;
+
+      SMatDVecMultExpr::smpBalancedKernel( ~lhs, A, x, []( const ET&, const ET& b ) {
+         return b;
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -626,7 +796,7 @@ class SMatDVecMultExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedKernel_v<VT1> >
       smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -650,6 +820,47 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector by means of the nonzero-balanced parallel
+   // kernel. Due to the explicit application of the SFINAE principle, this function can only
+   // be selected by the compiler in case the sparse matrix operand provides the offsets of its
+   // rows.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedKernel_v<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      SMatDVecMultExpr::smpBalancedKernel( ~lhs, A, x, Add() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -670,7 +881,7 @@ class SMatDVecMultExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedKernel_v<VT1> >
       smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -694,6 +905,47 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector by means of the nonzero-balanced parallel
+   // kernel. Due to the explicit application of the SFINAE principle, this function can only
+   // be selected by the compiler in case the sparse matrix operand provides the offsets of its
+   // rows.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedKernel_v<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      SMatDVecMultExpr::smpBalancedKernel( ~lhs, A, x, Sub() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SellTransExpr.h
+//  \brief Header file for the SELL matrix transpose expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SELLTRANSEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SELLTRANSEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/expressions/SellDVecMultExpr.h>
+#include <blaze/math/expressions/TDVecSellMultExpr.h>
+#include <blaze/math/sparse/SellMatrix.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SELLTRANSEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the transposition of a SELL matrix.
+// \ingroup sell_matrix
+//
+// The SellTransExpr class represents the compile time expression for the transposition of a
+// SELL matrix. Since a SELL matrix can only be used in multiplications with dense vectors, the
+// transpose expression only provides these multiplications. They are mapped onto the according
+// multiplications with the original matrix:
+
+   \code
+   y = trans( A ) * x;              // Evaluated as trans( trans( x ) * A )
+   y = trans( x ) * trans( A );     // Evaluated as trans( A * trans( x ) )
+   \endcode
+*/
+template< typename MT >  // Type of the SELL matrix
+class SellTransExpr
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This    = SellTransExpr<MT>;  //!< Type of this SellTransExpr instance.
+   using Operand = const MT&;          //!< Composite type of the SELL matrix operand.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SellTransExpr class.
+   //
+   // \param sm The SELL matrix operand of the transposition expression.
+   */
+   explicit inline SellTransExpr( const MT& sm ) noexcept
+      : sm_( sm )  // SELL matrix of the transposition expression
+   {}
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return sm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return sm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the SELL matrix operand.
+   //
+   // \return The SELL matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand sm_;  //!< SELL matrix of the transposition expression.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Calculation of the transpose of the given SELL matrix.
+// \ingroup sell_matrix
+//
+// \param sm The SELL matrix to be transposed.
+// \return The transpose of the matrix.
+//
+// This function returns an expression representing the transpose of the given SELL matrix,
+// which can be used in multiplications with dense vectors:
+
+   \code
+   blaze::SellMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+   y = trans( A ) * x;
+   \endcode
+*/
+template< typename Type  // Data type of the SELL matrix
+        , size_t C >     // Chunk height of the SELL matrix
+inline decltype(auto) trans( const SellMatrix<Type,C>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const SellTransExpr< SellMatrix<Type,C> >;
+   return ReturnType( sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the transpose of a transpose SELL matrix.
+// \ingroup sell_matrix
+//
+// \param sm The transpose SELL matrix to be (re-)transposed.
+// \return The original SELL matrix.
+*/
+template< typename MT >  // Type of the SELL matrix
+inline decltype(auto) trans( const SellTransExpr<MT>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sm.operand();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose SELL matrix and a dense
+//        vector (\f$ \vec{y}=A^T*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side transpose SELL matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT    // Type of the left-hand side SELL matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const SellTransExpr<MT>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return trans( trans( ~vec ) * mat.operand() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        transpose SELL matrix (\f$ \vec{y}^T=\vec{x}^T*A^T \f$).
+// \ingroup dense_vector
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side transpose SELL matrix for the multiplication.
+// \return The resulting transpose vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side SELL matrix
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& vec, const SellTransExpr<MT>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != mat.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return trans( mat.operand() * trans( ~vec ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
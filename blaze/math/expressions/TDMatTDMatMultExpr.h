@@ -51,6 +51,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/Strassen.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -225,6 +226,25 @@ class TDMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the types of all three involved matrices are suited for the Strassen-Winograd
+       algorithm, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseStrassenKernel_v =
+      ( useStrassen &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        !IsTriangular_v<T2> && !IsTriangular_v<T3> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -556,9 +576,12 @@ class TDMatTDMatMultExpr
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal_v<MT4> ) ||
-          ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UseStrassenKernel_v<MT3,MT4,MT5> &&
+          min( C.rows(), C.columns(), A.columns() ) >= STRASSEN_THRESHOLD )
+         selectStrassenAssignKernel( C, A, B );
+      else if( ( IsDiagonal_v<MT4> ) ||
+               ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -1629,6 +1652,56 @@ class TDMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Strassen-Winograd assignment to dense matrices (default)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a large transpose dense matrix-transpose dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the BLAS-based or default implementation of the assignment of a
+   // large transpose dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline DisableIf_t< UseStrassenKernel_v<MT3,MT4,MT5> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectBlasAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Strassen-Winograd assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Strassen-Winograd-based assignment of a large transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function performs the transpose dense matrix-transpose dense matrix multiplication by means of the recursive
+   // Strassen-Winograd algorithm. Only available in case the BLAZE_USE_STRASSEN switch is set.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseStrassenKernel_v<MT3,MT4,MT5> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      strassen( C, A, B, ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-transpose dense matrix multiplication
@@ -4708,6 +4781,23 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
         !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the types of all three involved matrices are suited for the Strassen-Winograd
+       algorithm, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseStrassenKernel_v =
+      ( useStrassen &&
+        !SYM && !HERM && !LOW && !UPP &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        !IsTriangular_v<T2> && !IsTriangular_v<T3> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! In case all four involved data types are suited for a vectorized computation of the
@@ -5001,9 +5091,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT4> ) ||
-          ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+      if( UseStrassenKernel_v<MT3,MT4,MT5,ST2> &&
+          min( C.rows(), C.columns(), A.columns() ) >= STRASSEN_THRESHOLD )
+         selectStrassenAssignKernel( C, A, B, scalar );
+      else if( ( IsDiagonal_v<MT4> ) ||
+               ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
+               ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
          selectSmallAssignKernel( C, A, B, scalar );
       else
          selectBlasAssignKernel( C, A, B, scalar );
@@ -6091,6 +6184,57 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Strassen-Winograd assignment to dense matrices (default)************************************
+   /*!\brief Default assignment of a large scaled transpose dense matrix-transpose dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the BLAS-based or default implementation of the assignment of a
+   // large scaled transpose dense matrix-transpose dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline DisableIf_t< UseStrassenKernel_v<MT3,MT4,MT5,ST2> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      selectBlasAssignKernel( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
+   //**Strassen-Winograd assignment to dense matrices**********************************************
+   /*!\brief Strassen-Winograd-based assignment of a large scaled transpose dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled transpose dense matrix-transpose dense matrix multiplication by means of the
+   // recursive Strassen-Winograd algorithm. Only available in case the BLAZE_USE_STRASSEN switch
+   // is set.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline EnableIf_t< UseStrassenKernel_v<MT3,MT4,MT5,ST2> >
+      selectStrassenAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      strassen( C, A, B, scalar );
+   }
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*!\brief Default assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
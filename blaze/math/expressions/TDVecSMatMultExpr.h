@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -54,9 +55,15 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/TVecMatMultExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -64,6 +71,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -71,6 +79,8 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -123,10 +133,12 @@ class TDVecSMatMultExpr
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case either the vector or the matrix operand requires an intermediate evaluation, the
+       In case either the vector or the matrix operand requires an intermediate evaluation or the
+       elements of the target vector can be accumulated in per-thread partial results, the
        variable will be set to 1, otherwise it will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = ( evaluateVector || evaluateMatrix );
+   static constexpr bool UseSMPAssign_v =
+      ( evaluateVector || evaluateMatrix || !IsResizable_v< ElementType_t<T1> > );
    /*! \endcond */
    //**********************************************************************************************
 
@@ -611,6 +623,84 @@ class TDVecSMatMultExpr
    // No special implementation for the division assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP scatter kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel scatter kernel for the transpose dense vector-sparse matrix multiplication.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \param op The operation for the update of the target vector (Add or Sub).
+   // \return void
+   //
+   // This function implements the parallel kernel for the assignment of a transpose dense
+   // vector-sparse matrix multiplication to a dense vector. Since each row of the sparse matrix
+   // scatters into arbitrary elements of the target vector, the target vector cannot be split
+   // among the threads. Instead, the rows of the sparse matrix are split into contiguous ranges.
+   // The first range updates the target vector directly, all other ranges accumulate their
+   // contributions in private partial results. Afterwards the partial results are combined with
+   // the target vector in parallel, each thread handling a distinct range of elements. Thus no
+   // atomic operations are required. The number of threads is limited to the average number of
+   // non-zero elements per column in order to bound the memory for the partial results by the
+   // number of non-zero elements. In case the size of the target vector does not exceed the
+   // SMP_TDVECSMATMULT_THRESHOLD, the kernel is executed single-threaded.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the update operation
+   static inline void smpScatterKernel( VT1& y, const VT2& x, const MT1& A, OP op )
+   {
+      using ET = ElementType_t<VT1>;
+      using ConstIterator = ConstIterator_t< RemoveReference_t<MT1> >;
+
+      const size_t m( A.rows() );
+      const size_t n( A.columns() );
+
+      const size_t T( ( !IsSMPAssignable_v<VT1> || isSerialSectionActive() ||
+                        isParallelSectionActive() || n <= SMP_TDVECSMATMULT_THRESHOLD )
+                      ?( 1UL )
+                      :( min( getNumThreads(), m, max( 1UL, A.nonZeros() / n ) ) ) );
+
+      std::vector<ET> partials( (T-1UL)*n );
+
+      // Scattering the elements of each range into the target vector or the partial results
+      smpFor( T, [&]( size_t t )
+      {
+         ET* const z( ( t > 0UL )?( partials.data() + (t-1UL)*n ):( nullptr ) );
+
+         for( size_t i=t*m/T; i<(t+1UL)*m/T; ++i )
+         {
+            const ConstIterator end( A.end(i) );
+            ConstIterator element( A.begin(i) );
+
+            if( z == nullptr ) {
+               for( ; element!=end; ++element )
+                  y[element->index()] = op( y[element->index()], x[i] * element->value() );
+            }
+            else {
+               for( ; element!=end; ++element )
+                  z[element->index()] += x[i] * element->value();
+            }
+         }
+      } );
+
+      if( T < 2UL ) return;
+
+      // Combining the partial results with the target vector
+      smpFor( T, [&]( size_t t )
+      {
+         for( size_t k=t*n/T; k<(t+1UL)*n/T; ++k ) {
+            for( size_t s=0UL; s<T-1UL; ++s ) {
+               y[k] = op( y[k], partials[s*n+k] );
+            }
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense vectors*************************************************************
    /*!\brief SMP assignment of a transpose dense vector-sparse matrix multiplication to a dense
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -645,7 +735,10 @@ class TDVecSMatMultExpr
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, x * A );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpAssign( ~lhs, x * A );
+      else
+         TDVecSMatMultExpr::smpScatterKernel( ~lhs, x, A, Add() );
    }
    //**********************************************************************************************
 
@@ -714,7 +807,10 @@ class TDVecSMatMultExpr
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, x * A );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpAddAssign( ~lhs, x * A );
+      else
+         TDVecSMatMultExpr::smpScatterKernel( ~lhs, x, A, Add() );
    }
    //**********************************************************************************************
 
@@ -756,7 +852,10 @@ class TDVecSMatMultExpr
       BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, x * A );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpSubAssign( ~lhs, x * A );
+      else
+         TDVecSMatMultExpr::smpScatterKernel( ~lhs, x, A, Sub() );
    }
    //**********************************************************************************************
 
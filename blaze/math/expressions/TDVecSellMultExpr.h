@@ -0,0 +1,542 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/TDVecSellMultExpr.h
+//  \brief Header file for the transpose dense vector/SELL matrix multiplication expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_TDVECSELLMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_TDVECSELLMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RowVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/TVecMatMultExpr.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SellMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TDVECSELLMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for transpose dense vector-SELL matrix multiplications.
+// \ingroup dense_vector_expression
+//
+// The TDVecSellMultExpr class represents the compile time expression for multiplications
+// between transpose dense vectors and SELL matrices. The expression is always evaluated by means
+// of the tmultiply() kernel of the SellMatrix class template, which is parallelized internally.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side SELL matrix
+class TDVecSellMultExpr
+   : public TVecMatMultExpr< DenseVector< TDVecSellMultExpr<VT,MT>, true > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using VRT = ResultType_t<VT>;     //!< Result type of the dense vector expression.
+   using VCT = CompositeType_t<VT>;  //!< Composite type of the dense vector expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense vector expression.
+   static constexpr bool evaluateVector = ( IsComputation_v<VT> || RequiresEvaluation_v<VT> );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this TDVecSellMultExpr instance.
+   using This = TDVecSellMultExpr<VT,MT>;
+
+   //! Resulting element type.
+   using ElementType = MultTrait_t< ElementType_t<MT>, ElementType_t<VT> >;
+
+   //! Result type for expression template evaluations.
+   using ResultType = DynamicVector<ElementType,true>;
+
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the SELL matrix operand.
+   using MatrixOperand = const MT&;
+
+   //! Composite type of the dense vector operand.
+   using VectorOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+
+   //! Type for the assignment of the dense vector operand.
+   using RT = If_t< evaluateVector, const VRT, VCT >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecSellMultExpr class.
+   //
+   // \param vec The left-hand side dense vector operand of the multiplication expression.
+   // \param mat The right-hand side SELL matrix operand of the multiplication expression.
+   */
+   explicit inline TDVecSellMultExpr( const VT& vec, const MT& mat ) noexcept
+      : vec_( vec )  // Left-hand side dense vector of the multiplication expression
+      , mat_( mat )  // Right-hand side SELL matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( vec_.size() == mat_.rows(), "Invalid matrix and vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < mat_.columns(), "Invalid vector access index" );
+      return mat_.tmultiply( index, vec_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= mat_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return mat_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense vector operand.
+   //
+   // \return The left-hand side dense vector operand.
+   */
+   inline VectorOperand leftOperand() const noexcept {
+      return vec_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side SELL matrix operand.
+   //
+   // \return The right-hand side SELL matrix operand.
+   */
+   inline MatrixOperand rightOperand() const noexcept {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return vec_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a false, since the expression is parallelized internally.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VectorOperand vec_;  //!< Left-hand side dense vector of the multiplication expression.
+   MatrixOperand mat_;  //!< Right-hand side SELL matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-SELL matrix multiplication to a dense vector
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a transpose dense vector-SELL
+   // matrix multiplication expression to a dense vector by means of the tmultiply() kernel of the
+   // SELL matrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( rhs.vec_ );  // Evaluation of the dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      rhs.mat_.tmultiply( ~lhs, x, []( auto& a, const auto& b ){ a = b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-SELL matrix multiplication to a sparse vector
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a transpose dense vector-SELL
+   // matrix multiplication expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-SELL matrix multiplication to a dense
+   //        vector
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a transpose dense
+   // vector-SELL matrix multiplication expression to a dense vector by means of the tmultiply()
+   // kernel of the SELL matrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( rhs.vec_ );  // Evaluation of the dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      rhs.mat_.tmultiply( ~lhs, x, []( auto& a, const auto& b ){ a += b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-SELL matrix multiplication to a
+   //        dense vector
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a transpose dense
+   // vector-SELL matrix multiplication expression to a dense vector by means of the tmultiply()
+   // kernel of the SELL matrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( rhs.vec_ );  // Evaluation of the dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      rhs.mat_.tmultiply( ~lhs, x, []( auto& a, const auto& b ){ a -= b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a transpose dense vector-SELL matrix multiplication to a
+   //        dense vector
+   //        (\f$ \vec{y}^T*=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a transpose
+   // dense vector-SELL matrix multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a transpose dense vector-SELL matrix multiplication to a dense
+   //        vector
+   //        (\f$ \vec{y}^T/=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a transpose dense
+   // vector-SELL matrix multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,true>& lhs, const TDVecSellMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   // No special implementation for the SMP assignment to dense vectors. The multiplication is
+   // parallelized internally by the tmultiply() kernel of the SELL matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE( VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        SELL matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup dense_vector
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side SELL matrix for the multiplication.
+// \return The resulting transpose vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator represents the multiplication between a transpose dense vector and a SELL
+// matrix:
+
+   \code
+   using blaze::rowVector;
+
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,rowVector> x, y;
+   // ... Resizing and initialization
+   const blaze::SellMatrix<double> S( A );
+   y = x * S;
+   \endcode
+
+// The operator returns an expression representing a transpose dense vector of the higher-order
+// element type of the two involved element types \a VT::ElementType and \a Type. In case the
+// current size of the vector \a vec doesn't match the current number of rows of the matrix
+// \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename Type  // Data type of the right-hand side SELL matrix
+        , size_t C >     // Chunk height of the right-hand side SELL matrix
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& vec, const SellMatrix<Type,C>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != mat.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   using ReturnType = const TDVecSellMultExpr< VT, SellMatrix<Type,C> >;
+   return ReturnType( ~vec, mat );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename MT >
+struct IsAligned< TDVecSellMultExpr<VT,MT> >
+   : public IsAligned<VT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/ColumnVector.h>
@@ -55,9 +56,15 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -65,6 +72,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -72,6 +80,8 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -124,10 +134,12 @@ class TSMatDVecMultExpr
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case either the matrix or the vector operand requires an intermediate evaluation, the
+       In case either the matrix or the vector operand requires an intermediate evaluation or the
+       elements of the target vector can be accumulated in per-thread partial results, the
        variable will be set to 1, otherwise it will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = ( evaluateMatrix || evaluateVector );
+   static constexpr bool UseSMPAssign_v =
+      ( evaluateMatrix || evaluateVector || !IsResizable_v< ElementType_t<T1> > );
    /*! \endcond */
    //**********************************************************************************************
 
@@ -623,6 +635,84 @@ class TSMatDVecMultExpr
    // No special implementation for the division assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP scatter kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel scatter kernel for the transpose sparse matrix-dense vector multiplication.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The operation for the update of the target vector (Add or Sub).
+   // \return void
+   //
+   // This function implements the parallel kernel for the assignment of a transpose sparse
+   // matrix-dense vector multiplication to a dense vector. Since each column of the sparse matrix
+   // scatters into arbitrary elements of the target vector, the target vector cannot be split
+   // among the threads. Instead, the columns of the sparse matrix are split into contiguous
+   // ranges. The first range updates the target vector directly, all other ranges accumulate
+   // their contributions in private partial results. Afterwards the partial results are combined
+   // with the target vector in parallel, each thread handling a distinct range of elements. Thus
+   // no atomic operations are required. The number of threads is limited to the average number
+   // of non-zero elements per row in order to bound the memory for the partial results by the
+   // number of non-zero elements. In case the size of the target vector does not exceed the
+   // SMP_TSMATDVECMULT_THRESHOLD, the kernel is executed single-threaded.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the update operation
+   static inline void smpScatterKernel( VT1& y, const MT1& A, const VT2& x, OP op )
+   {
+      using ET = ElementType_t<VT1>;
+      using ConstIterator = ConstIterator_t< RemoveReference_t<MT1> >;
+
+      const size_t m( A.rows() );
+      const size_t n( A.columns() );
+
+      const size_t T( ( !IsSMPAssignable_v<VT1> || isSerialSectionActive() ||
+                        isParallelSectionActive() || m <= SMP_TSMATDVECMULT_THRESHOLD )
+                      ?( 1UL )
+                      :( min( getNumThreads(), n, max( 1UL, A.nonZeros() / m ) ) ) );
+
+      std::vector<ET> partials( (T-1UL)*m );
+
+      // Scattering the elements of each range into the target vector or the partial results
+      smpFor( T, [&]( size_t t )
+      {
+         ET* const z( ( t > 0UL )?( partials.data() + (t-1UL)*m ):( nullptr ) );
+
+         for( size_t j=t*n/T; j<(t+1UL)*n/T; ++j )
+         {
+            const ConstIterator end( A.end(j) );
+            ConstIterator element( A.begin(j) );
+
+            if( z == nullptr ) {
+               for( ; element!=end; ++element )
+                  y[element->index()] = op( y[element->index()], element->value() * x[j] );
+            }
+            else {
+               for( ; element!=end; ++element )
+                  z[element->index()] += element->value() * x[j];
+            }
+         }
+      } );
+
+      if( T < 2UL ) return;
+
+      // Combining the partial results with the target vector
+      smpFor( T, [&]( size_t t )
+      {
+         for( size_t k=t*m/T; k<(t+1UL)*m/T; ++k ) {
+            for( size_t s=0UL; s<T-1UL; ++s ) {
+               y[k] = op( y[k], partials[s*m+k] );
+            }
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense vectors*************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose sparse matrix-dense vector multiplication to a dense
@@ -658,7 +748,10 @@ class TSMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAssign( ~lhs, A * x );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpAssign( ~lhs, A * x );
+      else
+         TSMatDVecMultExpr::smpScatterKernel( ~lhs, A, x, Add() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -729,7 +822,10 @@ class TSMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpAddAssign( ~lhs, A * x );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpAddAssign( ~lhs, A * x );
+      else
+         TSMatDVecMultExpr::smpScatterKernel( ~lhs, A, x, Add() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -771,7 +867,10 @@ class TSMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, A * x );
+      if( IsResizable_v< ElementType_t<VT2> > )
+         smpSubAssign( ~lhs, A * x );
+      else
+         TSMatDVecMultExpr::smpScatterKernel( ~lhs, A, x, Sub() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -118,6 +118,7 @@ struct Sign;
 struct Sin;
 struct Sinh;
 struct Sqrt;
+struct SqrNorm;
 struct Sub;
 struct SubAssign;
 struct Tan;
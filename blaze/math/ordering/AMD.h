@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/AMD.h
+//  \brief Header file for the approximate minimum degree ordering
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_AMD_H_
+#define _BLAZE_MATH_ORDERING_AMD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/ordering/AdjacencyGraph.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  APPROXIMATE MINIMUM DEGREE ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Approximate minimum degree ordering */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the approximate minimum degree ordering of the given adjacency graph.
+// \ingroup ordering
+//
+// \param graph The adjacency graph.
+// \return The permutation vector (new to old indices).
+//
+// This function simulates the symbolic elimination of the graph by means of a quotient graph:
+// Each eliminated vertex becomes an element representing the clique formed by its neighbors,
+// and all elements adjacent to the pivot are absorbed into the new element. Thus the memory
+// requirements never exceed the size of the original graph plus the size of the current
+// elements. The degree of each variable adjacent to the pivot is updated by means of the
+// approximate external degree bound of Amestoy, Davis, and Duff:
+
+      \f[ d_i = \min\left( n-k-1,\ d_i+|L_p \setminus i|,\
+                |A_i \setminus i|+|L_p \setminus i|+\sum_{e \in E_i \setminus p}|L_e \setminus L_p|
+                \right), \f]
+
+// where \f$ A_i \f$ and \f$ E_i \f$ are the variables and elements adjacent to variable \a i and
+// \f$ L_e \f$ is the set of variables of element \a e. In contrast to the full AMD algorithm,
+// neither supervariables nor aggressive absorption are detected. The variables are kept in
+// linked lists of equal approximate degree, which bounds the additional memory by \f$ O(n) \f$.
+// In case of ties, the most recently updated variable is eliminated first.
+*/
+inline std::vector<size_t> amd( const AdjacencyGraph& graph )
+{
+   constexpr unsigned char variable( 0U );
+   constexpr unsigned char element ( 1U );
+   constexpr unsigned char absorbed( 2U );
+
+   const size_t n( graph.vertices() );
+   const size_t invalid( size_t(-1) );
+
+   std::vector<unsigned char> status( n, variable );
+   std::vector< std::vector<size_t> > vars ( n );  // Adjacent variables or variables of an element
+   std::vector< std::vector<size_t> > elems( n );  // Adjacent elements of a variable
+   std::vector<size_t> degree( n );
+   std::vector<size_t> mark( n, invalid );
+   std::vector<size_t> weight( n, invalid );
+
+   // Doubly linked lists of all variables with the same approximate degree
+   std::vector<size_t> head( n, invalid );
+   std::vector<size_t> next( n, invalid );
+   std::vector<size_t> prev( n, invalid );
+   size_t minDegree( n );
+
+   const auto insert = [&]( size_t i )
+   {
+      const size_t d( degree[i] );
+      next[i] = head[d];
+      prev[i] = invalid;
+      if( head[d] != invalid )
+         prev[head[d]] = i;
+      head[d] = i;
+      minDegree = min( minDegree, d );
+   };
+
+   const auto remove = [&]( size_t i )
+   {
+      if( prev[i] != invalid )
+         next[prev[i]] = next[i];
+      else
+         head[degree[i]] = next[i];
+      if( next[i] != invalid )
+         prev[next[i]] = prev[i];
+   };
+
+   for( size_t i=n; i-- > 0UL; ) {
+      vars[i].assign( graph.begin(i), graph.end(i) );
+      degree[i] = graph.degree(i);
+      insert( i );
+   }
+
+   std::vector<size_t> perm;
+   std::vector<size_t> pivots;
+   std::vector<size_t> touched;
+
+   perm.reserve( n );
+
+   while( perm.size() < n )
+   {
+      while( head[minDegree] == invalid ) {
+         ++minDegree;
+      }
+
+      const size_t p( head[minDegree] );
+      remove( p );
+
+      perm.push_back( p );
+      status[p] = element;
+      mark[p] = p;
+
+      // Construction of the new element from the adjacent variables and elements
+      pivots.clear();
+
+      for( size_t j : vars[p] ) {
+         if( status[j] == variable && mark[j] != p ) {
+            mark[j] = p;
+            pivots.push_back( j );
+         }
+      }
+
+      for( size_t e : elems[p] )
+      {
+         if( status[e] != element )
+            continue;
+
+         for( size_t j : vars[e] ) {
+            if( status[j] == variable && mark[j] != p ) {
+               mark[j] = p;
+               pivots.push_back( j );
+            }
+         }
+
+         status[e] = absorbed;
+         std::vector<size_t>().swap( vars[e] );
+      }
+
+      vars[p] = pivots;
+      std::vector<size_t>().swap( elems[p] );
+
+      // Pruning of the adjacency lists of all variables of the new element
+      for( size_t i : pivots )
+      {
+         auto& Ei( elems[i] );
+         Ei.erase( std::remove_if( Ei.begin(), Ei.end(),
+                                   [&]( size_t e ) { return status[e] != element; } ), Ei.end() );
+         Ei.push_back( p );
+
+         auto& Ai( vars[i] );
+         Ai.erase( std::remove_if( Ai.begin(), Ai.end(), [&]( size_t j ) {
+                                      return status[j] != variable || mark[j] == p; } ),
+                   Ai.end() );
+      }
+
+      // Computation of the sizes |Le \ Lp| of all elements adjacent to the new element
+      touched.clear();
+
+      for( size_t i : pivots ) {
+         for( size_t e : elems[i] ) {
+            if( e == p ) continue;
+            if( weight[e] == invalid ) {
+               weight[e] = vars[e].size();
+               touched.push_back( e );
+            }
+            --weight[e];
+         }
+      }
+
+      // Update of the approximate external degrees
+      const size_t remaining( n - perm.size() );
+
+      for( size_t i : pivots )
+      {
+         size_t external( vars[i].size() + pivots.size() - 1UL );
+
+         for( size_t e : elems[i] ) {
+            if( e != p )
+               external += weight[e];
+         }
+
+         remove( i );
+         degree[i] = min( remaining-1UL, degree[i]+pivots.size()-1UL, external );
+         insert( i );
+      }
+
+      for( size_t e : touched ) {
+         weight[e] = invalid;
+      }
+   }
+
+   return perm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a fill-reducing ordering of the given sparse matrix by means of the approximate
+//        minimum degree algorithm.
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be ordered.
+// \return The permutation vector (new to old indices).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric permutation of the given sparse matrix that reduces the
+// fill-in of a subsequent Cholesky or LU decomposition. The ordering is computed on the pattern
+// of \f$ A+A^T \f$ by repeatedly eliminating a vertex of (approximately) minimum degree. The
+// \a k-th element of the returned vector is the index of the row/column of \a A that becomes
+// the \a k-th row/column of the permuted matrix \f$ PAP^T \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( blaze::amd( A ) );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A )
+{
+   return amd( AdjacencyGraph( ~A ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,257 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/AdjacencyGraph.h
+//  \brief Header file for the adjacency graph of a sparse matrix
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_ADJACENCYGRAPH_H_
+#define _BLAZE_MATH_ORDERING_ADJACENCYGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Undirected adjacency graph of the sparsity pattern of a square sparse matrix.
+// \ingroup ordering
+//
+// The AdjacencyGraph class represents the sparsity pattern of \f$ A+A^T \f$ without the diagonal
+// as an undirected graph in compressed form: vertex \a i is adjacent to vertex \a j if either
+// \f$ A(i,j) \f$ or \f$ A(j,i) \f$ is a non-zero element. The adjacency list of each vertex is
+// sorted in ascending order and contains no duplicates. The graph is the common input of all
+// ordering algorithms.
+*/
+class AdjacencyGraph
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline AdjacencyGraph( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        vertices()        const noexcept;
+   inline size_t        edges()           const noexcept;
+   inline size_t        degree( size_t i ) const noexcept;
+   inline const size_t* begin ( size_t i ) const noexcept;
+   inline const size_t* end   ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> ptr_;  //!< The offsets of the adjacency lists.
+   std::vector<size_t> adj_;  //!< The concatenated adjacency lists.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Construction of the adjacency graph of the given sparse matrix.
+//
+// \param A The square sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline AdjacencyGraph::AdjacencyGraph( const SparseMatrix<MT,SO>& A )
+   : ptr_()  // The offsets of the adjacency lists
+   , adj_()  // The concatenated adjacency lists
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   using ET = ElementType_t<MT>;
+   using Operand = If_t< SO, const CompressedMatrix<ET,rowMajor>, CompositeType_t<MT> >;
+
+   Operand tmp( ~A );  // Row-major evaluation of the sparse matrix
+
+   const size_t n( tmp.rows() );
+
+   // Counting the (possibly duplicate) neighbors of each vertex
+   std::vector<size_t> count( n+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            ++count[i+1UL];
+            ++count[j+1UL];
+         }
+      }
+   }
+
+   for( size_t i=1UL; i<=n; ++i ) {
+      count[i] += count[i-1UL];
+   }
+
+   std::vector<size_t> raw( count[n] );
+   std::vector<size_t> pos( count.begin(), count.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            raw[pos[i]++] = j;
+            raw[pos[j]++] = i;
+         }
+      }
+   }
+
+   // Sorting the adjacency lists and removing the duplicates
+   ptr_.resize( n+1UL );
+   adj_.reserve( raw.size() );
+   ptr_[0UL] = 0UL;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto first( raw.begin() + count[i] );
+      const auto last ( raw.begin() + count[i+1UL] );
+      std::sort( first, last );
+      adj_.insert( adj_.end(), first, std::unique( first, last ) );
+      ptr_[i+1UL] = adj_.size();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of vertices of the graph.
+//
+// \return The number of vertices.
+*/
+inline size_t AdjacencyGraph::vertices() const noexcept
+{
+   return ptr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of (directed) edges of the graph.
+//
+// \return The total length of all adjacency lists.
+*/
+inline size_t AdjacencyGraph::edges() const noexcept
+{
+   return adj_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the degree of the given vertex.
+//
+// \param i The index of the vertex.
+// \return The number of neighbors of vertex \a i.
+*/
+inline size_t AdjacencyGraph::degree( size_t i ) const noexcept
+{
+   return ptr_[i+1UL] - ptr_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first neighbor of the given vertex.
+//
+// \param i The index of the vertex.
+// \return Pointer to the first neighbor of vertex \a i.
+*/
+inline const size_t* AdjacencyGraph::begin( size_t i ) const noexcept
+{
+   return adj_.data() + ptr_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer one past the last neighbor of the given vertex.
+//
+// \param i The index of the vertex.
+// \return Pointer one past the last neighbor of vertex \a i.
+*/
+inline const size_t* AdjacencyGraph::end( size_t i ) const noexcept
+{
+   return adj_.data() + ptr_[i+1UL];
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,301 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/NestedDissection.h
+//  \brief Header file for the nested dissection ordering
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_NESTEDDISSECTION_H_
+#define _BLAZE_MATH_ORDERING_NESTEDDISSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/ordering/AdjacencyGraph.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NESTED DISSECTION ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Nested dissection ordering */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize = 64UL );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive bisection of the given adjacency graph.
+// \ingroup ordering
+//
+// \param graph The adjacency graph.
+// \param leafSize The maximum number of vertices of a subgraph that is not split further.
+// \param separators \a true to split by vertex separators, \a false to split without separators.
+// \return The permutation vector (new to old indices).
+//
+// This function recursively splits the graph into two parts, which are ordered one after the
+// other. Each split is based on the level structure of a breadth-first search that starts at a
+// pseudo-peripheral vertex. In case \a separators is \a true, the vertices of the middle level
+// that are adjacent to the next level form a vertex separator, which is ordered after both
+// parts. Otherwise the breadth-first order of the subgraph is split into two halves, such that
+// both parts are compact and adjacent parts are close to each other. Disconnected subgraphs
+// are split into their components without separator. The vertices of subgraphs with at most
+// \a leafSize vertices keep their relative order, i.e. the breadth-first order of the last
+// split.
+*/
+inline std::vector<size_t> dissect( const AdjacencyGraph& graph, size_t leafSize, bool separators )
+{
+   const size_t n( graph.vertices() );
+   const size_t invalid( size_t(-1) );
+
+   std::vector<size_t> perm( n );
+   std::vector<size_t> part( n, 0UL );
+   std::vector<size_t> level( n, invalid );
+   std::vector<size_t> queue;
+
+   queue.reserve( n );
+
+   std::vector< std::pair< std::vector<size_t>, size_t > > tasks;
+   tasks.emplace_back( std::vector<size_t>( n ), 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      tasks.back().first[i] = i;
+   }
+
+   size_t id( 0UL );
+
+   while( !tasks.empty() )
+   {
+      const std::vector<size_t> vertices( std::move( tasks.back().first ) );
+      const size_t offset( tasks.back().second );
+      const size_t size( vertices.size() );
+
+      tasks.pop_back();
+
+      if( size <= max( leafSize, 1UL ) ) {
+         std::copy( vertices.begin(), vertices.end(), perm.begin()+offset );
+         continue;
+      }
+
+      ++id;
+
+      for( size_t v : vertices ) {
+         part[v] = id;
+      }
+
+      // Breadth-first search within the current subgraph
+      const auto bfs = [&]( size_t root )
+      {
+         for( size_t v : vertices ) {
+            level[v] = invalid;
+         }
+
+         queue.clear();
+         queue.push_back( root );
+         level[root] = 0UL;
+
+         for( size_t k=0UL; k<queue.size(); ++k ) {
+            const size_t v( queue[k] );
+            for( const size_t* u=graph.begin(v); u!=graph.end(v); ++u ) {
+               if( part[*u] == id && level[*u] == invalid ) {
+                  level[*u] = level[v] + 1UL;
+                  queue.push_back( *u );
+               }
+            }
+         }
+
+         return level[queue.back()] + 1UL;
+      };
+
+      // Search for a pseudo-peripheral vertex
+      size_t root( vertices.front() );
+      size_t depth( bfs( root ) );
+
+      while( true )
+      {
+         const size_t last( level[queue.back()] );
+
+         size_t candidate( queue.back() );
+         for( size_t k=queue.size(); k-- > 0UL && level[queue[k]] == last; ) {
+            if( graph.degree( queue[k] ) < graph.degree( candidate ) )
+               candidate = queue[k];
+         }
+
+         const size_t candidateDepth( bfs( candidate ) );
+
+         if( candidateDepth <= depth ) {
+            bfs( root );
+            break;
+         }
+
+         root  = candidate;
+         depth = candidateDepth;
+      }
+
+      // Splitting of a disconnected subgraph into the reached component and the rest
+      if( queue.size() < size )
+      {
+         std::vector<size_t> rest;
+         rest.reserve( size - queue.size() );
+
+         for( size_t v : vertices ) {
+            if( level[v] == invalid )
+               rest.push_back( v );
+         }
+
+         tasks.emplace_back( std::move( rest ), offset+queue.size() );
+         tasks.emplace_back( queue, offset );
+         continue;
+      }
+
+      // Splitting of the breadth-first order into two halves
+      if( !separators ) {
+         const auto half( queue.begin() + size/2UL );
+         tasks.emplace_back( std::vector<size_t>( half, queue.end() ), offset+size/2UL );
+         tasks.emplace_back( std::vector<size_t>( queue.begin(), half ), offset );
+         continue;
+      }
+
+      if( depth < 3UL ) {
+         std::copy( vertices.begin(), vertices.end(), perm.begin()+offset );
+         continue;
+      }
+
+      // Selection of the middle level
+      std::vector<size_t> counts( depth, 0UL );
+
+      for( size_t v : queue ) {
+         ++counts[level[v]];
+      }
+
+      size_t middle( 0UL );
+      size_t accumulated( 0UL );
+
+      while( accumulated + counts[middle] < size/2UL ) {
+         accumulated += counts[middle++];
+      }
+
+      middle = min( max( middle, 1UL ), depth-2UL );
+
+      // Construction of the separator and the two parts
+      std::vector<size_t> first, second, separator;
+
+      for( size_t v : queue )
+      {
+         if( level[v] < middle ) {
+            first.push_back( v );
+         }
+         else if( level[v] > middle ) {
+            second.push_back( v );
+         }
+         else {
+            const bool adjacent( std::any_of( graph.begin(v), graph.end(v), [&]( size_t u ) {
+               return part[u] == id && level[u] == middle+1UL; } ) );
+            ( adjacent ? separator : first ).push_back( v );
+         }
+      }
+
+      std::copy( separator.begin(), separator.end(), perm.begin()+offset+size-separator.size() );
+
+      const size_t secondOffset( offset + first.size() );
+      tasks.emplace_back( std::move( second ), secondOffset );
+      tasks.emplace_back( std::move( first ), offset );
+   }
+
+   return perm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the nested dissection ordering of the given adjacency graph.
+// \ingroup ordering
+//
+// \param graph The adjacency graph.
+// \param leafSize The maximum number of vertices of a subgraph that is not dissected further.
+// \return The permutation vector (new to old indices).
+*/
+inline std::vector<size_t> nestedDissection( const AdjacencyGraph& graph, size_t leafSize )
+{
+   return dissect( graph, leafSize, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a fill-reducing ordering of the given sparse matrix by means of nested
+//        dissection.
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be ordered.
+// \param leafSize The maximum number of vertices of a subgraph that is not dissected further.
+// \return The permutation vector (new to old indices).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric permutation of the given sparse matrix by recursively
+// splitting the graph of \f$ A+A^T \f$ by means of vertex separators, where the vertices of
+// each separator are ordered after the vertices of the two parts it separates. For matrices
+// resulting from the discretization of 2D and 3D problems, nested dissection typically results
+// in less fill-in and in wider and better balanced elimination trees than minimum degree
+// orderings, which is particularly beneficial for parallel sparse factorizations. The \a k-th
+// element of the returned vector is the index of the row/column of \a A that becomes the
+// \a k-th row/column of the permuted matrix \f$ PAP^T \f$.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize )
+{
+   return nestedDissection( AdjacencyGraph( ~A ), leafSize );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,81 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/Ordering.h
+//  \brief Header file for the documentation of the ordering module
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_ORDERING_H_
+#define _BLAZE_MATH_ORDERING_ORDERING_H_
+
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup ordering Orderings
+// \ingroup math
+//
+// The ordering module provides symmetric permutations of sparse matrices that either reduce the
+// fill-in of sparse direct factorizations or improve the memory locality of sparse matrix/vector
+// multiplications:
+//
+//  - amd(): the approximate minimum degree ordering
+//  - nestedDissection(): the nested dissection ordering based on level structure separators
+//  - rcm(): the reverse Cuthill-McKee ordering, which reduces the bandwidth and the profile
+//  - partitionOrdering(): the recursive bisection into cache-sized blocks of rows/columns
+//
+// All functions consider the sparsity pattern of \f$ A+A^T \f$ and return a permutation vector
+// \a perm, where \a perm[k] is the index of the row/column of \a A that is moved to position
+// \a k. The fill-reducing orderings can be selected by means of an OrderingFlag for the symbolic
+// analysis of the SparseCholesky class. The permute() functions apply a permutation vector to
+// a sparse matrix (\f$ PAP^T \f$) or a dense vector (\f$ P\vec{x} \f$) in parallel, such that
+// a problem can be reordered once during its setup:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   blaze::SparseCholesky<double> chol( A, blaze::nestedDissectionOrdering );
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, perm ) );
+   const blaze::DynamicVector<double> z( blaze::permute( x, perm ) );
+
+   y = B * z;  // Faster than A*x due to the improved locality
+   \endcode
+*/
+//*************************************************************************************************
+
+#endif
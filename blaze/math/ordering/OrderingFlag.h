@@ -0,0 +1,72 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/OrderingFlag.h
+//  \brief Header file for the ordering flags
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_ORDERINGFLAG_H_
+#define _BLAZE_MATH_ORDERING_ORDERINGFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ORDERING FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Ordering flag.
+// \ingroup ordering
+//
+// The OrderingFlag type enumeration represents the different fill-reducing orderings that can
+// be selected for sparse direct solvers (as for instance the SparseCholesky class template).
+// The following flags are available:
+//
+//  - \c naturalOrdering: The rows and columns of the matrix are not permuted.
+//  - \c minimumDegreeOrdering: The rows and columns are permuted by means of the approximate
+//          minimum degree algorithm (see the amd() function).
+//  - \c nestedDissectionOrdering: The rows and columns are permuted by means of nested
+//          dissection (see the nestedDissection() function). This ordering is recommended for
+//          matrices resulting from the discretization of 2D and 3D problems.
+*/
+enum OrderingFlag
+{
+   naturalOrdering          = 0,  //!< Flag for the natural (identity) ordering.
+   minimumDegreeOrdering    = 1,  //!< Flag for the approximate minimum degree ordering.
+   nestedDissectionOrdering = 2   //!< Flag for the nested dissection ordering.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,145 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/PartitionOrdering.h
+//  \brief Header file for the cache-block partition ordering
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_PARTITIONORDERING_H_
+#define _BLAZE_MATH_ORDERING_PARTITIONORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/ordering/AdjacencyGraph.h>
+#include <blaze/math/ordering/NestedDissection.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARTITION ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Partition ordering */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> partitionOrdering( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> partitionOrdering( const SparseMatrix<MT,SO>& A, size_t blockSize );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a cache-block ordering of the given sparse matrix.
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be ordered.
+// \return The permutation vector (new to old indices).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric permutation of the given sparse matrix by recursively
+// bisecting the graph of \f$ A+A^T \f$ into compact blocks of consecutive rows/columns (see
+// the partitionOrdering() function with explicit block size). The block size is chosen such
+// that the rows of a block together with the according elements of the left-hand side and
+// right-hand side vectors of a sparse matrix/vector multiplication fit into the cache (see
+// the BLAZE_CACHE_SIZE configuration).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> partitionOrdering( const SparseMatrix<MT,SO>& A )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( (~A).rows() );
+   const size_t elements( n > 0UL ? (~A).nonZeros() / n : 0UL );
+   const size_t bytes( ( elements + 2UL ) * ( sizeof(ET) + sizeof(size_t) ) );
+
+   return partitionOrdering( ~A, max( cacheSize / bytes, 1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a cache-block ordering of the given sparse matrix with the given block size.
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be ordered.
+// \param blockSize The maximum number of rows/columns per block.
+// \return The permutation vector (new to old indices).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric permutation of the given sparse matrix by recursively
+// bisecting the graph of \f$ A+A^T \f$ until each part contains at most \a blockSize vertices.
+// In contrast to nestedDissection(), the graph is split without separators: the breadth-first
+// order of each part, starting at a pseudo-peripheral vertex, is split into two halves. Thus
+// the rows and columns of each block are consecutive in the permuted matrix \f$ PAP^T \f$, the
+// columns referenced by the rows of a block mostly belong to the same block, and neighboring
+// blocks are placed next to each other. Within a block the vertices are kept in breadth-first
+// order:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( blaze::partitionOrdering( A, 4096UL ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, perm ) );
+   \endcode
+
+// In comparison to rcm(), which minimizes the bandwidth, the partition ordering additionally
+// bounds the working set of each block of rows, which also keeps the rows processed by
+// different threads of a parallel sparse matrix/vector multiplication apart. The \a k-th element
+// of the returned vector is the index of the row/column of \a A that becomes the \a k-th
+// row/column of the permuted matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> partitionOrdering( const SparseMatrix<MT,SO>& A, size_t blockSize )
+{
+   return dissect( AdjacencyGraph( ~A ), blockSize, false );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,250 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/Permutation.h
+//  \brief Header file for the symmetric permutation of sparse matrices and dense vectors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_PERMUTATION_H_
+#define _BLAZE_MATH_ORDERING_PERMUTATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <tuple>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PERMUTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Permutation functions */
+//@{
+inline std::vector<size_t> inversePermutation( const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+CompressedMatrix< ElementType_t<MT>, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+DynamicVector< ElementType_t<VT>, TF >
+   permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inverse of the given permutation vector.
+// \ingroup ordering
+//
+// \param perm The permutation vector (new to old indices).
+// \return The inverse permutation vector (old to new indices).
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the vector \a inv with \a inv[perm[k]] == \a k. The inverse permutation
+// reverts the effect of a permutation, i.e. \c permute(permute(x,perm),inversePermutation(perm))
+// restores the vector \a x. In case \a perm is not a permutation of the indices \f$[0..N-1]\f$,
+// a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> inversePermutation( const std::vector<size_t>& perm )
+{
+   const size_t n( perm.size() );
+   const size_t invalid( size_t(-1) );
+
+   std::vector<size_t> inv( n, invalid );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( perm[k] >= n || inv[perm[k]] != invalid ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+      }
+      inv[perm[k]] = k;
+   }
+
+   return inv;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of a square sparse matrix (\f$ B=PAP^T \f$).
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be permuted.
+// \param perm The permutation vector (new to old indices).
+// \return The permuted sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the sparse matrix \a B with \f$ B(i,j)=A(perm[i],perm[j]) \f$, which
+// has the same storage order as \a A. It is typically used to apply a reordering computed by
+// rcm(), partitionOrdering(), nestedDissection() or amd() once during the setup of a problem:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y, b;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, perm ) );
+   const blaze::DynamicVector<double> c( blaze::permute( b, perm ) );
+
+   // ... Solve B*y = c by means of any iterative solver
+
+   x = blaze::permute( y, blaze::inversePermutation( perm ) );
+   \endcode
+
+// All elements of \a A, including explicitly stored zeros, are moved to their new positions by
+// means of the parallel counting sort of the CompressedMatrix::setFromTriplets() function. The
+// generation of the relocated elements is executed in parallel as well in case the number of
+// non-zero elements exceeds the BLAZE_SMP_SMATTRANSPOSE_THRESHOLD.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix< ElementType_t<MT>, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   using ET = ElementType_t<MT>;
+   using Triplet = std::tuple<size_t,size_t,ET>;
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( perm.size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   const std::vector<size_t> inv( inversePermutation( perm ) );
+
+   CompositeType_t<MT> tmp( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( perm.size() );
+
+   std::vector<size_t> offsets( n+1UL, 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      offsets[i+1UL] = offsets[i] + tmp.nonZeros(i);
+   }
+
+   std::vector<Triplet> triplets( offsets[n] );
+
+   const size_t T( ( offsets[n] < SMP_SMATTRANSPOSE_THRESHOLD )
+                   ?( 1UL )
+                   :( min( getNumThreads(), n ) ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t i=t*n/T; i<(t+1UL)*n/T; ++i )
+      {
+         size_t pos( offsets[i] );
+
+         for( auto element=tmp.begin(i); element!=tmp.end(i); ++element, ++pos ) {
+            const size_t row( SO ? element->index() : i );
+            const size_t col( SO ? i : element->index() );
+            triplets[pos] = Triplet( inv[row], inv[col], element->value() );
+         }
+      }
+   } );
+
+   CompressedMatrix<ET,SO> B( n, n );
+   B.setFromTriplets( triplets.begin(), triplets.end() );
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of a dense vector (\f$ \vec{y}=P\vec{x} \f$).
+// \ingroup ordering
+//
+// \param x The dense vector to be permuted.
+// \param perm The permutation vector (new to old indices).
+// \return The permuted dense vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function returns the dense vector \a y with \f$ y[k]=x[perm[k]] \f$, i.e. the vector
+// that matches the permuted matrix \f$ PAP^T \f$ computed by the permute() function for sparse
+// matrices. A permuted vector can be restored by means of the inverse permutation (see the
+// inversePermutation() function). The elements are gathered in parallel in case the size of
+// the vector exceeds the BLAZE_SMP_DVECASSIGN_THRESHOLD. Note that \a perm is required to be a
+// permutation of the indices \f$[0..N-1]\f$, which is only checked by a user assertion.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DynamicVector< ElementType_t<VT>, TF >
+   permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm )
+{
+   const size_t n( (~x).size() );
+
+   if( perm.size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   CompositeType_t<VT> tmp( ~x );  // Evaluation of the dense vector operand
+
+   DynamicVector< ElementType_t<VT>, TF > y( n );
+
+   const size_t T( ( n < SMP_DVECASSIGN_THRESHOLD )?( 1UL ):( min( getNumThreads(), n ) ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t k=t*n/T; k<(t+1UL)*n/T; ++k ) {
+         BLAZE_USER_ASSERT( perm[k] < n, "Invalid permutation index" );
+         y[k] = tmp[perm[k]];
+      }
+   } );
+
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,213 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ordering/RCM.h
+//  \brief Header file for the reverse Cuthill-McKee ordering
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ORDERING_RCM_H_
+#define _BLAZE_MATH_ORDERING_RCM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/ordering/AdjacencyGraph.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REVERSE CUTHILL-MCKEE ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reverse Cuthill-McKee ordering */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the reverse Cuthill-McKee ordering of the given adjacency graph.
+// \ingroup ordering
+//
+// \param graph The adjacency graph.
+// \return The permutation vector (new to old indices).
+//
+// This function numbers the vertices of each connected component in breadth-first order,
+// starting at a pseudo-peripheral vertex of the component and visiting the unnumbered neighbors
+// of each vertex in the order of increasing degree (Cuthill-McKee). The pseudo-peripheral vertex
+// is determined by the algorithm of George and Liu, starting from the first unnumbered vertex.
+// Finally, the resulting order is reversed, which results in the same bandwidth, but typically
+// in a smaller profile.
+*/
+inline std::vector<size_t> rcm( const AdjacencyGraph& graph )
+{
+   const size_t n( graph.vertices() );
+   const size_t invalid( size_t(-1) );
+
+   std::vector<size_t> perm;
+   std::vector<size_t> level( n, invalid );
+   std::vector<bool> numbered( n, false );
+   std::vector<size_t> queue;
+   std::vector<size_t> neighbors;
+
+   perm.reserve( n );
+   queue.reserve( n );
+
+   // Cuthill-McKee search within the component of the given root
+   const auto search = [&]( size_t root )
+   {
+      for( size_t v : queue ) {
+         level[v] = invalid;
+      }
+
+      queue.clear();
+      queue.push_back( root );
+      level[root] = 0UL;
+
+      for( size_t k=0UL; k<queue.size(); ++k )
+      {
+         const size_t v( queue[k] );
+
+         neighbors.clear();
+         for( const size_t* u=graph.begin(v); u!=graph.end(v); ++u ) {
+            if( level[*u] == invalid ) {
+               level[*u] = level[v] + 1UL;
+               neighbors.push_back( *u );
+            }
+         }
+
+         std::sort( neighbors.begin(), neighbors.end(), [&graph]( size_t a, size_t b ) {
+            const size_t da( graph.degree(a) );
+            const size_t db( graph.degree(b) );
+            return da < db || ( da == db && a < b );
+         } );
+
+         queue.insert( queue.end(), neighbors.begin(), neighbors.end() );
+      }
+
+      return level[queue.back()] + 1UL;
+   };
+
+   for( size_t start=0UL; start<n; ++start )
+   {
+      if( numbered[start] )
+         continue;
+
+      // Search for a pseudo-peripheral vertex
+      size_t root( start );
+      size_t depth( search( root ) );
+
+      while( true )
+      {
+         const size_t last( level[queue.back()] );
+
+         size_t candidate( queue.back() );
+         for( size_t k=queue.size(); k-- > 0UL && level[queue[k]] == last; ) {
+            if( graph.degree( queue[k] ) < graph.degree( candidate ) )
+               candidate = queue[k];
+         }
+
+         const size_t candidateDepth( search( candidate ) );
+
+         if( candidateDepth <= depth ) {
+            search( root );
+            break;
+         }
+
+         root  = candidate;
+         depth = candidateDepth;
+      }
+
+      for( size_t v : queue ) {
+         numbered[v] = true;
+         perm.push_back( v );
+      }
+   }
+
+   std::reverse( perm.begin(), perm.end() );
+
+   return perm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a bandwidth and profile reducing ordering of the given sparse matrix by means
+//        of the reverse Cuthill-McKee algorithm.
+// \ingroup ordering
+//
+// \param A The square sparse matrix to be ordered.
+// \return The permutation vector (new to old indices).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric permutation of the given sparse matrix that clusters the
+// non-zero elements of \f$ PAP^T \f$ close to the diagonal. Since consecutive rows of the
+// permuted matrix refer to nearby columns, the accesses to the right-hand side vector of a
+// sparse matrix/vector multiplication are mostly served from cache:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, perm ) );
+
+   y = B * blaze::permute( x, perm );  // Permuted result P*A*x
+   \endcode
+
+// The \a k-th element of the returned vector is the index of the row/column of \a A that
+// becomes the \a k-th row/column of the permuted matrix \f$ PAP^T \f$.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A )
+{
+   return rcm( AdjacencyGraph( ~A ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
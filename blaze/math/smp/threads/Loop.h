@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Loop.h
+//  \brief Header file for the C++11/Boost thread-based SMP loop functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_LOOP_H_
+#define _BLAZE_MATH_SMP_THREADS_LOOP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP loop functions */
+//@{
+template< typename OP >
+void smpFor( size_t n, OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP loop.
+// \ingroup smp
+//
+// \param n The number of tasks to be executed.
+// \param op The task to be executed for each index \f$[0..n-1]\f$.
+// \return void
+//
+// This function executes the given task \a op for each index in the range \f$[0..n-1]\f$ by
+// means of the C++11/Boost thread pool. In case a serial section or a parallel section is
+// active, all tasks are executed sequentially. Since the tasks are executed within a parallel
+// section, they must not trigger any SMP assignment and must not throw any exception.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of algorithms that cannot be expressed by means of SMP assignments.
+*/
+template< typename OP >  // Type of the task
+void smpFor( size_t n, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( n < 2UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         op( i );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<n; ++i ) {
+         TheThreadBackend::schedule( [&op,i]() { op( i ); } );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -100,6 +100,9 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void schedule( OP op );
    //@}
    //**********************************************************************************************
 
@@ -297,6 +300,28 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution.
+//
+// \param op The task to be executed.
+// \return void
+//
+// This function schedules the given task for execution.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( OP op )
+{
+   threadpool_.schedule( op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,429 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Arnoldi.h
+//  \brief Header file for the implicitly restarted Arnoldi method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+#define _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovBasis.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/solvers/SpectrumFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  IMPLICITLY RESTARTED ARNOLDI METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Implicitly restarted Arnoldi method */
+//@{
+template< typename OP, typename VT, bool TF, typename MT, bool SO >
+SolverResult arnoldi( const OP& A, DenseVector<VT,TF>& w, DenseMatrix<MT,SO>& X, size_t nev,
+                      SpectrumFlag which = largestMagnitude,
+                      const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the element type of the Krylov basis of the Arnoldi method.
+// \ingroup solvers
+//
+// In case the operator is a matrix, the basis is of the same element type as the matrix, i.e.
+// the basis of a real matrix is real. In case of a user-defined operator, the basis is of the
+// (complex) element type of the eigenvector matrix.
+*/
+template< typename OP          // Type of the linear operator
+        , typename ET          // Element type of the eigenvector matrix
+        , typename = void >    // Restricting condition
+struct ArnoldiBasisElement
+{
+   using Type = ET;
+};
+
+template< typename OP, typename ET >
+struct ArnoldiBasisElement< OP, ET, EnableIf_t< IsMatrix_v<OP> > >
+{
+   using Type = ElementType_t<OP>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Applies the orthogonal transformation of a QR step to the projected Arnoldi matrix.
+// \ingroup solvers
+//
+// \param H The projected upper Hessenberg matrix.
+// \param Q The accumulated transformation.
+// \param M The shifted matrix polynomial to be factorized.
+// \return void
+*/
+template< typename MT >  // Type of the matrices
+void arnoldiQRStep( MT& H, MT& Q, const MT& M )
+{
+   MT Qs, R;
+
+   qr( M, Qs, R );
+
+   H = ctrans( Qs ) * H * Qs;
+   Q = Q * Qs;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Applies an exact shift to the real projected Arnoldi matrix.
+// \ingroup solvers
+//
+// \param H The real projected upper Hessenberg matrix.
+// \param Q The accumulated orthogonal transformation.
+// \param mu The (complex) shift.
+// \return void
+//
+// In order to keep the computation in real arithmetic, a complex shift is applied together
+// with its complex conjugate by means of a double shift, i.e. the QR step is performed for
+// \f$ H^2-2\Re(\mu)H+|\mu|^2I \f$. The shift with negative imaginary part is skipped.
+*/
+template< typename MT     // Type of the matrices
+        , typename CT >   // Type of the shift
+EnableIf_t< !IsComplex_v< ElementType_t<MT> > > arnoldiShift( MT& H, MT& Q, const CT& mu )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t m( H.rows() );
+
+   MT M;
+
+   if( imag( mu ) < ET(0) ) {
+      return;
+   }
+   else if( imag( mu ) > ET(0) ) {
+      M = H * H - ET( 2 ) * ET( real( mu ) ) * H;
+      for( size_t i=0UL; i<m; ++i ) {
+         M(i,i) += ET( real( mu ) * real( mu ) + imag( mu ) * imag( mu ) );
+      }
+   }
+   else {
+      M = H;
+      for( size_t i=0UL; i<m; ++i ) {
+         M(i,i) -= ET( real( mu ) );
+      }
+   }
+
+   arnoldiQRStep( H, Q, M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Applies an exact shift to the complex projected Arnoldi matrix.
+// \ingroup solvers
+//
+// \param H The complex projected upper Hessenberg matrix.
+// \param Q The accumulated unitary transformation.
+// \param mu The shift.
+// \return void
+*/
+template< typename MT     // Type of the matrices
+        , typename CT >   // Type of the shift
+EnableIf_t< IsComplex_v< ElementType_t<MT> > > arnoldiShift( MT& H, MT& Q, const CT& mu )
+{
+   const size_t m( H.rows() );
+
+   MT M( H );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      M(i,i) -= mu;
+   }
+
+   arnoldiQRStep( H, Q, M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of the given general matrix by means of the implicitly
+//        restarted Arnoldi method.
+// \ingroup solvers
+//
+// \param A The general matrix or a user-defined linear operator.
+// \param w The resulting vector of the \a nev selected (complex) eigenvalues.
+// \param X The resulting \f$ n \times nev \f$ matrix of the corresponding (complex) eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param which The selected part of the spectrum.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the \a nev eigenvalues of the general \f$ n \times n \f$ matrix \a A
+// that are selected by \a which (see the SpectrumFlag enumeration), together with the right
+// eigenvectors of unit length, which are stored in the columns of \a X. Since the eigenvalues
+// of a general matrix are complex, both \a w and \a X must have complex element type. The
+// eigenvalues are sorted starting with the most wanted one. Complex conjugate eigenvalues of
+// a real matrix are stored consecutively, starting with the eigenvalue with positive imaginary
+// part.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization of the general matrix A
+
+   blaze::DynamicVector< blaze::complex<double> > w;
+   blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > X;
+
+   blaze::arnoldi( A, w, X, 6UL, blaze::largestMagnitude );
+   \endcode
+
+// The function builds an orthonormal Krylov basis of at most \a settings.restart vectors (but
+// at least \f$ 2 \cdot nev+1 \f$ vectors) by means of the Arnoldi process. The basis vectors are
+// orthogonalized by means of the classical Gram-Schmidt process with reorthogonalization, which
+// reads the basis only twice per iteration and performs all projections as parallel dense
+// matrix/vector products. As soon as the basis is full, the unwanted Ritz values are used as
+// exact shifts of QR steps on the small projected Hessenberg matrix, which filters the unwanted
+// directions out of the basis (implicit restart). The compressed basis is computed by a single
+// dense matrix multiplication of the basis with the accumulated transformation. The basis of a
+// real matrix is kept real by applying complex shifts in conjugate pairs. The iteration stops as
+// soon as the residuals \f$ \|A\vec{x}_i-\lambda_i\vec{x}_i\|_2 \f$ of all requested eigenpairs
+// drop below \a settings.tolerance times the largest computed eigenvalue magnitude or after
+// \a settings.maxIterations applications of the operator, whatever happens first. In the latter
+// case the current approximations are returned.
+//
+// Instead of a matrix, \a A can be any callable that assigns the result of \f$ A\vec{v} \f$ to
+// \a y when called as \c A(v,y), where \a v is a column of the column-major Krylov basis. In
+// this case the size \a n of the problem is given by the number of rows of \a X and the basis
+// is of the element type of \a X. Eigenvalues in the interior of the spectrum can be computed
+// by means of a shift-and-invert operator (see the lanczos() function).
+//
+// \note The projected eigenvalue problems are solved by means of the eigen() and qr() functions,
+// i.e. this function can only be used if a fitting LAPACK library is available and linked to
+// the executable.
+*/
+template< typename OP  // Type of the linear operator
+        , typename VT  // Type of the eigenvalue vector
+        , bool TF      // Transpose flag of the eigenvalue vector
+        , typename MT  // Type of the eigenvector matrix
+        , bool SO >    // Storage order of the eigenvector matrix
+SolverResult arnoldi( const OP& A, DenseVector<VT,TF>& w, DenseMatrix<MT,SO>& X, size_t nev,
+                      SpectrumFlag which, const SolverSettings& settings )
+{
+   using CT = ElementType_t<MT>;
+   using ET = typename ArnoldiBasisElement<OP,CT>::Type;
+
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( CT );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_t<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   const size_t n( operatorSize( A, (~X).rows() ) );
+
+   checkOperator( A, n );
+
+   if( nev > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   resize( ~w, nev, false );
+   resize( ~X, n, nev, false );
+
+   SolverResult result;
+
+   if( nev == 0UL ) {
+      result.converged = true;
+      return result;
+   }
+
+   const size_t m( min( n, max( settings.restart, 2UL*nev+1UL ) ) );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL ), U( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m, ET(0) ), Hm, Q;
+   DynamicMatrix<CT,columnMajor> Y, Ys;
+   DynamicVector<ET> v( n ), h( m+1UL ), c( m+1UL );
+   DynamicVector<CT> theta;
+   std::vector<size_t> order;
+
+   randomKrylovVector( V, 0UL, c, v );
+
+   size_t j( 0UL );
+
+   while( true )
+   {
+      // Arnoldi process
+      while( j < m && result.iterations < settings.maxIterations ) {
+         const double beta( expandKrylovBasis( A, V, j, h, c, v ) );
+         for( size_t i=0UL; i<=j; ++i ) {
+            H(i,j) = h[i];
+         }
+         H(j+1UL,j) = ET( beta );
+         ++result.iterations;
+         ++j;
+      }
+
+      // Rayleigh-Ritz procedure on the projected matrix
+      Hm = submatrix( H, 0UL, 0UL, j, j, unchecked );
+      eigen( Hm, theta, Y );
+      order = ritzOrder( theta, which );
+
+      double anorm( 0.0 );
+      for( size_t i=0UL; i<j; ++i ) {
+         anorm = max( anorm, abs( theta[i] ) );
+      }
+
+      const double beta( abs( H(j,j-1UL) ) );
+
+      double res( 0.0 );
+      for( size_t p=0UL; p<min( nev, j ); ++p ) {
+         res = max( res, beta * abs( Y(j-1UL,order[p]) ) );
+      }
+
+      result.residual  = ( anorm > 0.0 ? res / anorm : res );
+      result.converged = ( j >= nev && res <= settings.tolerance * anorm );
+
+      if( result.converged || result.iterations >= settings.maxIterations )
+         break;
+
+      // Implicit restart with the unwanted Ritz values as exact shifts
+      size_t k( min( max( nev, ( nev + j ) / 2UL ), j-1UL ) );
+
+      if( !IsComplex_v<ET> && imag( theta[order[k-1UL]] ) > 0.0 ) {
+         if( k+1UL < j ) ++k;
+         else --k;
+      }
+
+      Q.resize( j, j, false );
+      reset( Q );
+      for( size_t i=0UL; i<j; ++i ) {
+         Q(i,i) = ET(1);
+      }
+
+      for( size_t p=k; p<j; ++p ) {
+         arnoldiShift( Hm, Q, theta[order[p]] );
+      }
+
+      submatrix( U, 0UL, 0UL, n, k+1UL, unchecked ) =
+         submatrix( V, 0UL, 0UL, n, j, unchecked ) * submatrix( Q, 0UL, 0UL, j, k+1UL, unchecked );
+
+      v = column( U, k, unchecked ) * Hm(k,k-1UL) +
+          column( V, j, unchecked ) * ( H(j,j-1UL) * Q(j-1UL,k-1UL) );
+      swap( U, V );
+
+      reset( H );
+      for( size_t l=0UL; l<k; ++l ) {
+         for( size_t i=0UL; i<=min( l+1UL, k-1UL ); ++i ) {
+            H(i,l) = Hm(i,l);
+         }
+      }
+
+      const double vn( krylovNorm( v ) );
+
+      if( vn > 0.0 ) {
+         column( V, k, unchecked ) = v * ET( 1.0 / vn );
+         H(k,k-1UL) = ET( vn );
+      }
+      else {
+         randomKrylovVector( V, k, c, v );
+      }
+
+      j = k;
+   }
+
+   // Computation of the Ritz vectors
+   const size_t nconv( min( nev, j ) );
+
+   Ys.resize( j, nconv, false );
+   for( size_t p=0UL; p<nconv; ++p ) {
+      (~w)[p] = theta[order[p]];
+      column( Ys, p, unchecked ) = column( Y, order[p], unchecked );
+   }
+
+   submatrix( ~X, 0UL, 0UL, n, nconv ) = submatrix( V, 0UL, 0UL, n, j, unchecked ) * Ys;
+
+   for( size_t p=nconv; p<nev; ++p ) {
+      reset( (~w)[p] );
+      reset( column( ~X, p ) );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,431 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the stabilized biconjugate gradient method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  STABILIZED BICONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Stabilized biconjugate gradient method */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PC& M, const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general system by means of the stabilized biconjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the stabilized
+// biconjugate gradient method (BiCGSTAB), starting from the given initial guess \a x. The
+// iteration stops as soon as the relative residual \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$
+// drops below the tolerance of the given \a settings, after the maximum number of iterations,
+// or in case of a breakdown of the method (in which case the result is not converged). Instead
+// of a matrix, \a A can be any callable that assigns the result of \f$ A\vec{v} \f$ to \a y
+// when called as \c A(v,y).
+//
+// Per iteration, the method performs two applications of \a A and five fused sweeps through
+// the vectors. In particular, the updates of \f$ \vec{x} \f$ and \f$ \vec{r} \f$ are combined
+// with the computation of the new residual norm and of the inner product required for the
+// next iteration.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+
+   checkOperator( A, n );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SolverResult result;
+
+   DynamicVector<ET> r( n ), r0( n ), p( n ), v( n ), s( n ), t( n );
+
+   applyOperator( A, ~x, v );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   {
+      const auto results( fusedSweep<ET,2UL>( n, 5UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, size, unchecked ) );
+         auto rs ( subvector( r , i, size, unchecked ) );
+         auto r0s( subvector( r0, i, size, unchecked ) );
+         auto ps ( subvector( p , i, size, unchecked ) );
+         assign( rs, bs - subvector( v, i, size, unchecked ) );
+         assign( r0s, rs );
+         assign( ps, rs );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( rs ), rs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+   }
+
+   if( bb == 0.0 ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const double limit( settings.tolerance * settings.tolerance * bb );
+
+   ET rho( rr );
+
+   while( rr > limit && result.iterations < settings.maxIterations && !isDefault<strict>( rho ) )
+   {
+      applyOperator( A, p, v );
+
+      const ET r0v( fusedSweep<ET,1UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         const auto r0s( subvector( r0, i, size, unchecked ) );
+         sums[0UL] += dot( conj( r0s ), subvector( v, i, size, unchecked ) );
+      } )[0UL] );
+
+      if( isDefault<strict>( r0v ) )
+         break;
+
+      const ET alpha( rho / r0v );
+
+      const double ss( real( fusedSweep<ET,1UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         auto sb( subvector( s, i, size, unchecked ) );
+         const auto vs( subvector( v, i, size, unchecked ) );
+         assign( sb, subvector( r, i, size, unchecked ) - alpha * vs );
+         sums[0UL] += dot( conj( sb ), sb );
+      } )[0UL] ) );
+
+      ++result.iterations;
+
+      if( ss <= limit ) {
+         fusedSweep<ET,0UL>( n, 3UL*sizeof(ET),
+            [&]( size_t i, size_t size, std::array<ET,0UL>& )
+         {
+            auto xs( subvector( ~x, i, size, unchecked ) );
+            addAssign( xs, alpha * subvector( p, i, size, unchecked ) );
+         } );
+         rr = ss;
+         break;
+      }
+
+      applyOperator( A, s, t );
+
+      const auto ts( fusedSweep<ET,2UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         const auto tb( subvector( t, i, size, unchecked ) );
+         sums[0UL] += dot( conj( tb ), tb );
+         sums[1UL] += dot( conj( tb ), subvector( s, i, size, unchecked ) );
+      } ) );
+
+      if( isDefault<strict>( ts[0UL] ) )
+         break;
+
+      const ET omega( ts[1UL] / ts[0UL] );
+
+      const auto results( fusedSweep<ET,2UL>( n, 8UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         auto xs( subvector( ~x, i, size, unchecked ) );
+         auto rs( subvector( r , i, size, unchecked ) );
+         const auto sb( subvector( s, i, size, unchecked ) );
+         addAssign( xs, alpha * subvector( p, i, size, unchecked ) + omega * sb );
+         assign( rs, sb - omega * subvector( t, i, size, unchecked ) );
+         sums[0UL] += dot( conj( rs ), rs );
+         sums[1UL] += dot( conj( subvector( r0, i, size, unchecked ) ), rs );
+      } ) );
+
+      rr = real( results[0UL] );
+
+      if( rr <= limit || isDefault<strict>( omega ) )
+         break;
+
+      const ET beta( ( results[1UL] / rho ) * ( alpha / omega ) );
+
+      rho = results[1UL];
+
+      fusedSweep<ET,0UL>( n, 4UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,0UL>& )
+      {
+         auto ps( subvector( p, i, size, unchecked ) );
+         assign( ps, subvector( r, i, size, unchecked ) +
+                     beta * ( ps - omega * subvector( v, i, size, unchecked ) ) );
+      } );
+   }
+
+   result.residual  = std::sqrt( rr / bb );
+   result.converged = ( rr <= limit );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general system by means of the right-preconditioned stabilized
+//        biconjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param M The preconditioner.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the stabilized
+// biconjugate gradient method, where the system is preconditioned from the right with \a M.
+// The preconditioner can be any object that provides an \c apply(r,z) member function
+// computing \f$ \vec{z}=M^{-1}\vec{r} \f$, as for instance the ILUPreconditioner or the
+// BlockJacobiPreconditioner. Due to the right preconditioning, the convergence criterion is
+// based on the unpreconditioned residual \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+
+   checkOperator( A, n );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SolverResult result;
+
+   DynamicVector<ET> r( n ), r0( n ), p( n ), ph( n ), v( n ), s( n ), sh( n ), t( n );
+
+   applyOperator( A, ~x, v );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   {
+      const auto results( fusedSweep<ET,2UL>( n, 5UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, size, unchecked ) );
+         auto rs ( subvector( r , i, size, unchecked ) );
+         auto r0s( subvector( r0, i, size, unchecked ) );
+         auto ps ( subvector( p , i, size, unchecked ) );
+         assign( rs, bs - subvector( v, i, size, unchecked ) );
+         assign( r0s, rs );
+         assign( ps, rs );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( rs ), rs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+   }
+
+   if( bb == 0.0 ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const double limit( settings.tolerance * settings.tolerance * bb );
+
+   ET rho( rr );
+
+   while( rr > limit && result.iterations < settings.maxIterations && !isDefault<strict>( rho ) )
+   {
+      M.apply( p, ph );
+      applyOperator( A, ph, v );
+
+      const ET r0v( fusedSweep<ET,1UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         const auto r0s( subvector( r0, i, size, unchecked ) );
+         sums[0UL] += dot( conj( r0s ), subvector( v, i, size, unchecked ) );
+      } )[0UL] );
+
+      if( isDefault<strict>( r0v ) )
+         break;
+
+      const ET alpha( rho / r0v );
+
+      const double ss( real( fusedSweep<ET,1UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         auto sb( subvector( s, i, size, unchecked ) );
+         const auto vs( subvector( v, i, size, unchecked ) );
+         assign( sb, subvector( r, i, size, unchecked ) - alpha * vs );
+         sums[0UL] += dot( conj( sb ), sb );
+      } )[0UL] ) );
+
+      ++result.iterations;
+
+      if( ss <= limit ) {
+         fusedSweep<ET,0UL>( n, 3UL*sizeof(ET),
+            [&]( size_t i, size_t size, std::array<ET,0UL>& )
+         {
+            auto xs( subvector( ~x, i, size, unchecked ) );
+            addAssign( xs, alpha * subvector( ph, i, size, unchecked ) );
+         } );
+         rr = ss;
+         break;
+      }
+
+      M.apply( s, sh );
+      applyOperator( A, sh, t );
+
+      const auto ts( fusedSweep<ET,2UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         const auto tb( subvector( t, i, size, unchecked ) );
+         sums[0UL] += dot( conj( tb ), tb );
+         sums[1UL] += dot( conj( tb ), subvector( s, i, size, unchecked ) );
+      } ) );
+
+      if( isDefault<strict>( ts[0UL] ) )
+         break;
+
+      const ET omega( ts[1UL] / ts[0UL] );
+
+      const auto results( fusedSweep<ET,2UL>( n, 9UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         auto xs( subvector( ~x, i, size, unchecked ) );
+         auto rs( subvector( r , i, size, unchecked ) );
+         const auto phs( subvector( ph, i, size, unchecked ) );
+         const auto shs( subvector( sh, i, size, unchecked ) );
+         addAssign( xs, alpha * phs + omega * shs );
+         const auto sb( subvector( s, i, size, unchecked ) );
+         const auto tb( subvector( t, i, size, unchecked ) );
+         assign( rs, sb - omega * tb );
+         sums[0UL] += dot( conj( rs ), rs );
+         sums[1UL] += dot( conj( subvector( r0, i, size, unchecked ) ), rs );
+      } ) );
+
+      rr = real( results[0UL] );
+
+      if( rr <= limit || isDefault<strict>( omega ) )
+         break;
+
+      const ET beta( ( results[1UL] / rho ) * ( alpha / omega ) );
+
+      rho = results[1UL];
+
+      fusedSweep<ET,0UL>( n, 4UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,0UL>& )
+      {
+         auto ps( subvector( p, i, size, unchecked ) );
+         assign( ps, subvector( r, i, size, unchecked ) +
+                     beta * ( ps - omega * subvector( v, i, size, unchecked ) ) );
+      } );
+   }
+
+   result.residual  = std::sqrt( rr / bb );
+   result.converged = ( rr <= limit );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
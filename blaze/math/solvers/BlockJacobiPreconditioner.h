@@ -0,0 +1,320 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BlockJacobiPreconditioner.h
+//  \brief Header file for the BlockJacobiPreconditioner class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/InversionFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block Jacobi preconditioner.
+// \ingroup solvers
+//
+// The BlockJacobiPreconditioner class approximates a sparse matrix \f$ A \f$ by its
+// \f$ B \times B \f$ diagonal blocks. The blocks are extracted and inverted once during the
+// construction by means of the closed-form inversion kernels for small matrices, therefore
+// the block size is restricted to \f$ 1 \leq B \leq 6 \f$. In case the size of the matrix is
+// not a multiple of \a B, the last block is smaller. The application of the preconditioner
+// multiplies each block of the given vector with the according inverted block:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::BlockJacobiPreconditioner<double,3UL> M( A );
+   blaze::gmres( A, x, b, M );
+   \endcode
+
+// This preconditioner is particularly suited for systems with several unknowns per node, as
+// for instance in finite element methods for elasticity problems. Both the setup and the
+// application are executed in parallel in case a shared memory parallelization is enabled.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Block size
+class BlockJacobiPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using BlockType = StaticMatrix<Type,B,B,rowMajor>;  //!< Type of the inverted blocks.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline BlockJacobiPreconditioner( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void invertBlock( BlockType& block );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                                                   //!< The size of the preconditioner.
+   std::vector<BlockType,AlignedAllocator<BlockType>> blocks_;  //!< The inverted diagonal blocks.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( B >= 1UL && B <= 6UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the block Jacobi preconditioner for the given sparse matrix.
+//
+// \param A The sparse matrix to be preconditioned.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Singular diagonal block detected.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Block size
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline BlockJacobiPreconditioner<Type,B>::BlockJacobiPreconditioner( const SparseMatrix<MT,SO>& A )
+   : n_     ( (~A).rows() )  // The size of the preconditioner
+   , blocks_()               // The inverted diagonal blocks
+{
+   if( (~A).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t blocks( ( n_ + B - 1UL ) / B );
+
+   blocks_.resize( blocks );
+
+   std::atomic<bool> singular( false );
+   const size_t R( smpRanges( n_, SMP_DVECASSIGN_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*blocks/R );
+      const size_t end  ( (range+1UL)*blocks/R );
+
+      for( size_t k=begin; k<end; ++k )
+      {
+         BlockType& block( blocks_[k] );
+         const size_t size( min( B, n_ - k*B ) );
+
+         for( size_t i=0UL; i<B; ++i ) {
+            for( size_t j=0UL; j<B; ++j ) {
+               if( i < size && j < size )
+                  block(i,j) = (~A)(k*B+i,k*B+j);
+               else
+                  block(i,j) = ( i == j ? Type(1) : Type() );
+            }
+         }
+
+         try {
+            invertBlock( block );
+         }
+         catch( const std::exception& ) {
+            singular = true;
+         }
+      }
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Singular diagonal block detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioner.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Block size
+inline size_t BlockJacobiPreconditioner<Type,B>::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=D^{-1}\vec{r} \f$).
+//
+// \param r The vector the preconditioner is applied to.
+// \param z The resulting vector.
+// \return void
+//
+// The vectors \a r and \a z may refer to the same vector.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Block size
+template< typename VT1   // Type of the right-hand side vector
+        , typename VT2 > // Type of the target vector
+inline void BlockJacobiPreconditioner<Type,B>::apply( const DenseVector<VT1,false>& r,
+                                                      DenseVector<VT2,false>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == n_, "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~z).size() == n_, "Invalid vector size detected" );
+
+   const size_t blocks( blocks_.size() );
+   const size_t R( smpRanges( n_, SMP_DVECASSIGN_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*blocks/R );
+      const size_t end  ( (range+1UL)*blocks/R );
+
+      StaticVector<Type,B> tmp;
+
+      for( size_t k=begin; k<end; ++k )
+      {
+         const size_t size( min( B, n_ - k*B ) );
+
+         for( size_t i=0UL; i<size; ++i ) {
+            tmp[i] = (~r)[k*B+i];
+         }
+
+         const StaticVector<Type,B> res( blocks_[k] * tmp );
+
+         for( size_t i=0UL; i<size; ++i ) {
+            (~z)[k*B+i] = res[i];
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a single diagonal block.
+//
+// \param block The block to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Block size
+inline void BlockJacobiPreconditioner<Type,B>::invertBlock( BlockType& block )
+{
+   switch( B ) {
+      case 1UL:
+         if( isDefault<strict>( block(0,0) ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+         }
+         invert( block(0,0) );
+         break;
+      case 2UL: invert2x2<asGeneral>( block ); break;
+      case 3UL: invert3x3<asGeneral>( block ); break;
+      case 4UL: invert4x4<asGeneral>( block ); break;
+      case 5UL: invert5x5<asGeneral>( block ); break;
+      case 6UL: invert6x6<asGeneral>( block ); break;
+      default: BLAZE_INTERNAL_ASSERT( false, "Unhandled case detected" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
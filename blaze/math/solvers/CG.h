@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient method */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PC& M, const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric (Hermitian) positive definite system by means of the
+//        conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the conjugate
+// gradient method, starting from the given initial guess \a x. The iteration stops as soon as
+// the relative residual \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$ drops below the tolerance
+// of the given \a settings or after the maximum number of iterations. The system matrix \a A
+// is expected to be symmetric (Hermitian) and positive definite; this is not checked. Instead
+// of a matrix, \a A can be any callable that assigns the result of \f$ A\vec{v} \f$ to \a y
+// when called as \c A(v,y):
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL );
+   // ... Initialization of A and b
+
+   const blaze::SolverResult result( blaze::cg( A, x, b ) );
+
+   if( !result.converged ) {
+      // ... Error handling
+   }
+   \endcode
+
+// Per iteration, the method performs one application of \a A and three fused sweeps through
+// the vectors: the first one computes \f$ \vec{p}^H A\vec{p} \f$, the second one updates both
+// \f$ \vec{x} \f$ and \f$ \vec{r} \f$ and computes the new residual norm, and the third one
+// updates the search direction \f$ \vec{p} \f$.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+
+   checkOperator( A, n );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SolverResult result;
+
+   DynamicVector<ET> r( n ), p( n ), q( n );
+
+   applyOperator( A, ~x, q );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   {
+      const auto results( fusedSweep<ET,2UL>( n, 4UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, s, unchecked ) );
+         auto rs( subvector( r, i, s, unchecked ) );
+         auto ps( subvector( p, i, s, unchecked ) );
+         assign( rs, bs - subvector( q, i, s, unchecked ) );
+         assign( ps, rs );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( rs ), rs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+   }
+
+   if( bb == 0.0 ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const double limit( settings.tolerance * settings.tolerance * bb );
+
+   while( rr > limit && result.iterations < settings.maxIterations )
+   {
+      applyOperator( A, p, q );
+
+      const ET pq( fusedSweep<ET,1UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         const auto ps( subvector( p, i, s, unchecked ) );
+         sums[0UL] += dot( conj( ps ), subvector( q, i, s, unchecked ) );
+      } )[0UL] );
+
+      if( isDefault<strict>( pq ) )
+         break;
+
+      const ET alpha( ET( rr ) / pq );
+
+      const double rrOld( rr );
+
+      rr = real( fusedSweep<ET,1UL>( n, 6UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         auto xs( subvector( ~x, i, s, unchecked ) );
+         auto rs( subvector( r, i, s, unchecked ) );
+         addAssign( xs, alpha * subvector( p, i, s, unchecked ) );
+         subAssign( rs, alpha * subvector( q, i, s, unchecked ) );
+         sums[0UL] += dot( conj( rs ), rs );
+      } )[0UL] );
+
+      ++result.iterations;
+
+      if( rr <= limit )
+         break;
+
+      const ET beta( rr / rrOld );
+
+      fusedSweep<ET,0UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,0UL>& )
+      {
+         auto ps( subvector( p, i, s, unchecked ) );
+         assign( ps, subvector( r, i, s, unchecked ) + beta * ps );
+      } );
+   }
+
+   result.residual  = std::sqrt( rr / bb );
+   result.converged = ( rr <= limit );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric (Hermitian) positive definite system by means of the
+//        preconditioned conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the conjugate
+// gradient method preconditioned with \a M. The preconditioner can be any object that provides
+// an \c apply(r,z) member function computing \f$ \vec{z}=M^{-1}\vec{r} \f$, as for instance the
+// JacobiPreconditioner, the ICPreconditioner, or the SSORPreconditioner:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL );
+   // ... Initialization of A and b
+
+   const blaze::ICPreconditioner<double> M( A );
+   const blaze::SolverResult result( blaze::cg( A, x, b, M ) );
+   \endcode
+
+// The convergence criterion is based on the unpreconditioned residual
+// \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$. Per iteration, the method performs one
+// application of \a A and \a M each and four fused sweeps through the vectors.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+
+   checkOperator( A, n );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SolverResult result;
+
+   DynamicVector<ET> r( n ), z( n ), p( n ), q( n );
+
+   applyOperator( A, ~x, q );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   {
+      const auto results( fusedSweep<ET,2UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, s, unchecked ) );
+         auto rs( subvector( r, i, s, unchecked ) );
+         assign( rs, bs - subvector( q, i, s, unchecked ) );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( rs ), rs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+   }
+
+   if( bb == 0.0 ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const double limit( settings.tolerance * settings.tolerance * bb );
+
+   ET rz{};
+
+   if( rr > limit )
+   {
+      M.apply( r, z );
+
+      rz = fusedSweep<ET,1UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         auto ps( subvector( p, i, s, unchecked ) );
+         assign( ps, subvector( z, i, s, unchecked ) );
+         sums[0UL] += dot( conj( subvector( r, i, s, unchecked ) ), ps );
+      } )[0UL];
+   }
+
+   while( rr > limit && result.iterations < settings.maxIterations )
+   {
+      applyOperator( A, p, q );
+
+      const ET pq( fusedSweep<ET,1UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         const auto ps( subvector( p, i, s, unchecked ) );
+         sums[0UL] += dot( conj( ps ), subvector( q, i, s, unchecked ) );
+      } )[0UL] );
+
+      if( isDefault<strict>( pq ) )
+         break;
+
+      const ET alpha( rz / pq );
+
+      rr = real( fusedSweep<ET,1UL>( n, 6UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         auto xs( subvector( ~x, i, s, unchecked ) );
+         auto rs( subvector( r, i, s, unchecked ) );
+         addAssign( xs, alpha * subvector( p, i, s, unchecked ) );
+         subAssign( rs, alpha * subvector( q, i, s, unchecked ) );
+         sums[0UL] += dot( conj( rs ), rs );
+      } )[0UL] );
+
+      ++result.iterations;
+
+      if( rr <= limit )
+         break;
+
+      M.apply( r, z );
+
+      const ET rzOld( rz );
+
+      rz = fusedSweep<ET,1UL>( n, 2UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,1UL>& sums )
+      {
+         const auto rs( subvector( r, i, s, unchecked ) );
+         sums[0UL] += dot( conj( rs ), subvector( z, i, s, unchecked ) );
+      } )[0UL];
+
+      if( isDefault<strict>( rz ) )
+         break;
+
+      const ET beta( rz / rzOld );
+
+      fusedSweep<ET,0UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,0UL>& )
+      {
+         auto ps( subvector( p, i, s, unchecked ) );
+         assign( ps, subvector( z, i, s, unchecked ) + beta * ps );
+      } );
+   }
+
+   result.residual  = std::sqrt( rr / bb );
+   result.converged = ( rr <= limit );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
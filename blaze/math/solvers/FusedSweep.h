@@ -0,0 +1,173 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/FusedSweep.h
+//  \brief Header file for the fused sweep kernel of the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_FUSEDSWEEP_H_
+#define _BLAZE_MATH_SOLVERS_FUSEDSWEEP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The maximum number of ranges of a fused sweep.
+// \ingroup solvers
+//
+// This value bounds the number of ranges a fused sweep is split into and thus the number of
+// threads working on a single sweep. It allows to keep the partial results on the stack.
+*/
+constexpr size_t maxSweepRanges = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the number of ranges for the parallel processing of \a n independent tasks.
+// \ingroup solvers
+//
+// \param n The number of independent tasks.
+// \param threshold The minimum number of tasks for a parallel execution.
+// \return The number of ranges the tasks should be split into.
+//
+// This function returns 1 in case a serial or parallel section is active or in case \a n is
+// smaller than the given \a threshold. Otherwise it returns the number of available threads,
+// which is limited to maxSweepRanges.
+*/
+inline size_t smpRanges( size_t n, size_t threshold )
+{
+   if( isSerialSectionActive() || isParallelSectionActive() || n < threshold )
+      return 1UL;
+   else
+      return min( getNumThreads(), maxSweepRanges );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED SWEEP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes a fused sweep over the elements \f$[0..n-1]\f$ of several vectors.
+// \ingroup solvers
+//
+// \param n The number of elements of the vectors.
+// \param bytes The number of bytes accessed per element (summed over all vectors).
+// \param op The operation to be applied to each block of elements.
+// \return The sums of the \a K partial results of all blocks.
+//
+// This function is the basic building block of the iterative solvers. It splits the range
+// \f$[0..n-1]\f$ into cache-sized blocks and calls \a op(index,size,sums) for each block, where
+// \a op performs all vector updates of the block and adds its contributions to the \a K inner
+// products or norms to \a sums. Since all updates and reductions of a block are performed
+// before proceeding to the next block, the vectors are loaded from main memory only once. In
+// case the number of elements exceeds the SMP_DVECASSIGN_THRESHOLD, the range is split among
+// the available threads, each of which accumulates its own partial results. The partial results
+// are combined in a fixed order, i.e. the result does not depend on the scheduling of the
+// threads.\n
+// Since \a op is executed in a parallel section, it must not trigger any SMP assignment (i.e.
+// it must use the assign(), addAssign(), and subAssign() functions instead of the assignment
+// operators) and must not throw any exception.
+*/
+template< typename T      // Type of the partial results
+        , size_t K        // Number of partial results
+        , typename OP >   // Type of the block operation
+std::array<T,K> fusedSweep( size_t n, size_t bytes, OP op )
+{
+   const size_t block( max( 256UL, ( cacheSize / ( 2UL * max( bytes, 1UL ) ) ) & size_t(-64) ) );
+
+   const size_t R( smpRanges( n, SMP_DVECASSIGN_THRESHOLD ) );
+
+   std::array< std::array<T,K>, maxSweepRanges > partials{};
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; i+=block ) {
+         op( i, min( block, end-i ), partials[range] );
+      }
+   } );
+
+   for( size_t range=1UL; range<R; ++range ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         partials[0UL][k] += partials[range][k];
+      }
+   }
+
+   return partials[0UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
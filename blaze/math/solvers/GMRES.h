@@ -0,0 +1,446 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the restarted generalized minimal residual method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/functors/Noop.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Generalized minimal residual method */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PC& M, const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Computes the next Krylov vector of the unpreconditioned GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param v The current basis vector.
+// \param w The resulting vector \f$ A\vec{v} \f$.
+// \return void
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the basis vector
+        , typename VT2    // Type of the temporary vector
+        , typename VT3 >  // Type of the result vector
+inline void gmresApply( const OP& A, const Noop&, const VT1& v, VT2& z, VT3& w )
+{
+   UNUSED_PARAMETER( z );
+
+   applyOperator( A, v, w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Computes the next Krylov vector of the right-preconditioned GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param M The preconditioner.
+// \param v The current basis vector.
+// \param z The temporary vector for the preconditioned basis vector.
+// \param w The resulting vector \f$ AM^{-1}\vec{v} \f$.
+// \return void
+*/
+template< typename OP     // Type of the linear operator
+        , typename PC     // Type of the preconditioner
+        , typename VT1    // Type of the basis vector
+        , typename VT2    // Type of the temporary vector
+        , typename VT3 >  // Type of the result vector
+inline void gmresApply( const OP& A, const PC& M, const VT1& v, VT2& z, VT3& w )
+{
+   M.apply( v, z );
+   applyOperator( A, z, w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Updates the solution of the unpreconditioned GMRES method at the end of a cycle.
+// \ingroup solvers
+//
+// \param x The solution vector.
+// \param u The correction \f$ V_k\vec{y}_k \f$ of the current cycle.
+// \return void
+*/
+template< typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the correction
+        , typename VT3    // Type of the first temporary vector
+        , typename VT4 >  // Type of the second temporary vector
+inline void gmresUpdate( const Noop&, VT1& x, const VT2& u, VT3& z, VT4& w )
+{
+   UNUSED_PARAMETER( z, w );
+
+   x += u;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Updates the solution of the right-preconditioned GMRES method at the end of a cycle.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param x The solution vector.
+// \param u The correction \f$ V_k\vec{y}_k \f$ of the current cycle.
+// \param z The temporary vector for the correction.
+// \param w The temporary vector for the preconditioned correction.
+// \return void
+*/
+template< typename PC     // Type of the preconditioner
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the correction
+        , typename VT3    // Type of the first temporary vector
+        , typename VT4 >  // Type of the second temporary vector
+inline void gmresUpdate( const PC& M, VT1& x, const VT2& u, VT3& z, VT4& w )
+{
+   z = u;
+   M.apply( z, w );
+   x += w;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param M The right preconditioner (\c Noop in case of no preconditioning).
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverResult gmresBackend( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                           const PC& M, const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+   const size_t m( max( settings.restart, 1UL ) );
+
+   SolverResult result;
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m );
+   DynamicVector<ET> w( n ), h( m+1UL ), c( m+1UL ), g( m+1UL ), cs( m ), sn( m );
+   DynamicVector<ET> z( IsSame_v<PC,Noop> ? 0UL : n );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   while( true )
+   {
+      // Computing the true residual r = b - Ax as the first basis vector
+      applyOperator( A, ~x, w );
+
+      const auto results( fusedSweep<ET,2UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, size, unchecked ) );
+         auto vs( subvector( column( V, 0UL, unchecked ), i, size, unchecked ) );
+         assign( vs, bs - subvector( w, i, size, unchecked ) );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( vs ), vs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+
+      if( bb == 0.0 ) {
+         reset( ~x );
+         result.converged = true;
+         return result;
+      }
+
+      const double limit( settings.tolerance * settings.tolerance * bb );
+
+      if( rr <= limit || result.iterations >= settings.maxIterations )
+         break;
+
+      const double beta( std::sqrt( rr ) );
+
+      column( V, 0UL, unchecked ) *= ET( 1.0 / beta );
+
+      reset( g );
+      g[0UL] = ET( beta );
+
+      // Arnoldi process
+      size_t k( 0UL );
+
+      while( k < m && result.iterations < settings.maxIterations )
+      {
+         const size_t j( k );
+
+         gmresApply( A, M, column( V, j, unchecked ), z, w );
+
+         auto Vj( submatrix( V, 0UL, 0UL, n, j+1UL, unchecked ) );
+         auto hj( subvector( h, 0UL, j+1UL, unchecked ) );
+         auto cj( subvector( c, 0UL, j+1UL, unchecked ) );
+
+         hj = ctrans( Vj ) * w;
+         w -= Vj * hj;
+         cj = ctrans( Vj ) * w;
+         w -= Vj * cj;
+         hj += cj;
+
+         const double hn( std::sqrt( real( fusedSweep<ET,1UL>( n, sizeof(ET),
+            [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+         {
+            const auto ws( subvector( w, i, size, unchecked ) );
+            sums[0UL] += dot( conj( ws ), ws );
+         } )[0UL] ) ) );
+
+         if( hn != 0.0 ) {
+            column( V, j+1UL, unchecked ) = w * ET( 1.0 / hn );
+         }
+
+         // Application of the previous Givens rotations to the new column of H
+         for( size_t l=0UL; l<j; ++l ) {
+            const ET tmp( cs[l] * h[l] + sn[l] * h[l+1UL] );
+            h[l+1UL] = cs[l] * h[l+1UL] - conj( sn[l] ) * h[l];
+            h[l] = tmp;
+         }
+
+         // Computation of the new Givens rotation eliminating H(j+1,j)
+         const double ha( abs( h[j] ) );
+         const double denom( std::sqrt( ha*ha + hn*hn ) );
+
+         if( denom == 0.0 ) {
+            cs[j] = ET(1);
+            sn[j] = ET(0);
+         }
+         else if( ha == 0.0 ) {
+            cs[j] = ET(0);
+            sn[j] = ET(1);
+            h[j]  = ET( denom );
+         }
+         else {
+            const ET phase( h[j] / ET( ha ) );
+            cs[j] = ET( ha / denom );
+            sn[j] = phase * ET( hn / denom );
+            h[j]  = phase * ET( denom );
+         }
+
+         column( H, j, unchecked ) = h;
+         H(j+1UL,j) = ET(0);
+
+         g[j+1UL] = -conj( sn[j] ) * g[j];
+         g[j] = cs[j] * g[j];
+
+         ++result.iterations;
+         ++k;
+
+         const double res( abs( g[j+1UL] ) );
+
+         if( res*res <= limit || hn == 0.0 )
+            break;
+      }
+
+      // Solution of the upper triangular least squares system and update of the solution
+      for( size_t i=k; i-- > 0UL; ) {
+         ET tmp( g[i] );
+         for( size_t l=i+1UL; l<k; ++l ) {
+            tmp -= H(i,l) * c[l];
+         }
+         c[i] = tmp / H(i,i);
+      }
+
+      const auto Vk( submatrix( V, 0UL, 0UL, n, k, unchecked ) );
+      gmresUpdate( M, ~x, Vk * subvector( c, 0UL, k, unchecked ), z, w );
+   }
+
+   result.residual  = std::sqrt( rr / bb );
+   result.converged = ( rr <= settings.tolerance * settings.tolerance * bb );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general system by means of the restarted generalized minimal residual
+//        method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the generalized
+// minimal residual method (GMRES), starting from the given initial guess \a x. The method is
+// restarted after every \a settings.restart iterations. The iteration stops as soon as the
+// relative residual \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$ drops below the tolerance of
+// the given \a settings or after the maximum number of iterations. Instead of a matrix, \a A
+// can be any callable that assigns the result of \f$ A\vec{v} \f$ to \a y when called as
+// \c A(v,y). Note that in this case \a v is a column of the column-major Krylov basis, i.e.
+// the callable should accept any dense column vector (for instance by means of a generic
+// lambda).
+//
+// The Krylov basis is orthogonalized by means of the classical Gram-Schmidt process with
+// reorthogonalization, which computes all projections of an iteration by a single
+// matrix/vector multiplication and therefore reads the basis vectors only twice per pass.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings )
+{
+   checkOperator( A, (~b).size() );
+
+   if( (~x).size() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return gmresBackend( A, ~x, ~b, Noop(), settings );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given general system by means of the right-preconditioned restarted
+//        generalized minimal residual method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param M The preconditioner.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the restarted
+// GMRES method, where the system is preconditioned from the right with \a M. The preconditioner
+// can be any object that provides an \c apply(r,z) member function computing
+// \f$ \vec{z}=M^{-1}\vec{r} \f$ for dense column vectors \a r (including the columns of the
+// Krylov basis), as for instance the ILUPreconditioner. Due to the right preconditioning, the
+// minimized residual and thus the convergence criterion is the unpreconditioned residual
+// \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC >   // Type of the preconditioner
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PC& M, const SolverSettings& settings )
+{
+   checkOperator( A, (~b).size() );
+
+   if( (~x).size() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return gmresBackend( A, ~x, ~b, M, settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ICPreconditioner.h
+//  \brief Header file for the ICPreconditioner class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ICPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ICPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner without fill-in (IC(0)).
+// \ingroup solvers
+//
+// The ICPreconditioner class approximates a symmetric (Hermitian) positive definite sparse
+// matrix \f$ A \f$ by the product \f$ LL^H \f$, where the lower triangular matrix \f$ L \f$ has
+// the same sparsity pattern as the lower part of \f$ A \f$. The factor is computed once during
+// the construction and stored together with \f$ L^H \f$ in a single row-major CompressedMatrix
+// with the pattern of \f$ A \f$. The application of the preconditioner performs a forward and
+// a backward substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::ICPreconditioner<double> M( A );
+   blaze::cg( A, x, b, M );
+   \endcode
+
+// The sparsity pattern of \f$ A \f$ has to be symmetric and all diagonal elements have to be
+// stored explicitly. Only the lower part of \f$ A \f$ is used for the factorization. Both the
+// factorization and the substitutions are performed level by level, where each level consists
+// of rows that do not depend on each other (see the LevelSchedule class). The rows of a level
+// are processed in parallel in case a shared memory parallelization is enabled.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ICPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline ICPreconditioner( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline const CompressedMatrix<Type,rowMajor>& factors() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> L_;  //!< The incomplete Cholesky factor and its adjoint.
+   std::vector<size_t> diag_;           //!< The positions of the diagonal elements.
+   DynamicVector<Type> inv_;            //!< The inverted diagonal elements of L.
+   LevelSchedule lower_;                //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;                //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky factorization of the given sparse matrix.
+//
+// \param A The sparse matrix to be preconditioned.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Invalid non-symmetric sparsity pattern detected.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline ICPreconditioner<Type>::ICPreconditioner( const SparseMatrix<MT,SO>& A )
+   : L_    ( ~A )  // The incomplete Cholesky factor and its adjoint
+   , diag_ ()      // The positions of the diagonal elements
+   , inv_  ()      // The inverted diagonal elements of L
+   , lower_()      // The level schedule of the forward substitution
+   , upper_()      // The level schedule of the backward substitution
+{
+   const size_t n( L_.rows() );
+
+   if( L_.columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   diag_.resize( n );
+   inv_.resize( n, false );
+
+   std::atomic<bool> missing( false );
+   const size_t R( smpRanges( n, SMP_SMATDVECMULT_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; ++i ) {
+         const auto pos( L_.find( i, i ) );
+         if( pos == L_.end(i) )
+            missing = true;
+         else
+            diag_[i] = pos - L_.begin(i);
+      }
+   } );
+
+   if( missing ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element detected" );
+   }
+
+   lower_ = LevelSchedule( L_, true  );
+   upper_ = LevelSchedule( L_, false );
+
+   std::atomic<bool> indefinite( false );
+
+   lower_.run( [&]( size_t i )
+   {
+      const auto first( L_.begin(i) );
+      const auto diag ( first + diag_[i] );
+
+      for( auto lik=first; lik!=diag; ++lik )
+      {
+         const size_t k( lik->index() );
+
+         auto lij( first );
+         auto lkj( L_.begin(k) );
+         const auto kdiag( L_.begin(k) + diag_[k] );
+
+         while( lij != lik && lkj != kdiag ) {
+            if( lij->index() < lkj->index() ) {
+               ++lij;
+            }
+            else if( lkj->index() < lij->index() ) {
+               ++lkj;
+            }
+            else {
+               lik->value() -= lij->value() * conj( lkj->value() );
+               ++lij;
+               ++lkj;
+            }
+         }
+
+         lik->value() *= inv_[k];
+      }
+
+      auto tmp( real( diag->value() ) );
+
+      for( auto lij=first; lij!=diag; ++lij ) {
+         tmp -= real( lij->value() * conj( lij->value() ) );
+      }
+
+      if( !( tmp > decltype(tmp)(0) ) ) {
+         indefinite = true;
+      }
+      else {
+         diag->value() = Type( std::sqrt( tmp ) );
+         inv_[i] = Type( 1 ) / diag->value();
+      }
+   } );
+
+   if( indefinite ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+   }
+
+   std::atomic<bool> asymmetric( false );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; ++i ) {
+         for( auto uij=L_.begin(i)+diag_[i]+1UL; uij!=L_.end(i); ++uij ) {
+            const size_t j( uij->index() );
+            const auto lji( L_.find( j, i ) );
+            if( lji == L_.end(j) )
+               asymmetric = true;
+            else
+               uij->value() = conj( lji->value() );
+         }
+      }
+   } );
+
+   if( asymmetric ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-symmetric sparsity pattern detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioner.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t ICPreconditioner<Type>::size() const noexcept
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete Cholesky factors.
+//
+// \return The lower triangular factor \f$ L \f$ and its adjoint \f$ L^H \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& ICPreconditioner<Type>::factors() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=L^{-H}L^{-1}\vec{r} \f$).
+//
+// \param r The vector the preconditioner is applied to.
+// \param z The resulting vector.
+// \return void
+//
+// The vectors \a r and \a z may refer to the same vector.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the target vector
+inline void ICPreconditioner<Type>::apply( const DenseVector<VT1,false>& r,
+                                           DenseVector<VT2,false>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == L_.rows(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~z).size() == L_.rows(), "Invalid vector size detected" );
+
+   lower_.run( [&]( size_t i )
+   {
+      const auto diag( L_.begin(i) + diag_[i] );
+      Type tmp( (~r)[i] );
+
+      for( auto element=L_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] = tmp * inv_[i];
+   } );
+
+   upper_.run( [&]( size_t i )
+   {
+      const auto last( L_.end(i) );
+      Type tmp( (~z)[i] );
+
+      for( auto element=L_.begin(i)+diag_[i]+1UL; element!=last; ++element ) {
+         tmp -= element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] = tmp * inv_[i];
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,317 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILUPreconditioner.h
+//  \brief Header file for the ILUPreconditioner class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILUPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILUPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)).
+// \ingroup solvers
+//
+// The ILUPreconditioner class approximates a sparse matrix \f$ A \f$ by the product
+// \f$ LU \f$ of a unit lower and an upper triangular matrix, which have the same sparsity
+// pattern as the lower and upper part of \f$ A \f$, respectively. The factors are computed once
+// during the construction and stored in a single row-major CompressedMatrix with the pattern
+// of \f$ A \f$. The application of the preconditioner performs a forward and a backward
+// substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::ILUPreconditioner<double> M( A );
+   blaze::bicgstab( A, x, b, M );
+   \endcode
+
+// All diagonal elements of \f$ A \f$ have to be stored explicitly. Both the factorization and
+// the substitutions are performed level by level, where each level consists of rows that do
+// not depend on each other (see the LevelSchedule class). The rows of a level are processed
+// in parallel in case a shared memory parallelization is enabled.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILUPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline ILUPreconditioner( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline const CompressedMatrix<Type,rowMajor>& factors() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> LU_;  //!< The incomplete LU factors.
+   std::vector<size_t> diag_;            //!< The positions of the diagonal elements.
+   DynamicVector<Type> inv_;             //!< The inverted diagonal elements of U.
+   LevelSchedule lower_;                 //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;                 //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU factorization of the given sparse matrix.
+//
+// \param A The sparse matrix to be preconditioned.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Zero pivot detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline ILUPreconditioner<Type>::ILUPreconditioner( const SparseMatrix<MT,SO>& A )
+   : LU_   ( ~A )  // The incomplete LU factors
+   , diag_ ()      // The positions of the diagonal elements
+   , inv_  ()      // The inverted diagonal elements of U
+   , lower_()      // The level schedule of the forward substitution
+   , upper_()      // The level schedule of the backward substitution
+{
+   const size_t n( LU_.rows() );
+
+   if( LU_.columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   diag_.resize( n );
+   inv_.resize( n, false );
+
+   std::atomic<bool> missing( false );
+   const size_t R( smpRanges( n, SMP_SMATDVECMULT_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; ++i ) {
+         const auto pos( LU_.find( i, i ) );
+         if( pos == LU_.end(i) )
+            missing = true;
+         else
+            diag_[i] = pos - LU_.begin(i);
+      }
+   } );
+
+   if( missing ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element detected" );
+   }
+
+   lower_ = LevelSchedule( LU_, true  );
+   upper_ = LevelSchedule( LU_, false );
+
+   std::atomic<bool> singular( false );
+
+   lower_.run( [&]( size_t i )
+   {
+      const auto diag( LU_.begin(i) + diag_[i] );
+      const auto last( LU_.end(i) );
+
+      for( auto lik=LU_.begin(i); lik!=diag; ++lik )
+      {
+         const size_t k( lik->index() );
+
+         lik->value() *= inv_[k];
+
+         auto aij( lik+1 );
+         auto ukj( LU_.begin(k) + diag_[k] + 1UL );
+         const auto kend( LU_.end(k) );
+
+         while( aij != last && ukj != kend ) {
+            if( aij->index() < ukj->index() ) {
+               ++aij;
+            }
+            else if( ukj->index() < aij->index() ) {
+               ++ukj;
+            }
+            else {
+               aij->value() -= lik->value() * ukj->value();
+               ++aij;
+               ++ukj;
+            }
+         }
+      }
+
+      if( isDefault<strict>( diag->value() ) )
+         singular = true;
+      else
+         inv_[i] = inv( diag->value() );
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Zero pivot detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioner.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t ILUPreconditioner<Type>::size() const noexcept
+{
+   return LU_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete LU factors.
+//
+// \return The strictly lower part of \f$ L \f$ and the upper part of \f$ U \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& ILUPreconditioner<Type>::factors() const noexcept
+{
+   return LU_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=U^{-1}L^{-1}\vec{r} \f$).
+//
+// \param r The vector the preconditioner is applied to.
+// \param z The resulting vector.
+// \return void
+//
+// The vectors \a r and \a z may refer to the same vector.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the target vector
+inline void ILUPreconditioner<Type>::apply( const DenseVector<VT1,false>& r,
+                                            DenseVector<VT2,false>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == LU_.rows(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~z).size() == LU_.rows(), "Invalid vector size detected" );
+
+   lower_.run( [&]( size_t i )
+   {
+      const auto diag( LU_.begin(i) + diag_[i] );
+      Type tmp( (~r)[i] );
+
+      for( auto element=LU_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] = tmp;
+   } );
+
+   upper_.run( [&]( size_t i )
+   {
+      const auto last( LU_.end(i) );
+      Type tmp( (~z)[i] );
+
+      for( auto element=LU_.begin(i)+diag_[i]+1UL; element!=last; ++element ) {
+         tmp -= element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] = tmp * inv_[i];
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
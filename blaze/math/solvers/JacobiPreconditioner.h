@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the JacobiPreconditioner class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Point Jacobi (diagonal) preconditioner.
+// \ingroup solvers
+//
+// The JacobiPreconditioner class approximates a sparse matrix \f$ A \f$ by its diagonal
+// \f$ D \f$. Its application computes \f$ \vec{z}=D^{-1}\vec{r} \f$ by a single elementwise
+// multiplication with the inverted diagonal, which is computed once during the construction:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::JacobiPreconditioner<double> M( A );
+   blaze::cg( A, x, b, M );
+   \endcode
+
+// Both the setup and the application are executed in parallel in case a shared memory
+// parallelization is enabled.
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inv_;  //!< The inverted diagonal elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the Jacobi preconditioner for the given sparse matrix.
+//
+// \param A The sparse matrix to be preconditioned.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const SparseMatrix<MT,SO>& A )
+   : inv_()  // The inverted diagonal elements
+{
+   const size_t n( (~A).rows() );
+
+   if( (~A).columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   inv_.resize( n, false );
+
+   std::atomic<bool> singular( false );
+   const size_t R( smpRanges( n, SMP_DVECASSIGN_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; ++i ) {
+         const Type d( (~A)(i,i) );
+         if( isDefault<strict>( d ) )
+            singular = true;
+         else
+            inv_[i] = inv( d );
+      }
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Zero diagonal element detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioner.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t JacobiPreconditioner<Type>::size() const noexcept
+{
+   return inv_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=D^{-1}\vec{r} \f$).
+//
+// \param r The vector the preconditioner is applied to.
+// \param z The resulting vector.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the target vector
+inline void JacobiPreconditioner<Type>::apply( const DenseVector<VT1,false>& r,
+                                               DenseVector<VT2,false>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == inv_.size(), "Invalid vector size detected" );
+
+   ~z = inv_ * ~r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
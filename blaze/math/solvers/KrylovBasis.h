@@ -0,0 +1,274 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/KrylovBasis.h
+//  \brief Header file for the Krylov basis functions of the iterative eigensolvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KRYLOVBASIS_H_
+#define _BLAZE_MATH_SOLVERS_KRYLOVBASIS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SpectrumFlag.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KRYLOV BASIS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Euclidean norm of the given vector by means of a fused sweep.
+// \ingroup solvers
+//
+// \param w The given dense vector.
+// \return The Euclidean norm of the vector.
+*/
+template< typename VT >  // Type of the vector
+inline double krylovNorm( const VT& w )
+{
+   using ET = ElementType_t<VT>;
+
+   return std::sqrt( real( fusedSweep<ET,1UL>( w.size(), sizeof(ET),
+      [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+   {
+      const auto ws( subvector( w, i, size, unchecked ) );
+      sums[0UL] += dot( conj( ws ), ws );
+   } )[0UL] ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orthogonalizes a vector against the first \a j columns of the given Krylov basis.
+// \ingroup solvers
+//
+// \param V The column-major Krylov basis.
+// \param j The number of orthonormal basis vectors.
+// \param h The resulting projections of the vector onto the basis vectors.
+// \param c The temporary vector for the reorthogonalization.
+// \param w The vector to be orthogonalized.
+// \return void
+//
+// The orthogonalization is performed by means of the classical Gram-Schmidt process with
+// reorthogonalization, i.e. all projections are computed by a single matrix/vector product.
+*/
+template< typename MT     // Type of the Krylov basis
+        , typename VT1    // Type of the projection vectors
+        , typename VT2 >  // Type of the orthogonalized vector
+inline void krylovOrthogonalize( const MT& V, size_t j, VT1& h, VT1& c, VT2& w )
+{
+   if( j == 0UL ) return;
+
+   const auto Vj( submatrix( V, 0UL, 0UL, V.rows(), j, unchecked ) );
+   auto hj( subvector( h, 0UL, j, unchecked ) );
+   auto cj( subvector( c, 0UL, j, unchecked ) );
+
+   hj = ctrans( Vj ) * w;
+   w -= Vj * hj;
+   cj = ctrans( Vj ) * w;
+   w -= Vj * cj;
+   hj += cj;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the \a j-th column of the Krylov basis with a random unit vector.
+// \ingroup solvers
+//
+// \param V The column-major Krylov basis.
+// \param j The index of the column to be initialized.
+// \param c The temporary vector for the projections.
+// \param w The temporary vector for the new basis vector.
+// \return void
+//
+// The random vector is orthogonalized against the first \a j columns of the basis. In case
+// the basis already spans the entire space, the column is reset to zero.
+*/
+template< typename MT     // Type of the Krylov basis
+        , typename VT1    // Type of the projection vector
+        , typename VT2 >  // Type of the temporary vector
+void randomKrylovVector( MT& V, size_t j, VT1& c, VT2& w )
+{
+   using ET = ElementType_t<MT>;
+
+   for( size_t i=0UL; i<w.size(); ++i ) {
+      w[i] = rand<ET>() - ET( 0.5 );
+   }
+
+   if( j > 0UL ) {
+      const auto Vj( submatrix( V, 0UL, 0UL, V.rows(), j, unchecked ) );
+      auto cj( subvector( c, 0UL, j, unchecked ) );
+
+      for( size_t pass=0UL; pass<2UL; ++pass ) {
+         cj = ctrans( Vj ) * w;
+         w -= Vj * cj;
+      }
+   }
+
+   const double wn( krylovNorm( w ) );
+
+   if( j < V.rows() && wn > 0.0 )
+      column( V, j, unchecked ) = w * ET( 1.0 / wn );
+   else
+      reset( column( V, j, unchecked ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expands the given Krylov basis by one vector.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param V The column-major Krylov basis.
+// \param j The index of the last orthonormal basis vector.
+// \param h The resulting projections \f$ V_{j+1}^HAv_j \f$.
+// \param c The temporary vector for the reorthogonalization.
+// \param w The temporary vector for the new basis vector.
+// \return The norm of the component of \f$ Av_j \f$ orthogonal to the basis.
+//
+// This function computes \f$ Av_j \f$, orthogonalizes it against the first \a j+1 columns of
+// \a V and stores the normalized result in the \a j+1-th column. In case the component of
+// \f$ Av_j \f$ orthogonal to the basis vanishes up to the rounding errors of the
+// orthogonalization, the basis spans an invariant subspace of \a A. In that case the basis is
+// continued with a random vector and the function returns 0.
+*/
+template< typename OP     // Type of the linear operator
+        , typename MT     // Type of the Krylov basis
+        , typename VT1    // Type of the projection vectors
+        , typename VT2 >  // Type of the temporary vector
+double expandKrylovBasis( const OP& A, MT& V, size_t j, VT1& h, VT1& c, VT2& w )
+{
+   using ET = ElementType_t<MT>;
+   using RT = UnderlyingElement_t<ET>;
+
+   applyOperator( A, column( V, j, unchecked ), w );
+
+   const double wn( krylovNorm( w ) );
+
+   krylovOrthogonalize( V, j+1UL, h, c, w );
+
+   const double beta( krylovNorm( w ) );
+
+   if( beta > 10.0 * ( j+1UL ) * std::numeric_limits<RT>::epsilon() * wn ) {
+      column( V, j+1UL, unchecked ) = w * ET( 1.0 / beta );
+      return beta;
+   }
+
+   randomKrylovVector( V, j+1UL, c, w );
+   return 0.0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the given Ritz values according to the selected part of the spectrum.
+// \ingroup solvers
+//
+// \param theta The real or complex Ritz values.
+// \param which The selected part of the spectrum.
+// \return The indices of the Ritz values, starting with the most wanted one.
+//
+// Ritz values with equal sort key are ordered by descending imaginary part, i.e. the two values
+// of a complex conjugate pair are always adjacent.
+*/
+template< typename VT >  // Type of the Ritz values
+std::vector<size_t> ritzOrder( const VT& theta, SpectrumFlag which )
+{
+   const size_t m( theta.size() );
+
+   std::vector<double> key( m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      switch( which ) {
+         case largestMagnitude : key[i] = -abs( theta[i] ); break;
+         case smallestMagnitude: key[i] =  abs( theta[i] ); break;
+         case largestReal      : key[i] = -real( theta[i] ); break;
+         case smallestReal     : key[i] =  real( theta[i] ); break;
+      }
+   }
+
+   std::vector<size_t> order( m );
+   std::iota( order.begin(), order.end(), size_t(0) );
+
+   std::stable_sort( order.begin(), order.end(), [&]( size_t a, size_t b ) {
+      return key[a] < key[b] || ( key[a] == key[b] && imag( theta[a] ) > imag( theta[b] ) );
+   } );
+
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
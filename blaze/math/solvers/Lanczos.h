@@ -0,0 +1,331 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Lanczos.h
+//  \brief Header file for the thick-restart Lanczos method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LANCZOS_H_
+#define _BLAZE_MATH_SOLVERS_LANCZOS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovBasis.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/solvers/SpectrumFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THICK-RESTART LANCZOS METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Thick-restart Lanczos method */
+//@{
+template< typename OP, typename VT, bool TF, typename MT, bool SO >
+SolverResult lanczos( const OP& A, DenseVector<VT,TF>& w, DenseMatrix<MT,SO>& X, size_t nev,
+                      SpectrumFlag which = largestMagnitude,
+                      const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of the real projected Lanczos matrix.
+// \ingroup solvers
+//
+// \param T The symmetric projected matrix (only the lower part is referenced) on input, the
+//          eigenvectors on output.
+// \param theta The resulting eigenvalues in ascending order.
+// \return void
+*/
+template< typename MT     // Type of the projected matrix
+        , typename VT >   // Type of the eigenvalue vector
+inline EnableIf_t< !IsComplex_v< ElementType_t<MT> > > lanczosEigen( MT& T, VT& theta )
+{
+   syevd( T, theta, 'V', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of the complex projected Lanczos matrix.
+// \ingroup solvers
+//
+// \param T The Hermitian projected matrix (only the lower part is referenced) on input, the
+//          eigenvectors on output.
+// \param theta The resulting eigenvalues in ascending order.
+// \return void
+*/
+template< typename MT     // Type of the projected matrix
+        , typename VT >   // Type of the eigenvalue vector
+inline EnableIf_t< IsComplex_v< ElementType_t<MT> > > lanczosEigen( MT& T, VT& theta )
+{
+   heevd( T, theta, 'V', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of the given symmetric (Hermitian) matrix by means of the
+//        thick-restart Lanczos method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) matrix or a user-defined linear operator.
+// \param w The resulting vector of the \a nev selected (real) eigenvalues.
+// \param X The resulting \f$ n \times nev \f$ matrix of the corresponding eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param which The selected part of the spectrum.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function computes the \a nev eigenvalues of the symmetric (Hermitian) \f$ n \times n \f$
+// matrix \a A that are selected by \a which (see the SpectrumFlag enumeration), together with
+// the orthonormal eigenvectors, which are stored in the columns of \a X. The eigenvalues are
+// sorted starting with the most wanted one, i.e. starting with the largest one in case of
+// \c largestReal.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization of the symmetric matrix A
+
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+   blaze::lanczos( A, w, X, 10UL, blaze::largestReal );
+   \endcode
+
+// The function builds an orthonormal Krylov basis of at most \a settings.restart vectors (but
+// at least \f$ 2 \cdot nev+1 \f$ vectors). The basis vectors are fully reorthogonalized by
+// means of the classical Gram-Schmidt process with reorthogonalization, which reads the basis
+// only twice per iteration and performs all projections as parallel dense matrix/vector
+// products. As soon as the basis is full, the method is restarted with the best Ritz vectors
+// (thick restart), which are computed by a single dense matrix multiplication of the basis
+// with the eigenvectors of the small projected matrix. The iteration stops as soon as the
+// residuals \f$ \|A\vec{x}_i-\lambda_i\vec{x}_i\|_2 \f$ of all requested eigenpairs drop below
+// \a settings.tolerance times the largest computed eigenvalue magnitude (an estimate of the
+// norm of \a A) or after \a settings.maxIterations applications of the operator, whatever
+// happens first. In the latter case the current approximations are returned. Note that since
+// the basis is generated from a single starting vector, usually only one eigenvector of a
+// multiple eigenvalue is found.
+//
+// Instead of a matrix, \a A can be any callable that assigns the result of \f$ A\vec{v} \f$ to
+// \a y when called as \c A(v,y), where \a v is a column of the column-major Krylov basis. In
+// this case the size \a n of the problem is given by the number of rows of \a X. Eigenvalues
+// in the interior of the spectrum converge slowly. Instead, it is recommended to compute the
+// largest eigenvalues \f$ \mu_i \f$ of \f$ (A-\sigma I)^{-1} \f$, where the inverse is applied
+// by means of a sparse factorization, and to recover the eigenvalues \f$ \lambda_i=\sigma+1/
+// \mu_i \f$ of \a A closest to the shift \f$ \sigma \f$:
+
+   \code
+   blaze::CompressedMatrix<double> S( A );
+   for( size_t i=0UL; i<S.rows(); ++i ) {
+      S(i,i) -= sigma;
+   }
+
+   const blaze::SparseLDLT<double> ldlt( S );
+   X.resize( S.rows(), 0UL );
+
+   blaze::lanczos( [&ldlt]( const auto& v, auto& y ) { ldlt.solve( v, y ); }, w, X, 10UL );
+   w = map( w, [sigma]( double mu ) { return sigma + 1.0 / mu; } );
+   \endcode
+
+// \note The projected eigenvalue problems are solved by means of the syevd() and heevd()
+// functions, i.e. this function can only be used if a fitting LAPACK library is available and
+// linked to the executable.
+*/
+template< typename OP  // Type of the linear operator
+        , typename VT  // Type of the eigenvalue vector
+        , bool TF      // Transpose flag of the eigenvalue vector
+        , typename MT  // Type of the eigenvector matrix
+        , bool SO >    // Storage order of the eigenvector matrix
+SolverResult lanczos( const OP& A, DenseVector<VT,TF>& w, DenseMatrix<MT,SO>& X, size_t nev,
+                      SpectrumFlag which, const SolverSettings& settings )
+{
+   using ET = ElementType_t<MT>;
+   using RT = UnderlyingElement_t<ET>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   const size_t n( operatorSize( A, (~X).rows() ) );
+
+   checkOperator( A, n );
+
+   if( nev > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   resize( ~w, nev, false );
+   resize( ~X, n, nev, false );
+
+   SolverResult result;
+
+   if( nev == 0UL ) {
+      result.converged = true;
+      return result;
+   }
+
+   const size_t m( min( n, max( settings.restart, 2UL*nev+1UL ) ) );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL ), U( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> T( m+1UL, m, ET(0) ), Y, Ys;
+   DynamicVector<ET> v( n ), h( m+1UL ), c( m+1UL ), s;
+   DynamicVector<RT> theta;
+   std::vector<size_t> order;
+
+   randomKrylovVector( V, 0UL, c, v );
+
+   size_t k( 0UL );
+   size_t j( 0UL );
+
+   while( true )
+   {
+      // Lanczos process with full reorthogonalization
+      while( j < m && result.iterations < settings.maxIterations ) {
+         const double beta( expandKrylovBasis( A, V, j, h, c, v ) );
+         T(j,j) = ET( real( h[j] ) );
+         T(j+1UL,j) = ET( beta );
+         ++result.iterations;
+         ++j;
+      }
+
+      // Rayleigh-Ritz procedure on the projected matrix
+      Y = submatrix( T, 0UL, 0UL, j, j, unchecked );
+      theta.resize( j, false );
+      lanczosEigen( Y, theta );
+      order = ritzOrder( theta, which );
+
+      // Computation of the couplings of the Ritz vectors to the residual vector
+      s = trans( subvector( row( T, j, unchecked ), 0UL, j, unchecked ) * Y );
+
+      double anorm( 0.0 );
+      for( size_t i=0UL; i<j; ++i ) {
+         anorm = max( anorm, abs( theta[i] ) );
+      }
+
+      double res( 0.0 );
+      for( size_t p=0UL; p<min( nev, j ); ++p ) {
+         res = max( res, abs( s[order[p]] ) );
+      }
+
+      result.residual  = ( anorm > 0.0 ? res / anorm : res );
+      result.converged = ( j >= nev && res <= settings.tolerance * anorm );
+
+      if( result.converged || result.iterations >= settings.maxIterations )
+         break;
+
+      // Thick restart with the best Ritz vectors
+      k = min( max( nev, ( nev + j ) / 2UL ), j-1UL );
+
+      Ys.resize( j, k, false );
+      for( size_t p=0UL; p<k; ++p ) {
+         column( Ys, p, unchecked ) = column( Y, order[p], unchecked );
+      }
+
+      submatrix( U, 0UL, 0UL, n, k, unchecked ) = submatrix( V, 0UL, 0UL, n, j, unchecked ) * Ys;
+      column( U, k, unchecked ) = column( V, j, unchecked );
+      swap( U, V );
+
+      reset( T );
+      for( size_t p=0UL; p<k; ++p ) {
+         T(p,p) = ET( theta[order[p]] );
+         T(k,p) = s[order[p]];
+      }
+
+      j = k;
+   }
+
+   // Computation of the Ritz vectors
+   const size_t nconv( min( nev, j ) );
+
+   Ys.resize( j, nconv, false );
+   for( size_t p=0UL; p<nconv; ++p ) {
+      (~w)[p] = theta[order[p]];
+      column( Ys, p, unchecked ) = column( Y, order[p], unchecked );
+   }
+
+   submatrix( ~X, 0UL, 0UL, n, nconv ) = submatrix( V, 0UL, 0UL, n, j, unchecked ) * Ys;
+
+   for( size_t p=nconv; p<nev; ++p ) {
+      reset( (~w)[p] );
+      reset( column( ~X, p ) );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LevelSchedule.h
+//  \brief Header file for the LevelSchedule class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dependency levels of the rows of a sparse triangular system.
+// \ingroup solvers
+//
+// The LevelSchedule class groups the rows of a row-major sparse matrix into levels such that
+// each row only depends on rows of previous levels. For a lower schedule, row \a i depends on
+// all rows \a j < \a i with a non-zero element \f$ A(i,j) \f$, for an upper schedule on all rows
+// \a j > \a i with a non-zero element \f$ A(i,j) \f$. Thus all rows of a level can be processed
+// in parallel, as for instance during a forward or backward substitution or during an incomplete
+// factorization. The levels are computed once from the sparsity pattern and can be reused for
+// any number of substitutions with the same pattern.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline LevelSchedule();
+
+   template< typename Type >
+   inline LevelSchedule( const CompressedMatrix<Type,rowMajor>& A, bool lower );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t levels() const noexcept;
+
+   template< typename OP >
+   inline void run( OP op, size_t work=1UL ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> ptr_;   //!< The offsets of the first row of each level.
+   std::vector<size_t> rows_;  //!< The row indices sorted by level.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+*/
+inline LevelSchedule::LevelSchedule()
+   : ptr_ ( 1UL, 0UL )  // The offsets of the first row of each level
+   , rows_()            // The row indices sorted by level
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the dependency levels of the lower or upper part of the given matrix.
+//
+// \param A The row-major sparse matrix.
+// \param lower \a true for a lower (forward) schedule, \a false for an upper (backward) schedule.
+*/
+template< typename Type >  // Data type of the matrix
+inline LevelSchedule::LevelSchedule( const CompressedMatrix<Type,rowMajor>& A, bool lower )
+   : ptr_ ()  // The offsets of the first row of each level
+   , rows_()  // The row indices sorted by level
+{
+   const size_t n( A.rows() );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t maxLevel( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( lower ? k : n-1UL-k );
+      size_t l( 0UL );
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( lower ? ( j < i ) : ( j > i ) )
+            l = max( l, level[j]+1UL );
+      }
+
+      level[i] = l;
+      maxLevel = max( maxLevel, l );
+   }
+
+   ptr_.assign( ( n > 0UL ? maxLevel+2UL : 1UL ), 0UL );
+   rows_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++ptr_[level[i]+1UL];
+   }
+
+   for( size_t l=1UL; l<ptr_.size(); ++l ) {
+      ptr_[l] += ptr_[l-1UL];
+   }
+
+   std::vector<size_t> pos( ptr_.begin(), ptr_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      rows_[pos[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels.
+//
+// \return The number of levels.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return ptr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calls the given operation for all rows, level by level.
+//
+// \param op The operation to be called as \c op(i) for each row \a i.
+// \param work The relative amount of work per row (for instance the number of right-hand sides).
+// \return void
+//
+// This function processes the levels in order. The rows of a level are split among the
+// available threads in case the product of the number of rows of the level and \a work
+// reaches SMP_SMATDVECMULT_THRESHOLD. Since \a op is executed in a parallel section, it must
+// not trigger any SMP assignment and must not throw any exception.
+*/
+template< typename OP >  // Type of the row operation
+inline void LevelSchedule::run( OP op, size_t work ) const
+{
+   for( size_t l=0UL; l<levels(); ++l )
+   {
+      const size_t begin( ptr_[l] );
+      const size_t size ( ptr_[l+1UL] - begin );
+      const size_t R( min( smpRanges( size*work, SMP_SMATDVECMULT_THRESHOLD ), size ) );
+
+      smpFor( R, [&]( size_t range )
+      {
+         const size_t first( begin + range*size/R );
+         const size_t last ( begin + (range+1UL)*size/R );
+
+         for( size_t k=first; k<last; ++k ) {
+            op( rows_[k] );
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,194 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LinearOperator.h
+//  \brief Header file for the application of linear operators within the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+#define _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LINEAR OPERATOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given matrix can be used as operator of an \a n-by-\a n system.
+// \ingroup solvers
+//
+// \param A The matrix of the linear system.
+// \param n The size of the linear system.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename OP >  // Type of the linear operator
+inline EnableIf_t< IsMatrix_v<OP> > checkOperator( const OP& A, size_t n )
+{
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given user-defined operator can be used for an \a n-by-\a n system.
+// \ingroup solvers
+//
+// \param A The user-defined linear operator.
+// \param n The size of the linear system.
+// \return void
+//
+// Since the size of a user-defined operator is unknown, this function performs no check.
+*/
+template< typename OP >  // Type of the linear operator
+inline EnableIf_t< !IsMatrix_v<OP> > checkOperator( const OP& A, size_t n )
+{
+   UNUSED_PARAMETER( A, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the system defined by the given matrix.
+// \ingroup solvers
+//
+// \param A The matrix of the linear system.
+// \param n The fallback size for user-defined operators (ignored).
+// \return The number of rows of the matrix.
+*/
+template< typename OP >  // Type of the linear operator
+inline EnableIf_t< IsMatrix_v<OP>, size_t > operatorSize( const OP& A, size_t n )
+{
+   UNUSED_PARAMETER( n );
+
+   return A.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the system defined by the given user-defined operator.
+// \ingroup solvers
+//
+// \param A The user-defined linear operator.
+// \param n The size of the system.
+// \return The given size \a n.
+//
+// Since the size of a user-defined operator is unknown, this function returns the size that
+// has been specified by other means (as for instance by the size of a target matrix).
+*/
+template< typename OP >  // Type of the linear operator
+inline EnableIf_t< !IsMatrix_v<OP>, size_t > operatorSize( const OP& A, size_t n )
+{
+   UNUSED_PARAMETER( A );
+
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given matrix to a vector (\f$ \vec{y}=A\vec{x} \f$).
+// \ingroup solvers
+//
+// \param A The matrix of the linear system.
+// \param x The vector the matrix is applied to.
+// \param y The target vector.
+// \return void
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the target vector
+inline EnableIf_t< IsMatrix_v<OP> > applyOperator( const OP& A, const VT1& x, VT2& y )
+{
+   y = A * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given user-defined operator to a vector (\f$ \vec{y}=A\vec{x} \f$).
+// \ingroup solvers
+//
+// \param A The user-defined linear operator.
+// \param x The vector the operator is applied to.
+// \param y The target vector.
+// \return void
+//
+// The operator is called as \c A(x,y) and is expected to assign the result to \a y. Note that
+// \a x is not necessarily a DynamicVector, but can be any dense column vector (as for instance
+// a column of a column-major matrix).
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the right-hand side vector
+        , typename VT2 >  // Type of the target vector
+inline EnableIf_t< !IsMatrix_v<OP> > applyOperator( const OP& A, const VT1& x, VT2& y )
+{
+   A( x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
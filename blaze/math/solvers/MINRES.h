@@ -0,0 +1,245 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MINRES.h
+//  \brief Header file for the minimal residual method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MINRES_H_
+#define _BLAZE_MATH_SOLVERS_MINRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/solvers/SolverResult.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Minimal residual method */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverResult minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric (Hermitian) system by means of the minimal residual method.
+// \ingroup solvers
+//
+// \param A The system matrix or a user-defined linear operator.
+// \param x The initial guess and the resulting solution of the system.
+// \param b The right-hand side vector of the system.
+// \param settings The settings of the iteration.
+// \return The number of iterations, the relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system \f$ A\vec{x}=\vec{b} \f$ by means of the minimal
+// residual method (MINRES), starting from the given initial guess \a x. In contrast to the
+// conjugate gradient method, the system matrix \a A is only required to be symmetric
+// (Hermitian), but may be indefinite; this is not checked. The iteration stops as soon as the
+// relative residual \f$ \|\vec{b}-A\vec{x}\|_2/\|\vec{b}\|_2 \f$, as estimated by the Lanczos
+// recurrence, drops below the tolerance of the given \a settings or after the maximum number
+// of iterations. Instead of a matrix, \a A can be any callable that assigns the result of
+// \f$ A\vec{v} \f$ to \a y when called as \c A(v,y).
+//
+// Per iteration, the method performs one application of \a A and three fused sweeps through
+// the vectors: the first two orthogonalize the new Lanczos vector against its predecessors
+// and compute the required inner products, the third one updates the search direction and
+// the solution and normalizes the new Lanczos vector.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult minres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                     const SolverSettings& settings )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( (~b).size() );
+
+   checkOperator( A, n );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SolverResult result;
+
+   DynamicVector<ET> vOld( n ), v( n ), q( n ), wOld( n ), w( n );
+
+   applyOperator( A, ~x, q );
+
+   double bb( 0.0 );
+   double rr( 0.0 );
+
+   {
+      const auto results( fusedSweep<ET,2UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t s, std::array<ET,2UL>& sums )
+      {
+         const auto bs( subvector( ~b, i, s, unchecked ) );
+         auto vs( subvector( v, i, s, unchecked ) );
+         assign( vs, bs - subvector( q, i, s, unchecked ) );
+         sums[0UL] += dot( conj( bs ), bs );
+         sums[1UL] += dot( conj( vs ), vs );
+      } ) );
+
+      bb = real( results[0UL] );
+      rr = real( results[1UL] );
+   }
+
+   if( bb == 0.0 ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const double limit( settings.tolerance * settings.tolerance * bb );
+
+   if( rr <= limit ) {
+      result.residual  = std::sqrt( rr / bb );
+      result.converged = true;
+      return result;
+   }
+
+   double gamma( std::sqrt( rr ) );
+   double eta( gamma );
+   double cOld( 1.0 ), c( 1.0 ), sOld( 0.0 ), s( 0.0 );
+
+   v *= ET( 1.0 / gamma );
+   reset( vOld );
+   reset( wOld );
+   reset( w );
+
+   while( eta*eta > limit && result.iterations < settings.maxIterations )
+   {
+      applyOperator( A, v, q );
+
+      const ET gammaOld( gamma );
+
+      const double delta( real( fusedSweep<ET,1UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         auto qs( subvector( q, i, size, unchecked ) );
+         subAssign( qs, gammaOld * subvector( vOld, i, size, unchecked ) );
+         sums[0UL] += dot( conj( subvector( v, i, size, unchecked ) ), qs );
+      } )[0UL] ) );
+
+      const ET deltaET( delta );
+
+      gamma = std::sqrt( real( fusedSweep<ET,1UL>( n, 3UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,1UL>& sums )
+      {
+         auto qs( subvector( q, i, size, unchecked ) );
+         subAssign( qs, deltaET * subvector( v, i, size, unchecked ) );
+         sums[0UL] += dot( conj( qs ), qs );
+      } )[0UL] ) );
+
+      // Application of the previous Givens rotations and computation of the new one
+      const double alpha0( c*delta - cOld*s*real( gammaOld ) );
+      const double alpha1( std::sqrt( alpha0*alpha0 + gamma*gamma ) );
+      const double alpha2( s*delta + cOld*c*real( gammaOld ) );
+      const double alpha3( sOld*real( gammaOld ) );
+
+      cOld = c;
+      sOld = s;
+      c = alpha0 / alpha1;
+      s = gamma  / alpha1;
+
+      const ET scale( 1.0 / alpha1 );
+      const ET a2( alpha2 ), a3( alpha3 );
+      const ET step( c*eta );
+      const ET inv( gamma != 0.0 ? 1.0 / gamma : 0.0 );
+
+      fusedSweep<ET,0UL>( n, 7UL*sizeof(ET),
+         [&]( size_t i, size_t size, std::array<ET,0UL>& )
+      {
+         auto xs( subvector( ~x, i, size, unchecked ) );
+         auto ws( subvector( wOld, i, size, unchecked ) );
+         auto qs( subvector( q, i, size, unchecked ) );
+         assign( ws, scale * ( subvector( v, i, size, unchecked ) - a3 * ws -
+                               a2 * subvector( w, i, size, unchecked ) ) );
+         addAssign( xs, step * ws );
+         assign( qs, inv * qs );
+      } );
+
+      swap( wOld, w );
+      swap( vOld, v );
+      swap( v, q );
+
+      eta = -s*eta;
+
+      ++result.iterations;
+
+      if( gamma == 0.0 ) {
+         eta = 0.0;
+         break;
+      }
+   }
+
+   result.residual  = std::abs( eta ) / std::sqrt( bb );
+   result.converged = ( eta*eta <= limit );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
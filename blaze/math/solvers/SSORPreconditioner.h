@@ -0,0 +1,293 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the SSORPreconditioner class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symmetric successive over-relaxation (SSOR) preconditioner.
+// \ingroup solvers
+//
+// The SSORPreconditioner class approximates a sparse matrix \f$ A=L+D+U \f$ by
+
+      \f[ M = \frac{\omega}{2-\omega} \left(\frac{D}{\omega}+L\right) \left(\frac{D}{\omega}
+          \right)^{-1} \left(\frac{D}{\omega}+U\right), \f]
+
+// where \f$ L \f$, \f$ D \f$, and \f$ U \f$ are the strictly lower, the diagonal, and the
+// strictly upper part of \f$ A \f$, respectively, and \f$ \omega \in (0,2) \f$ is the
+// relaxation parameter. In contrast to an incomplete factorization, no numeric setup is
+// required besides the inversion of the diagonal. For a symmetric (Hermitian) positive definite
+// matrix the preconditioner is symmetric (Hermitian) positive definite as well and can be used
+// in combination with the conjugate gradient method:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::SSORPreconditioner<double> M( A, 1.2 );
+   blaze::cg( A, x, b, M );
+   \endcode
+
+// All diagonal elements of \f$ A \f$ have to be stored explicitly. The application performs a
+// forward and a backward substitution level by level, where each level consists of rows that
+// do not depend on each other (see the LevelSchedule class). The rows of a level are processed
+// in parallel in case a shared memory parallelization is enabled.
+*/
+template< typename Type >  // Data type of the preconditioner
+class SSORPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const SparseMatrix<MT,SO>& A, double omega = 1.0 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline double omega() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( const DenseVector<VT1,false>& r, DenseVector<VT2,false>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> A_;  //!< The preconditioned matrix.
+   double omega_;                       //!< The relaxation parameter.
+   std::vector<size_t> diag_;           //!< The positions of the diagonal elements.
+   DynamicVector<Type> inv_;            //!< The relaxed inverted diagonal \f$ \omega D^{-1} \f$.
+   LevelSchedule lower_;                //!< The level schedule of the forward substitution.
+   LevelSchedule upper_;                //!< The level schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the SSOR preconditioner for the given sparse matrix.
+//
+// \param A The sparse matrix to be preconditioned.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline SSORPreconditioner<Type>::SSORPreconditioner( const SparseMatrix<MT,SO>& A, double omega )
+   : A_    ( ~A )     // The preconditioned matrix
+   , omega_( omega )  // The relaxation parameter
+   , diag_ ()         // The positions of the diagonal elements
+   , inv_  ()         // The relaxed inverted diagonal
+   , lower_()         // The level schedule of the forward substitution
+   , upper_()         // The level schedule of the backward substitution
+{
+   const size_t n( A_.rows() );
+
+   if( A_.columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !( omega > 0.0 && omega < 2.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid relaxation parameter" );
+   }
+
+   diag_.resize( n );
+   inv_.resize( n, false );
+
+   std::atomic<bool> singular( false );
+   const size_t R( smpRanges( n, SMP_SMATDVECMULT_THRESHOLD ) );
+
+   smpFor( R, [&]( size_t range )
+   {
+      const size_t begin( range*n/R );
+      const size_t end  ( (range+1UL)*n/R );
+
+      for( size_t i=begin; i<end; ++i ) {
+         const auto pos( A_.find( i, i ) );
+         if( pos == A_.end(i) || isDefault<strict>( pos->value() ) ) {
+            singular = true;
+         }
+         else {
+            diag_[i] = pos - A_.begin(i);
+            inv_[i] = Type( omega ) / pos->value();
+         }
+      }
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Zero diagonal element detected" );
+   }
+
+   lower_ = LevelSchedule( A_, true  );
+   upper_ = LevelSchedule( A_, false );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioner.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t SSORPreconditioner<Type>::size() const noexcept
+{
+   return A_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter.
+//
+// \return The relaxation parameter \f$ \omega \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline double SSORPreconditioner<Type>::omega() const noexcept
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the preconditioner (\f$ \vec{z}=M^{-1}\vec{r} \f$).
+//
+// \param r The vector the preconditioner is applied to.
+// \param z The resulting vector.
+// \return void
+//
+// The forward substitution computes \f$ \vec{y}=\frac{2-\omega}{\omega}(D/\omega+L)^{-1}
+// \vec{r} \f$, the backward substitution \f$ \vec{z}=(D/\omega+U)^{-1}(D/\omega)\vec{y} \f$.
+// The vectors \a r and \a z may refer to the same vector.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the target vector
+inline void SSORPreconditioner<Type>::apply( const DenseVector<VT1,false>& r,
+                                             DenseVector<VT2,false>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == A_.rows(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (~z).size() == A_.rows(), "Invalid vector size detected" );
+
+   const Type scale( ( 2.0 - omega_ ) / omega_ );
+
+   lower_.run( [&]( size_t i )
+   {
+      const auto diag( A_.begin(i) + diag_[i] );
+      Type tmp( scale * (~r)[i] );
+
+      for( auto element=A_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] = tmp * inv_[i];
+   } );
+
+   upper_.run( [&]( size_t i )
+   {
+      const auto last( A_.end(i) );
+      Type tmp( 0 );
+
+      for( auto element=A_.begin(i)+diag_[i]+1UL; element!=last; ++element ) {
+         tmp += element->value() * (~z)[element->index()];
+      }
+
+      (~z)[i] -= tmp * inv_[i];
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,147 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Solvers.h
+//  \brief Documentation of the iterative solver module
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERS_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERS_H_
+
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup solvers Iterative Solvers
+// \ingroup math
+//
+// The iterative solver module provides Krylov subspace methods for the solution of large,
+// sparse linear systems of equations \f$ A\vec{x}=\vec{b} \f$:
+//
+//  - cg(): the conjugate gradient method for symmetric (Hermitian) positive definite systems
+//  - minres(): the minimal residual method for symmetric (Hermitian) indefinite systems
+//  - bicgstab(): the stabilized biconjugate gradient method for general systems
+//  - gmres(): the restarted generalized minimal residual method for general systems
+//
+// All solvers accept any Blaze matrix (as for instance CompressedMatrix or DynamicMatrix) or a
+// user-defined linear operator, i.e. a callable that computes \f$ \vec{y}=A\vec{x} \f$ for a
+// given vector \f$ \vec{x} \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverSettings settings;
+   settings.tolerance = 1E-10;
+
+   const blaze::SolverResult result( blaze::cg( A, x, b, settings ) );
+
+   // Matrix-free application of the operator
+   blaze::gmres( [&A]( const auto& v, auto& y ) { y = A * v; }, x, b );
+   \endcode
+
+// The vector updates of each iteration are fused into as few sweeps through memory as possible,
+// where each sweep combines all updates and inner products that can be computed at the same
+// time. The sweeps as well as the application of the operator are executed in parallel in case
+// a shared memory parallelization is enabled. All memory required by a solver is allocated once
+// before the first iteration.
+//
+// With the exception of minres(), all solvers can be combined with a preconditioner, i.e. any
+// object providing an \c apply(r,z) member function that computes \f$ \vec{z}=M^{-1}\vec{r} \f$.
+// cg() applies the preconditioner symmetrically, bicgstab() and gmres() apply it from the right.
+// The following preconditioners are provided for sparse system matrices:
+//
+//  - JacobiPreconditioner: the inverse of the diagonal of the system matrix
+//  - BlockJacobiPreconditioner: the inverses of the \f$ B \times B \f$ diagonal blocks
+//  - ILUPreconditioner: the incomplete LU factorization without fill-in (ILU(0))
+//  - ICPreconditioner: the incomplete Cholesky factorization without fill-in (IC(0))
+//  - SSORPreconditioner: the symmetric successive over-relaxation
+
+   \code
+   blaze::ICPreconditioner<double> M( A );
+   blaze::cg( A, x, b, M, settings );
+
+   blaze::ILUPreconditioner<double> LU( B );
+   blaze::gmres( B, y, c, LU );
+   \endcode
+
+// The setup of all preconditioners as well as their application are executed in parallel.
+// The triangular factorizations and solves of ILU(0), IC(0) and SSOR are parallelized by means
+// of level scheduling, i.e. all rows of the same level of the dependency graph of the
+// triangular factors are processed concurrently. The same technique is available for general
+// sparse triangular systems by means of the SparseTriangularSolver class, which performs the
+// dependency analysis once and afterwards solves for any number of right-hand sides:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   // ... Resizing and initialization
+
+   const blaze::SparseTriangularSolver<double> solver( L );
+   solver.solve( b, x );
+   \endcode
+
+// As an alternative to the iterative solvers, the SparseCholesky class provides a supernodal
+// sparse direct solver for Hermitian positive definite systems (\f$ A=LL^H \f$) and, by means
+// of the SparseLDLT alias, for Hermitian systems that can be factorized without pivoting
+// (\f$ A=LDL^H \f$). The symbolic analysis, including a fill-reducing ordering (see the
+// \ref ordering module), is performed once and reused by all subsequent numeric factorizations
+// of matrices with the same sparsity pattern:
+
+   \code
+   blaze::SparseCholesky<double> chol( A, blaze::minimumDegreeOrdering );
+   chol.solve( b, x );
+
+   chol.factorize( A2 );  // Same sparsity pattern as A
+   chol.solve( b, x );
+   \endcode
+
+// Additionally, the module provides iterative eigensolvers for a few extreme eigenpairs of large
+// matrices: lanczos() implements the thick-restart Lanczos method for symmetric (Hermitian)
+// matrices, arnoldi() the implicitly restarted Arnoldi method for general matrices. Both accept
+// the same operators and settings as the linear solvers, the part of the spectrum is selected
+// by means of the SpectrumFlag enumeration:
+
+   \code
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+   blaze::lanczos( A, w, X, 10UL, blaze::smallestReal );
+   \endcode
+
+// The eigensolvers require a LAPACK library for the solution of the small projected problems.
+*/
+//*************************************************************************************************
+
+#endif
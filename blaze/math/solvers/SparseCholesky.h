@@ -0,0 +1,1385 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseCholesky.h
+//  \brief Header file for the supernodal sparse Cholesky decomposition
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSECHOLESKY_H_
+#define _BLAZE_MATH_SOLVERS_SPARSECHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/ordering/AMD.h>
+#include <blaze/math/ordering/NestedDissection.h>
+#include <blaze/math/ordering/OrderingFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/solvers/FusedSweep.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse Cholesky decomposition.
+// \ingroup solvers
+//
+// The SparseCholesky class template computes the sparse decomposition \f$ PAP^T=LL^H \f$ of a
+// Hermitian positive definite matrix \a A (\a LDL is \a false) or the square root free
+// decomposition \f$ PAP^T=LDL^H \f$ of a Hermitian matrix \a A without pivoting (\a LDL is
+// \a true, see also the SparseLDLT alias template), where \a P is a fill-reducing permutation
+// matrix, \a L is lower (uni)triangular, and \a D is diagonal. The decomposition is split into
+// two phases:
+//
+//  - The analyze() function computes the fill-reducing ordering, the elimination tree, and the
+//    structure of the factor, which is partitioned into supernodes, i.e. sets of consecutive
+//    columns with identical structure below the diagonal.
+//  - The factorize() function computes the numeric factor. It can be called repeatedly for any
+//    matrix with the same sparsity pattern as the analyzed matrix, reusing the complete symbolic
+//    analysis.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SparseCholesky<double> chol;
+   chol.analyze( A, blaze::nestedDissectionOrdering );
+   chol.factorize( A );
+   chol.solve( b, x );
+
+   // ... Update of the values of A (same sparsity pattern)
+
+   chol.factorize( A );  // Numeric refactorization without symbolic analysis
+   chol.solve( b, x );
+   \endcode
+
+// The numeric factorization is multifrontal: For each supernode, a dense frontal matrix is
+// assembled from the according columns of \a A and the update matrices of its children. The
+// columns of the supernode are factorized by a blocked right-looking algorithm, whose dense
+// updates are performed by the mmm() kernel in case the data type can be vectorized. Since
+// supernodes in different subtrees of the elimination tree are independent, all supernodes of
+// the same height in the supernodal elimination tree are factorized in parallel. Large frontal
+// matrices near the root of the tree additionally split their dense updates among the available
+// threads. The solve() functions are executed serially.
+//
+// The given matrix must be square and Hermitian and both its lower and upper part have to be
+// stored explicitly, since only the lower part of \f$ PAP^T \f$ is used.
+*/
+template< typename Type       // Data type of the decomposition
+        , bool LDL = false >  // Flag for the square root free decomposition
+class SparseCholesky
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseCholesky();
+
+   template< typename MT, bool SO >
+   explicit inline SparseCholesky( const SparseMatrix<MT,SO>& A,
+                                   OrderingFlag ordering = minimumDegreeOrdering );
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, OrderingFlag ordering = minimumDegreeOrdering );
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void solve( const DenseVector<VT1,false>& b, DenseVector<VT2,false>& x ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& X ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size()         const noexcept;
+   inline size_t supernodes()   const noexcept;
+   inline size_t nonZeros()     const noexcept;
+   inline bool   isFactorized() const noexcept;
+
+   inline const std::vector<size_t>& permutation() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using BlockType = DynamicMatrix<Type,rowMajor>;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void symbolic( const MT& A, const std::vector<size_t>& perm );
+
+   bool factorizeSupernode( size_t s, const std::vector<Type>& values,
+                            std::vector<BlockType>& fronts );
+
+   bool partialFactorization( BlockType& F, size_t w ) const;
+
+   template< typename MT1, typename MT2, typename MT3 >
+   static inline EnableIf_t< IsVectorizable_v< ElementType_t<MT1> > &&
+                             HasSIMDMult_v< ElementType_t<MT2>, ElementType_t<MT3> > >
+      updateBlock( MT1& C, const MT2& A, const MT3& B );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   static inline DisableIf_t< IsVectorizable_v< ElementType_t<MT1> > &&
+                              HasSIMDMult_v< ElementType_t<MT2>, ElementType_t<MT3> > >
+      updateBlock( MT1& C, const MT2& A, const MT3& B );
+
+   void solveInPlace( DynamicVector<Type>& y ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                         //!< The number of rows and columns of the matrix.
+   size_t nonZeros_;                  //!< The number of non-zero elements of the analyzed matrix.
+   bool factorized_;                  //!< Flag for a successful numeric factorization.
+   std::vector<size_t> perm_;         //!< The fill-reducing permutation (new to old indices).
+   std::vector<size_t> first_;        //!< The first column of each supernode.
+   std::vector<size_t> parent_;       //!< The parent of each supernode.
+   std::vector<size_t> rowPtr_;       //!< The offsets of the row structures of the supernodes.
+   std::vector<size_t> rows_;         //!< The row structures of the supernodes.
+   std::vector<size_t> relative_;     //!< The positions of the update rows within the parent.
+   std::vector<size_t> childPtr_;     //!< The offsets of the children of the supernodes.
+   std::vector<size_t> children_;     //!< The children of the supernodes.
+   std::vector<size_t> levelPtr_;     //!< The offsets of the levels of the supernodal tree.
+   std::vector<size_t> levels_;       //!< The supernodes sorted by height.
+   std::vector<size_t> targets_;      //!< The assembly slot of each element of the matrix.
+   std::vector<size_t> assemblyPtr_;  //!< The offsets of the assembly slots of the supernodes.
+   std::vector<size_t> frontRows_;    //!< The front row of each assembly slot.
+   std::vector<size_t> frontCols_;    //!< The front column of each assembly slot.
+   std::vector<BlockType> factors_;   //!< The column blocks of the factor.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALIAS DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse \f$ LDL^H \f$ decomposition.
+// \ingroup solvers
+//
+// The SparseLDLT alias template represents the square root free variant of the SparseCholesky
+// class template (\f$ PAP^T=LDL^H \f$, which is equal to \f$ PAP^T=LDL^T \f$ for real matrices).
+// Since no pivoting is performed, the decomposition requires all leading principal minors of
+// \f$ PAP^T \f$ to be nonsingular, which for instance holds for quasi-definite matrices.
+*/
+template< typename Type >  // Data type of the decomposition
+using SparseLDLT = SparseCholesky<Type,true>;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseCholesky.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline SparseCholesky<Type,LDL>::SparseCholesky()
+   : n_          ( 0UL )       // The number of rows and columns of the matrix
+   , nonZeros_   ( 0UL )       // The number of non-zero elements of the analyzed matrix
+   , factorized_ ( false )     // Flag for a successful numeric factorization
+   , perm_       ()            // The fill-reducing permutation
+   , first_      ( 1UL, 0UL )  // The first column of each supernode
+   , parent_     ()            // The parent of each supernode
+   , rowPtr_     ( 1UL, 0UL )  // The offsets of the row structures of the supernodes
+   , rows_       ()            // The row structures of the supernodes
+   , relative_   ()            // The positions of the update rows within the parent
+   , childPtr_   ( 1UL, 0UL )  // The offsets of the children of the supernodes
+   , children_   ()            // The children of the supernodes
+   , levelPtr_   ( 1UL, 0UL )  // The offsets of the levels of the supernodal tree
+   , levels_     ()            // The supernodes sorted by height
+   , targets_    ()            // The assembly slot of each element of the matrix
+   , assemblyPtr_( 1UL, 0UL )  // The offsets of the assembly slots of the supernodes
+   , frontRows_  ()            // The front row of each assembly slot
+   , frontCols_  ()            // The front column of each assembly slot
+   , factors_    ()            // The column blocks of the factor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analysis and factorization of the given sparse matrix.
+//
+// \param A The Hermitian sparse matrix to be decomposed.
+// \param ordering The fill-reducing ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline SparseCholesky<Type,LDL>::SparseCholesky( const SparseMatrix<MT,SO>& A,
+                                                 OrderingFlag ordering )
+   : SparseCholesky()
+{
+   analyze( A, ordering );
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix with the given fill-reducing ordering.
+//
+// \param A The Hermitian sparse matrix to be analyzed.
+// \param ordering The fill-reducing ordering.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the fill-reducing permutation selected by \a ordering and performs
+// the symbolic analysis of the permuted matrix. Any previous factorization is discarded.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::analyze( const SparseMatrix<MT,SO>& A, OrderingFlag ordering )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand tmp( ~A );  // Row-major evaluation of the sparse matrix
+
+   std::vector<size_t> perm;
+
+   switch( ordering ) {
+      case minimumDegreeOrdering:
+         perm = amd( tmp );
+         break;
+      case nestedDissectionOrdering:
+         perm = nestedDissection( tmp );
+         break;
+      default:
+         perm.resize( tmp.rows() );
+         for( size_t i=0UL; i<perm.size(); ++i ) {
+            perm[i] = i;
+         }
+         break;
+   }
+
+   symbolic( tmp, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix with the given permutation.
+//
+// \param A The Hermitian sparse matrix to be analyzed.
+// \param perm The permutation vector (new to old indices).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function performs the symbolic analysis of \f$ PAP^T \f$ for the given permutation, where
+// the \a k-th element of \a perm is the index of the row/column of \a A that becomes the \a k-th
+// row/column of the permuted matrix. Note that the permutation is refined by a postordering of
+// the elimination tree, which does not change the fill-in of the factor. Any previous
+// factorization is discarded.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::analyze( const SparseMatrix<MT,SO>& A,
+                                        const std::vector<size_t>& perm )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   std::vector<bool> used( n, false );
+   bool valid( perm.size() == n );
+
+   for( size_t k=0UL; valid && k<n; ++k ) {
+      valid = ( perm[k] < n && !used[perm[k]] );
+      if( valid ) used[perm[k]] = true;
+   }
+
+   if( !valid ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand tmp( ~A );  // Row-major evaluation of the sparse matrix
+
+   symbolic( tmp, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse matrix.
+//
+// \param A The Hermitian sparse matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid sparsity pattern detected.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+//
+// This function computes the numeric factor of the given matrix based on the previous symbolic
+// analysis. The matrix must have the same sparsity pattern as the analyzed matrix. Only the
+// number of rows and the number of non-zero elements are checked; in case the values of the
+// matrix are stored at different positions, the result is undefined.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SparseCholesky<Type,LDL>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != n_ || (~A).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand tmp( ~A );  // Row-major evaluation of the sparse matrix
+
+   if( tmp.nonZeros() != nonZeros_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern detected" );
+   }
+
+   factorized_ = false;
+
+   // Gathering the values of the lower part of the permuted matrix
+   std::vector<Type> values( frontRows_.size() );
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i); ++element, ++k ) {
+         if( targets_[k] != size_t(-1) )
+            values[targets_[k]] = element->value();
+      }
+   }
+
+   // Factorization of the supernodes level by level
+   std::vector<BlockType> fronts( supernodes() );
+   std::atomic<bool> failed( false );
+
+   for( size_t l=0UL; l+1UL<levelPtr_.size(); ++l )
+   {
+      const size_t begin( levelPtr_[l] );
+      const size_t count( levelPtr_[l+1UL] - begin );
+      const size_t R( min( smpRanges( count, 2UL ), count ) );
+
+      smpFor( R, [&]( size_t range )
+      {
+         for( size_t j=begin+range; j<begin+count; j+=R ) {
+            if( !failed && !factorizeSupernode( levels_[j], values, fronts ) )
+               failed = true;
+         }
+      } );
+
+      if( failed ) {
+         if( LDL ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of singular matrix failed" );
+         }
+         else {
+            BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+         }
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ A\vec{x}=\vec{b} \f$.
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the linear system by means of a forward and backward substitution with
+// the supernodal factor. In case \a x is resizable, it is resized to the size of the system.
+// The vectors \a b and \a x may refer to the same vector.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename VT1   // Type of the right-hand side vector
+        , typename VT2 > // Type of the solution vector
+void SparseCholesky<Type,LDL>::solve( const DenseVector<VT1,false>& b,
+                                      DenseVector<VT2,false>& x ) const
+{
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   if( (~b).size() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   DynamicVector<Type> y( n_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      y[k] = (~b)[perm_[k]];
+   }
+
+   solveInPlace( y );
+
+   resize( ~x, n_, false );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      (~x)[perm_[k]] = y[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ AX=B \f$ with multiple right-hand sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \param X The resulting solution matrix.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case \a X is resizable, it is resized to the size of \a B. The matrices \a B and \a X may
+// refer to the same matrix.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT1   // Type of the right-hand side matrix
+        , bool SO1       // Storage order of the right-hand side matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2 >     // Storage order of the solution matrix
+void SparseCholesky<Type,LDL>::solve( const DenseMatrix<MT1,SO1>& B,
+                                      DenseMatrix<MT2,SO2>& X ) const
+{
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   if( (~B).rows() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t N( (~B).columns() );
+
+   resize( ~X, n_, N, true );
+
+   DynamicVector<Type> y( n_ );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      for( size_t k=0UL; k<n_; ++k ) {
+         y[k] = (~B)(perm_[k],j);
+      }
+
+      solveInPlace( y );
+
+      for( size_t k=0UL; k<n_; ++k ) {
+         (~X)(perm_[k],j) = y[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the decomposed matrix.
+//
+// \return The size of the decomposed matrix.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline size_t SparseCholesky<Type,LDL>::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the factor.
+//
+// \return The number of supernodes.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline size_t SparseCholesky<Type,LDL>::supernodes() const noexcept
+{
+   return first_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the factor.
+//
+// \return The number of non-zero elements of the lower triangular factor (including the diagonal).
+//
+// The number of non-zero elements is determined by the symbolic analysis and therefore also
+// available before the numeric factorization.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline size_t SparseCholesky<Type,LDL>::nonZeros() const noexcept
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t s=0UL; s<supernodes(); ++s ) {
+      const size_t w( first_[s+1UL] - first_[s] );
+      const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+      nonzeros += m*w - ( w*(w-1UL) )/2UL;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a numeric factorization is available.
+//
+// \return \a true in case the numeric factorization succeeded, \a false if not.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline bool SparseCholesky<Type,LDL>::isFactorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation.
+//
+// \return The permutation vector (new to old indices).
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+inline const std::vector<size_t>& SparseCholesky<Type,LDL>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given row-major sparse matrix.
+//
+// \param A The row-major sparse matrix.
+// \param perm The initial permutation vector (new to old indices).
+// \return void
+//
+// This function computes the elimination tree of the permuted matrix, refines the permutation
+// by a postordering of the tree, and computes the column counts of the factor by means of the
+// row subtrees. Consecutive columns that form a chain in the elimination tree and have nested
+// structures are merged into fundamental supernodes. Finally, the row structure of each
+// supernode, the positions of its update rows within its parent, and the assembly positions
+// of all elements of the lower part of the permuted matrix are computed.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT >  // Type of the row-major sparse matrix
+void SparseCholesky<Type,LDL>::symbolic( const MT& A, const std::vector<size_t>& perm )
+{
+   const size_t n( A.rows() );
+   const size_t invalid( size_t(-1) );
+
+   n_ = n;
+   nonZeros_ = A.nonZeros();
+   factorized_ = false;
+   perm_ = perm;
+   factors_.clear();
+
+   std::vector<size_t> pinv( n );
+   std::vector<size_t> lowerPtr( n+1UL );
+   std::vector<size_t> lowerIdx;
+   std::vector<size_t> parent( n );
+   std::vector<size_t> mark( n );
+
+   // Computation of the strictly lower part of the permuted matrix and its elimination tree
+   const auto computeTree = [&]()
+   {
+      for( size_t k=0UL; k<n; ++k ) {
+         pinv[perm_[k]] = k;
+      }
+
+      std::fill( lowerPtr.begin(), lowerPtr.end(), 0UL );
+
+      for( size_t r=0UL; r<n; ++r ) {
+         for( auto element=A.begin(r); element!=A.end(r); ++element ) {
+            if( pinv[element->index()] < pinv[r] )
+               ++lowerPtr[pinv[r]+1UL];
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         lowerPtr[i+1UL] += lowerPtr[i];
+      }
+
+      lowerIdx.resize( lowerPtr[n] );
+      std::vector<size_t> pos( lowerPtr.begin(), lowerPtr.end()-1L );
+
+      for( size_t r=0UL; r<n; ++r ) {
+         for( auto element=A.begin(r); element!=A.end(r); ++element ) {
+            const size_t j( pinv[element->index()] );
+            if( j < pinv[r] )
+               lowerIdx[pos[pinv[r]]++] = j;
+         }
+      }
+
+      std::vector<size_t>& ancestor( mark );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         parent[i]   = invalid;
+         ancestor[i] = invalid;
+
+         for( size_t k=lowerPtr[i]; k<lowerPtr[i+1UL]; ++k )
+         {
+            size_t r( lowerIdx[k] );
+
+            while( ancestor[r] != invalid && ancestor[r] != i ) {
+               const size_t next( ancestor[r] );
+               ancestor[r] = i;
+               r = next;
+            }
+
+            if( ancestor[r] == invalid ) {
+               ancestor[r] = i;
+               parent[r]   = i;
+            }
+         }
+      }
+   };
+
+   computeTree();
+
+   // Refinement of the permutation by a postordering of the elimination tree
+   {
+      std::vector<size_t> head( n, invalid );
+      std::vector<size_t> next( n, invalid );
+      std::vector<size_t> stack;
+      std::vector<size_t> post;
+
+      post.reserve( n );
+
+      for( size_t j=n; j-- > 0UL; ) {
+         if( parent[j] != invalid ) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+         }
+      }
+
+      for( size_t root=0UL; root<n; ++root )
+      {
+         if( parent[root] != invalid )
+            continue;
+
+         stack.push_back( root );
+
+         while( !stack.empty() ) {
+            const size_t top( stack.back() );
+            const size_t child( head[top] );
+            if( child == invalid ) {
+               post.push_back( top );
+               stack.pop_back();
+            }
+            else {
+               head[top] = next[child];
+               stack.push_back( child );
+            }
+         }
+      }
+
+      for( size_t k=0UL; k<n; ++k ) {
+         head[k] = perm_[post[k]];
+      }
+
+      perm_.swap( head );
+   }
+
+   computeTree();
+
+   // Computation of the column counts by means of the row subtrees
+   std::vector<size_t> counts( n, 1UL );
+   std::vector<size_t> numChildren( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      mark[i] = i;
+
+      for( size_t k=lowerPtr[i]; k<lowerPtr[i+1UL]; ++k ) {
+         for( size_t r=lowerIdx[k]; mark[r] != i; r=parent[r] ) {
+            ++counts[r];
+            mark[r] = i;
+         }
+      }
+
+      if( parent[i] != invalid )
+         ++numChildren[parent[i]];
+   }
+
+   // Detection of the fundamental supernodes
+   std::vector<size_t> snode( n );
+
+   first_.clear();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( j == 0UL || parent[j-1UL] != j || counts[j-1UL] != counts[j]+1UL ||
+          numChildren[j] != 1UL )
+         first_.push_back( j );
+      snode[j] = first_.size() - 1UL;
+   }
+
+   first_.push_back( n );
+
+   const size_t S( supernodes() );
+
+   parent_.resize( S );
+   childPtr_.assign( S+1UL, 0UL );
+   children_.resize( S > 0UL ? S-1UL : 0UL );
+
+   for( size_t s=0UL; s<S; ++s ) {
+      const size_t p( parent[first_[s+1UL]-1UL] );
+      parent_[s] = ( p == invalid )?( invalid ):( snode[p] );
+      if( parent_[s] != invalid )
+         ++childPtr_[parent_[s]+1UL];
+   }
+
+   for( size_t s=0UL; s<S; ++s ) {
+      childPtr_[s+1UL] += childPtr_[s];
+   }
+
+   children_.resize( childPtr_[S] );
+
+   {
+      std::vector<size_t> pos( childPtr_.begin(), childPtr_.end()-1L );
+
+      for( size_t s=0UL; s<S; ++s ) {
+         if( parent_[s] != invalid )
+            children_[pos[parent_[s]]++] = s;
+      }
+   }
+
+   // Computation of the column structure of the strictly lower part of the permuted matrix
+   std::vector<size_t> colPtr( n+1UL, 0UL );
+   std::vector<size_t> colIdx( lowerIdx.size() );
+
+   for( size_t j : lowerIdx ) {
+      ++colPtr[j+1UL];
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      colPtr[j+1UL] += colPtr[j];
+   }
+
+   {
+      std::vector<size_t> pos( colPtr.begin(), colPtr.end()-1L );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t k=lowerPtr[i]; k<lowerPtr[i+1UL]; ++k ) {
+            colIdx[pos[lowerIdx[k]]++] = i;
+         }
+      }
+   }
+
+   // Computation of the row structures of the supernodes
+   rowPtr_.assign( S+1UL, 0UL );
+   rows_.clear();
+   std::fill( mark.begin(), mark.end(), invalid );
+
+   for( size_t s=0UL; s<S; ++s )
+   {
+      const size_t f( first_[s] );
+      const size_t w( first_[s+1UL] - f );
+      const size_t start( rows_.size() );
+
+      for( size_t j=f; j<f+w; ++j ) {
+         rows_.push_back( j );
+         mark[j] = s;
+      }
+
+      for( size_t j=f; j<f+w; ++j ) {
+         for( size_t k=colPtr[j]; k<colPtr[j+1UL]; ++k ) {
+            const size_t i( colIdx[k] );
+            if( mark[i] != s ) {
+               mark[i] = s;
+               rows_.push_back( i );
+            }
+         }
+      }
+
+      for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k )
+      {
+         const size_t c( children_[k] );
+         const size_t wc( first_[c+1UL] - first_[c] );
+
+         for( size_t l=rowPtr_[c]+wc; l<rowPtr_[c+1UL]; ++l ) {
+            const size_t i( rows_[l] );
+            if( mark[i] != s ) {
+               mark[i] = s;
+               rows_.push_back( i );
+            }
+         }
+      }
+
+      std::sort( rows_.begin()+start+w, rows_.end() );
+      rowPtr_[s+1UL] = rows_.size();
+
+      BLAZE_INTERNAL_ASSERT( rows_.size() - start == counts[f], "Invalid row structure detected" );
+   }
+
+   // Computation of the positions of the update rows within the parent supernodes
+   relative_.assign( rows_.size(), invalid );
+
+   for( size_t s=0UL; s<S; ++s )
+   {
+      for( size_t k=rowPtr_[s]; k<rowPtr_[s+1UL]; ++k ) {
+         mark[rows_[k]] = k - rowPtr_[s];
+      }
+
+      for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k )
+      {
+         const size_t c( children_[k] );
+         const size_t wc( first_[c+1UL] - first_[c] );
+
+         for( size_t l=rowPtr_[c]+wc; l<rowPtr_[c+1UL]; ++l ) {
+            relative_[l] = mark[rows_[l]];
+         }
+      }
+   }
+
+   // Grouping of the supernodes by their height in the supernodal elimination tree
+   std::vector<size_t> height( S, 0UL );
+   size_t maxHeight( 0UL );
+
+   for( size_t s=0UL; s<S; ++s ) {
+      if( parent_[s] != invalid )
+         height[parent_[s]] = max( height[parent_[s]], height[s]+1UL );
+      maxHeight = max( maxHeight, height[s] );
+   }
+
+   levelPtr_.assign( ( S > 0UL ? maxHeight+2UL : 1UL ), 0UL );
+   levels_.resize( S );
+
+   for( size_t s=0UL; s<S; ++s ) {
+      ++levelPtr_[height[s]+1UL];
+   }
+
+   for( size_t l=1UL; l<levelPtr_.size(); ++l ) {
+      levelPtr_[l] += levelPtr_[l-1UL];
+   }
+
+   {
+      std::vector<size_t> pos( levelPtr_.begin(), levelPtr_.end()-1L );
+
+      for( size_t s=0UL; s<S; ++s ) {
+         levels_[pos[height[s]]++] = s;
+      }
+   }
+
+   // Computation of the assembly positions of the lower part of the permuted matrix
+   assemblyPtr_.assign( S+1UL, 0UL );
+
+   for( size_t r=0UL; r<n; ++r ) {
+      for( auto element=A.begin(r); element!=A.end(r); ++element ) {
+         const size_t j( pinv[element->index()] );
+         if( j <= pinv[r] )
+            ++assemblyPtr_[snode[j]+1UL];
+      }
+   }
+
+   for( size_t s=0UL; s<S; ++s ) {
+      assemblyPtr_[s+1UL] += assemblyPtr_[s];
+   }
+
+   frontRows_.resize( assemblyPtr_[S] );
+   frontCols_.resize( assemblyPtr_[S] );
+   targets_.clear();
+   targets_.reserve( nonZeros_ );
+
+   {
+      std::vector<size_t> pos( assemblyPtr_.begin(), assemblyPtr_.end()-1L );
+
+      for( size_t r=0UL; r<n; ++r )
+      {
+         for( auto element=A.begin(r); element!=A.end(r); ++element )
+         {
+            const size_t i( pinv[r] );
+            const size_t j( pinv[element->index()] );
+
+            if( j > i ) {
+               targets_.push_back( invalid );
+               continue;
+            }
+
+            const size_t s( snode[j] );
+            const size_t t( pos[s]++ );
+            const auto first( rows_.begin() + rowPtr_[s] );
+            const auto last ( rows_.begin() + rowPtr_[s+1UL] );
+
+            targets_.push_back( t );
+            frontRows_[t] = std::lower_bound( first, last, i ) - first;
+            frontCols_[t] = j - first_[s];
+         }
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( targets_.size() == nonZeros_, "Invalid number of non-zero elements" );
+
+   factors_.resize( S );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of a single supernode.
+//
+// \param s The index of the supernode.
+// \param values The values of the lower part of the permuted matrix in assembly order.
+// \param fronts The frontal matrices of all supernodes.
+// \return \a true in case the factorization succeeded, \a false if not.
+//
+// This function assembles the frontal matrix of the given supernode from the values of the
+// matrix and the update matrices of its children (which are released afterwards), factorizes
+// the columns of the supernode, and stores the resulting column block of the factor. The
+// remaining part of the frontal matrix is kept as update matrix for the parent supernode. Since
+// this function is executed in a parallel section, it must not throw any exception.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+bool SparseCholesky<Type,LDL>::factorizeSupernode( size_t s, const std::vector<Type>& values,
+                                                   std::vector<BlockType>& fronts )
+{
+   const size_t f( first_[s] );
+   const size_t w( first_[s+1UL] - f );
+   const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+
+   BlockType& F( fronts[s] );
+
+   F.resize( m, m, false );
+   reset( F );
+
+   // Assembly of the values of the matrix
+   for( size_t t=assemblyPtr_[s]; t<assemblyPtr_[s+1UL]; ++t ) {
+      F(frontRows_[t],frontCols_[t]) = values[t];
+   }
+
+   // Assembly of the update matrices of the children
+   for( size_t k=childPtr_[s]; k<childPtr_[s+1UL]; ++k )
+   {
+      const size_t c( children_[k] );
+      const size_t wc( first_[c+1UL] - first_[c] );
+      const size_t mc( rowPtr_[c+1UL] - rowPtr_[c] );
+      const size_t* relative( relative_.data() + rowPtr_[c] );
+
+      BlockType& C( fronts[c] );
+
+      for( size_t i=wc; i<mc; ++i ) {
+         for( size_t j=wc; j<=i; ++j ) {
+            F(relative[i],relative[j]) += C(i,j);
+         }
+      }
+
+      C = BlockType();
+   }
+
+   // Factorization of the columns of the supernode
+   const bool success( partialFactorization( F, w ) );
+
+   BlockType& L( factors_[s] );
+
+   L.resize( m, w, false );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<w; ++j ) {
+         L(i,j) = F(i,j);
+      }
+   }
+
+   if( parent_[s] == size_t(-1) ) {
+      F = BlockType();
+   }
+
+   return success;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Partial factorization of the leading columns of a frontal matrix.
+//
+// \param F The frontal matrix.
+// \param w The number of columns to be factorized.
+// \return \a true in case the factorization succeeded, \a false if not.
+//
+// This function factorizes the first \a w columns of the given frontal matrix, of which only
+// the lower part is referenced, by a blocked right-looking algorithm. Each panel of columns
+// is factorized column by column, before the trailing lower part of the frontal matrix is
+// updated block column by block column by means of the mmm() kernel. In case the frontal
+// matrix is large enough and no parallel section is active, the block columns are updated
+// in parallel. In case of the square root free decomposition, the diagonal elements of the
+// frontal matrix are replaced by the elements of \a D.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+bool SparseCholesky<Type,LDL>::partialFactorization( BlockType& F, size_t w ) const
+{
+   constexpr size_t panel( 64UL );   // The column width of the factorization panels
+   constexpr size_t block( 128UL );  // The column width of the trailing updates
+
+   const size_t m( F.rows() );
+
+   BlockType W;
+
+   for( size_t k0=0UL; k0<w; k0+=panel )
+   {
+      const size_t k1( min( k0+panel, w ) );
+
+      // Factorization of the panel
+      for( size_t k=k0; k<k1; ++k )
+      {
+         Type d( F(k,k) );
+
+         if( LDL ) {
+            if( isDefault<strict>( d ) )
+               return false;
+         }
+         else {
+            const auto diag( real( d ) );
+            if( !( diag > decltype( diag )( 0 ) ) )
+               return false;
+            d = Type( std::sqrt( diag ) );
+            F(k,k) = d;
+         }
+
+         const Type scale( Type(1) / d );
+
+         for( size_t i=k+1UL; i<m; ++i ) {
+            F(i,k) *= scale;
+         }
+
+         for( size_t j=k+1UL; j<k1; ++j ) {
+            const Type tmp( ( LDL )?( d * conj( F(j,k) ) ):( conj( F(j,k) ) ) );
+            for( size_t i=j; i<m; ++i ) {
+               F(i,j) -= F(i,k) * tmp;
+            }
+         }
+      }
+
+      if( k1 == m )
+         break;
+
+      // Update of the trailing lower part by means of the mmm() kernel
+      const size_t t( m - k1 );
+
+      W.resize( k1-k0, t, false );
+
+      for( size_t k=k0; k<k1; ++k ) {
+         const Type d( ( LDL )?( F(k,k) ):( Type(1) ) );
+         for( size_t j=0UL; j<t; ++j ) {
+            W(k-k0,j) = d * conj( F(k1+j,k) );
+         }
+      }
+
+      const size_t blocks( ( t + block - 1UL ) / block );
+      const size_t R( min( smpRanges( t*t, SMP_DMATDMATMULT_THRESHOLD ), blocks ) );
+
+      smpFor( R, [&]( size_t range )
+      {
+         for( size_t b=range; b<blocks; b+=R )
+         {
+            const size_t j0( k1 + b*block );
+            const size_t j1( min( j0+block, m ) );
+
+            auto C( submatrix( F, j0, j0, m-j0, j1-j0, unchecked ) );
+            const auto A( submatrix( F, j0, k0, m-j0, k1-k0, unchecked ) );
+            const auto B( submatrix( W, 0UL, j0-k1, k1-k0, j1-j0, unchecked ) );
+
+            updateBlock( C, A, B );
+         }
+      } );
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Update of a block column of a frontal matrix (\f$ C-=A*B \f$).
+//
+// \param C The block column to be updated.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+//
+// This function updates the given block column by means of the vectorized mmm() kernel.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT1   // Type of the target block column
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3 > // Type of the right-hand side operand
+inline EnableIf_t< IsVectorizable_v< ElementType_t<MT1> > &&
+                   HasSIMDMult_v< ElementType_t<MT2>, ElementType_t<MT3> > >
+   SparseCholesky<Type,LDL>::updateBlock( MT1& C, const MT2& A, const MT3& B )
+{
+   mmm( C, A, B, Type(-1), Type(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Update of a block column of a frontal matrix (\f$ C-=A*B \f$).
+//
+// \param C The block column to be updated.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \return void
+//
+// This function updates the given block column for data types that cannot be handled by the
+// vectorized mmm() kernel. Since the function is executed within a parallel loop, the update
+// must not trigger an SMP assignment and is therefore performed element by element.
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+template< typename MT1   // Type of the target block column
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3 > // Type of the right-hand side operand
+inline DisableIf_t< IsVectorizable_v< ElementType_t<MT1> > &&
+                    HasSIMDMult_v< ElementType_t<MT2>, ElementType_t<MT3> > >
+   SparseCholesky<Type,LDL>::updateBlock( MT1& C, const MT2& A, const MT3& B )
+{
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( size_t k=0UL; k<A.columns(); ++k ) {
+         const auto aik( A(i,k) );
+         for( size_t j=0UL; j<C.columns(); ++j ) {
+            C(i,j) -= aik * B(k,j);
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the permuted system by means of the supernodal factor.
+//
+// \param y The permuted right-hand side on input, the permuted solution on output.
+// \return void
+*/
+template< typename Type  // Data type of the decomposition
+        , bool LDL >     // Flag for the square root free decomposition
+void SparseCholesky<Type,LDL>::solveInPlace( DynamicVector<Type>& y ) const
+{
+   const size_t S( supernodes() );
+
+   DynamicVector<Type> tmp;
+
+   // Forward substitution
+   for( size_t s=0UL; s<S; ++s )
+   {
+      const size_t f( first_[s] );
+      const size_t w( first_[s+1UL] - f );
+      const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+      const size_t* rows( rows_.data() + rowPtr_[s] );
+      const BlockType& L( factors_[s] );
+
+      for( size_t k=0UL; k<w; ++k ) {
+         Type sum( y[f+k] );
+         for( size_t l=0UL; l<k; ++l ) {
+            sum -= L(k,l) * y[f+l];
+         }
+         y[f+k] = ( LDL )?( sum ):( sum / L(k,k) );
+      }
+
+      for( size_t i=w; i<m; ++i ) {
+         Type sum{};
+         for( size_t l=0UL; l<w; ++l ) {
+            sum += L(i,l) * y[f+l];
+         }
+         y[rows[i]] -= sum;
+      }
+   }
+
+   // Diagonal scaling
+   if( LDL ) {
+      for( size_t s=0UL; s<S; ++s ) {
+         for( size_t k=first_[s]; k<first_[s+1UL]; ++k ) {
+            y[k] /= factors_[s](k-first_[s],k-first_[s]);
+         }
+      }
+   }
+
+   // Backward substitution
+   for( size_t s=S; s-- > 0UL; )
+   {
+      const size_t f( first_[s] );
+      const size_t w( first_[s+1UL] - f );
+      const size_t m( rowPtr_[s+1UL] - rowPtr_[s] );
+      const size_t* rows( rows_.data() + rowPtr_[s] );
+      const BlockType& L( factors_[s] );
+
+      tmp.resize( w, false );
+
+      for( size_t l=0UL; l<w; ++l ) {
+         tmp[l] = y[f+l];
+      }
+
+      for( size_t i=w; i<m; ++i ) {
+         const Type yi( y[rows[i]] );
+         for( size_t l=0UL; l<w; ++l ) {
+            tmp[l] -= conj( L(i,l) ) * yi;
+         }
+      }
+
+      for( size_t k=w; k-- > 0UL; ) {
+         const Type yk( ( LDL )?( tmp[k] ):( tmp[k] / L(k,k) ) );
+         y[f+k] = yk;
+         for( size_t l=0UL; l<k; ++l ) {
+            tmp[l] -= conj( L(k,l) ) * yk;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,457 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseTriangularSolver.h
+//  \brief Header file for the level-scheduled sparse triangular solver
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSETRIANGULARSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_SPARSETRIANGULARSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solver for sparse triangular systems.
+// \ingroup solvers
+//
+// The SparseTriangularSolver class solves sparse lower or upper triangular systems
+// \f$ T\vec{x}=\vec{b} \f$ and \f$ TX=B \f$ by means of forward and backward substitution,
+// respectively. The solution is split into an analysis and a solve phase: The constructor
+// copies the triangular part of the given matrix and groups its rows into levels such that
+// the rows of a level only depend on rows of previous levels (see the LevelSchedule class).
+// The solve() functions then process the levels one after another, where all rows of a level
+// are processed in parallel in case a shared memory parallelization is enabled. Since the
+// analysis is performed only once, the same solver can be used for any number of solves:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::CompressedMatrix<double> U;
+   blaze::DynamicVector<double> x, b;
+   blaze::DynamicMatrix<double> X, B;
+   // ... Resizing and initialization
+
+   const blaze::SparseTriangularSolver<double> lower( L );  // Forward substitution
+   lower.solve( b, x );  // Solution of a single right-hand side
+   lower.solve( B, X );  // Solution of multiple right-hand sides (the columns of B)
+
+   const blaze::SparseTriangularSolver<double> upper( U, false, true );  // Unit upper part of U
+   upper.solve( x, x );  // In-place backward substitution
+   \endcode
+
+// In case the given matrix is a triangular adaptor (as for instance LowerMatrix, UpperMatrix,
+// UniLowerMatrix, or UniUpperMatrix), the kind of the system is deduced from the type of the
+// matrix. For any other sparse matrix, only the specified lower or upper part of the matrix
+// is considered and all other elements are ignored. In case the diagonal is not specified to
+// be unit, all diagonal elements of the matrix have to be non-zero.
+*/
+template< typename Type >  // Data type of the solver
+class SparseTriangularSolver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline SparseTriangularSolver( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   explicit inline SparseTriangularSolver( const SparseMatrix<MT,SO>& A,
+                                           bool lower, bool unit=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size()    const noexcept;
+   inline size_t levels()  const noexcept;
+   inline bool   isLower() const noexcept;
+   inline bool   isUnit()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void solve( const DenseVector<VT1,false>& b, DenseVector<VT2,false>& x ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void solve( const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& X ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline void extract( const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool lower_;                         //!< Flag for a lower (\a true) or upper (\a false) system.
+   bool unit_;                          //!< Flag for a unit diagonal.
+   CompressedMatrix<Type,rowMajor> T_;  //!< The off-diagonal elements of the triangular part.
+   DynamicVector<Type> inv_;            //!< The inverted diagonal elements.
+   LevelSchedule schedule_;             //!< The level schedule of the substitution.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Analysis of the given triangular adaptor.
+//
+// \param A The triangular sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Singular triangular matrix detected.
+//
+// This constructor deduces the kind of the triangular system from the type of the given
+// matrix: Lower (and diagonal) matrices result in a forward substitution, upper matrices in
+// a backward substitution. In case of a unitriangular matrix, the diagonal is not accessed.
+*/
+template< typename Type >  // Data type of the solver
+template< typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order of the sparse matrix
+inline SparseTriangularSolver<Type>::SparseTriangularSolver( const SparseMatrix<MT,SO>& A )
+   : SparseTriangularSolver( A, IsLower_v<MT>, IsUniTriangular_v<MT> )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analysis of the lower or upper part of the given sparse matrix.
+//
+// \param A The sparse matrix.
+// \param lower \a true for the lower part of \a A, \a false for the upper part of \a A.
+// \param unit \a true in case the diagonal is assumed to be unit, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Singular triangular matrix detected.
+//
+// This constructor copies the specified part of the given matrix and computes the dependency
+// levels of its rows. In case \a unit is \a true, the diagonal elements of \a A are ignored.
+// Otherwise all diagonal elements have to be non-zero.
+*/
+template< typename Type >  // Data type of the solver
+template< typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order of the sparse matrix
+inline SparseTriangularSolver<Type>::SparseTriangularSolver( const SparseMatrix<MT,SO>& A,
+                                                             bool lower, bool unit )
+   : lower_   ( lower )  // Flag for a lower or upper system
+   , unit_    ( unit )   // Flag for a unit diagonal
+   , T_       ()         // The off-diagonal elements of the triangular part
+   , inv_     ()         // The inverted diagonal elements
+   , schedule_()         // The level schedule of the substitution
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand tmp( ~A );  // Row-major evaluation of the sparse matrix
+
+   extract( tmp );
+
+   schedule_ = LevelSchedule( T_, lower_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the triangular system.
+//
+// \return The size of the triangular system.
+*/
+template< typename Type >  // Data type of the solver
+inline size_t SparseTriangularSolver<Type>::size() const noexcept
+{
+   return T_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of dependency levels of the triangular system.
+//
+// \return The number of levels.
+//
+// The number of levels is the number of sequential steps of the substitution. The smaller
+// the number of levels in comparison to the size of the system, the higher the degree of
+// parallelism of the substitution.
+*/
+template< typename Type >  // Data type of the solver
+inline size_t SparseTriangularSolver<Type>::levels() const noexcept
+{
+   return schedule_.levels();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the solver performs a forward substitution.
+//
+// \return \a true in case of a lower triangular system, \a false in case of an upper system.
+*/
+template< typename Type >  // Data type of the solver
+inline bool SparseTriangularSolver<Type>::isLower() const noexcept
+{
+   return lower_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the diagonal of the triangular system is unit.
+//
+// \return \a true in case of a unit diagonal, \a false if not.
+*/
+template< typename Type >  // Data type of the solver
+inline bool SparseTriangularSolver<Type>::isUnit() const noexcept
+{
+   return unit_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the triangular part of the given row-major sparse matrix.
+//
+// \param A The row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Singular triangular matrix detected.
+*/
+template< typename Type >  // Data type of the solver
+template< typename MT >     // Type of the row-major sparse matrix
+inline void SparseTriangularSolver<Type>::extract( const MT& A )
+{
+   const size_t n( A.rows() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( lower_ ? ( j < i ) : ( j > i ) )
+            ++nonzeros;
+      }
+   }
+
+   T_.resize( n, n, false );
+   T_.reserve( nonzeros );
+
+   if( !unit_ ) {
+      inv_.resize( n, false );
+   }
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      bool singular( true );
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element )
+      {
+         const size_t j( element->index() );
+
+         if( lower_ ? ( j < i ) : ( j > i ) ) {
+            T_.append( i, j, element->value() );
+         }
+         else if( j == i && !unit_ && !isDefault<strict>( element->value() ) ) {
+            inv_[i] = inv( Type( element->value() ) );
+            singular = false;
+         }
+      }
+
+      T_.finalize( i );
+
+      if( !unit_ && singular ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Singular triangular matrix detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of the triangular system \f$ T\vec{x}=\vec{b} \f$.
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the triangular system for the given right-hand side vector \a b by
+// means of a level-scheduled forward or backward substitution. In case \a x is resizable, it
+// is resized to the size of the system. The vectors \a b and \a x may refer to the same vector.
+*/
+template< typename Type >  // Data type of the solver
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+inline void SparseTriangularSolver<Type>::solve( const DenseVector<VT1,false>& b,
+                                                 DenseVector<VT2,false>& x ) const
+{
+   const size_t n( T_.rows() );
+
+   if( (~b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   resize( ~x, n, false );
+
+   schedule_.run( [&]( size_t i )
+   {
+      Type tmp( (~b)[i] );
+
+      for( auto element=T_.begin(i); element!=T_.end(i); ++element ) {
+         tmp -= element->value() * (~x)[element->index()];
+      }
+
+      (~x)[i] = ( unit_ )?( tmp ):( tmp * inv_[i] );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the triangular system \f$ TX=B \f$ with multiple right-hand sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \param X The resulting solution matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function solves the triangular system for all columns of the given matrix \a B at once.
+// Each row of the solution is computed for all right-hand sides before moving to the next row,
+// which reuses every element of the triangular matrix for all right-hand sides. In case \a X
+// is resizable, it is resized to the size of \a B. The matrices \a B and \a X may refer to the
+// same matrix.
+*/
+template< typename Type >  // Data type of the solver
+template< typename MT1     // Type of the right-hand side matrix
+        , bool SO1         // Storage order of the right-hand side matrix
+        , typename MT2     // Type of the solution matrix
+        , bool SO2 >       // Storage order of the solution matrix
+inline void SparseTriangularSolver<Type>::solve( const DenseMatrix<MT1,SO1>& B,
+                                                 DenseMatrix<MT2,SO2>& X ) const
+{
+   const size_t n( T_.rows() );
+   const size_t N( (~B).columns() );
+
+   if( (~B).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   resize( ~X, n, N, false );
+
+   schedule_.run( [&]( size_t i )
+   {
+      for( size_t j=0UL; j<N; ++j ) {
+         (~X)(i,j) = (~B)(i,j);
+      }
+
+      for( auto element=T_.begin(i); element!=T_.end(i); ++element ) {
+         const size_t k( element->index() );
+         for( size_t j=0UL; j<N; ++j ) {
+            (~X)(i,j) -= element->value() * (~X)(k,j);
+         }
+      }
+
+      if( !unit_ ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            (~X)(i,j) *= inv_[i];
+         }
+      }
+   }, N );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
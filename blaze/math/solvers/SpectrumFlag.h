@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SpectrumFlag.h
+//  \brief Header file for the spectrum flag enumeration
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPECTRUMFLAG_H_
+#define _BLAZE_MATH_SOLVERS_SPECTRUMFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPECTRUM FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Spectrum flag.
+// \ingroup solvers
+//
+// The SpectrumFlag type enumeration selects the part of the spectrum that is computed by the
+// iterative eigensolvers (see the lanczos() and arnoldi() functions). The following flags are
+// available:
+//
+//  - \c largestMagnitude: The eigenvalues with the largest absolute value.
+//  - \c smallestMagnitude: The eigenvalues with the smallest absolute value. Note that these
+//          eigenvalues are usually poorly separated and therefore converge slowly. In this case
+//          it is recommended to compute the largest eigenvalues of \f$ A^{-1} \f$ instead.
+//  - \c largestReal: The eigenvalues with the largest (real part of the) value.
+//  - \c smallestReal: The eigenvalues with the smallest (real part of the) value.
+*/
+enum SpectrumFlag
+{
+   largestMagnitude  = 0,  //!< Flag for the eigenvalues of largest magnitude.
+   smallestMagnitude = 1,  //!< Flag for the eigenvalues of smallest magnitude.
+   largestReal       = 2,  //!< Flag for the eigenvalues of largest real part.
+   smallestReal      = 3   //!< Flag for the eigenvalues of smallest real part.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1459 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AssemblyMatrix.h
+//  \brief Implementation of a sparse matrix for the incremental assembly of sparsity patterns
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ASSEMBLYMATRIX_H_
+#define _BLAZE_MATH_SPARSE_ASSEMBLYMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup assembly_matrix AssemblyMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sparse matrix for the incremental assembly of sparsity patterns.
+// \ingroup assembly_matrix
+//
+// The AssemblyMatrix class template is a \f$ M \times N \f$ sparse matrix that is optimized
+// for the incremental assembly of a sparsity pattern, as for instance required by finite element
+// codes or by adaptive mesh refinement. The type of the elements and the storage order of the
+// matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class AssemblyMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. AssemblyMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// In contrast to the CompressedMatrix, which stores all non-zero elements in a single array,
+// the AssemblyMatrix stores each row (for row-major matrices) or column (for column-major
+// matrices) in a separate block of memory. In case a block runs out of capacity, only this
+// block is reallocated with additional slack. Therefore the insertion of an element only moves
+// the elements of a single row/column and the capacity of each row/column grows geometrically,
+// i.e. the reallocation cost is amortized constant per insertion, independent of the total
+// number of non-zero elements. Additionally, since no state is shared between the rows/columns,
+// it is possible to concurrently insert, set, add, or erase elements in different rows/columns
+// of the same matrix from several threads.
+//
+// The AssemblyMatrix is not meant to take part in arithmetic operations. After the assembly is
+// finished, the compress() function converts it into a CompressedMatrix for the computational
+// phase:
+
+   \code
+   using blaze::AssemblyMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+
+   AssemblyMatrix<double,rowMajor> A( 1000UL, 1000UL, 9UL );
+
+   // Concurrent assembly of distinct rows
+   #pragma omp parallel for
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      // ... Adding the contributions of the i-th row via A.add( i, j, value )
+   }
+
+   // Conversion into a compressed matrix for the computational phase
+   const CompressedMatrix<double,rowMajor> B( A.compress() );
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class AssemblyMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = AssemblyMatrix<Type,SO>;    //!< Type of this AssemblyMatrix instance.
+   using ResultType     = CompressedMatrix<Type,SO>;  //!< Type of the compressed matrix.
+   using ElementType    = Type;                       //!< Type of the matrix elements.
+   using ConstReference = const Type&;                //!< Reference to a constant matrix value.
+   using Element        = ValueIndexPair<Type>;       //!< Value-index-pair of the matrix.
+   using Iterator       = Element*;                   //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;             //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain an AssemblyMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = AssemblyMatrix<NewType,SO>;  //!< The type of the other AssemblyMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AssemblyMatrix() noexcept;
+   explicit inline AssemblyMatrix( size_t m, size_t n );
+   explicit inline AssemblyMatrix( size_t m, size_t n, size_t nonzeros );
+
+   inline AssemblyMatrix( const AssemblyMatrix& am );
+   inline AssemblyMatrix( AssemblyMatrix&& am ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AssemblyMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline AssemblyMatrix& operator=( const AssemblyMatrix& rhs );
+   inline AssemblyMatrix& operator=( AssemblyMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset() noexcept;
+   inline void   reset( size_t i ) noexcept;
+   inline void   clear();
+          void   reserve( size_t i, size_t nonzeros );
+          void   shrinkToFit();
+   inline void   swap( AssemblyMatrix& am ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j, const Type& value );
+   inline Iterator insert( size_t i, size_t j, const Type& value );
+   inline Iterator add   ( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void erase( size_t i, size_t j );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Compression functions***********************************************************************
+   /*!\name Compression functions */
+   //@{
+   inline ResultType compress() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   size() const noexcept;
+   inline size_t   extendCapacity( size_t k ) const noexcept;
+   inline Iterator insert( Iterator pos, size_t k, size_t index, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the matrix.
+   size_t n_;         //!< The current number of columns of the matrix.
+   Iterator* begin_;  //!< Pointers to the first non-zero element of each row/column.
+   Iterator* end_;    //!< Pointers one past the last non-zero element of each row/column.
+   Iterator* last_;   //!< Pointers one past the last reserved element of each row/column.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+const Type AssemblyMatrix<Type,SO>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for AssemblyMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::AssemblyMatrix() noexcept
+   : m_    ( 0UL )      // The current number of rows of the matrix
+   , n_    ( 0UL )      // The current number of columns of the matrix
+   , begin_( nullptr )  // Pointers to the first non-zero element of each row/column
+   , end_  ( nullptr )  // Pointers one past the last non-zero element of each row/column
+   , last_ ( nullptr )  // Pointers one past the last reserved element of each row/column
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::AssemblyMatrix( size_t m, size_t n )
+   : AssemblyMatrix( m, n, 0UL )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The initial capacity of each row/column.
+//
+// The matrix is initialized to the zero matrix and provides an initial capacity of \a nonzeros
+// elements for each row (for row-major matrices) or column (for column-major matrices).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::AssemblyMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_    ( m )        // The current number of rows of the matrix
+   , n_    ( n )        // The current number of columns of the matrix
+   , begin_( nullptr )  // Pointers to the first non-zero element of each row/column
+   , end_  ( nullptr )  // Pointers one past the last non-zero element of each row/column
+   , last_ ( nullptr )  // Pointers one past the last reserved element of each row/column
+{
+   const size_t k( size() );
+
+   begin_ = new Iterator[3UL*k];
+   end_   = begin_ + k;
+   last_  = end_   + k;
+
+   std::fill( begin_, begin_+3UL*k, nullptr );
+
+   try {
+      if( nonzeros > 0UL ) {
+         for( size_t i=0UL; i<k; ++i ) {
+            begin_[i] = end_[i] = allocate<Element>( nonzeros );
+            last_[i]  = begin_[i] + nonzeros;
+         }
+      }
+   }
+   catch( ... ) {
+      this->~AssemblyMatrix();
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for AssemblyMatrix.
+//
+// \param am Matrix to be copied.
+//
+// The copy constructor allocates exactly the number of non-zero elements of each row/column
+// of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::AssemblyMatrix( const AssemblyMatrix& am )
+   : AssemblyMatrix( am.m_, am.n_ )
+{
+   const size_t k( size() );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      const size_t nonzeros( am.nonZeros( i ) );
+      if( nonzeros == 0UL ) continue;
+      begin_[i] = end_[i] = last_[i] = allocate<Element>( nonzeros );
+      end_[i] = last_[i] = std::copy( am.begin_[i], am.end_[i], begin_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for AssemblyMatrix.
+//
+// \param am The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::AssemblyMatrix( AssemblyMatrix&& am ) noexcept
+   : m_    ( am.m_     )  // The current number of rows of the matrix
+   , n_    ( am.n_     )  // The current number of columns of the matrix
+   , begin_( am.begin_ )  // Pointers to the first non-zero element of each row/column
+   , end_  ( am.end_   )  // Pointers one past the last non-zero element of each row/column
+   , last_ ( am.last_  )  // Pointers one past the last reserved element of each row/column
+{
+   am.m_     = 0UL;
+   am.n_     = 0UL;
+   am.begin_ = nullptr;
+   am.end_   = nullptr;
+   am.last_  = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for AssemblyMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>::~AssemblyMatrix()
+{
+   if( begin_ != nullptr ) {
+      const size_t k( size() );
+      for( size_t i=0UL; i<k; ++i ) {
+         deallocate( begin_[i] );
+      }
+      delete[] begin_;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for AssemblyMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>& AssemblyMatrix<Type,SO>::operator=( const AssemblyMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   AssemblyMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for AssemblyMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline AssemblyMatrix<Type,SO>& AssemblyMatrix<Type,SO>::operator=( AssemblyMatrix&& rhs ) noexcept
+{
+   AssemblyMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstReference
+   AssemblyMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end_[ SO ? j : i ] )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstReference
+   AssemblyMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::capacity() const noexcept
+{
+   size_t capacity( 0UL );
+
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      capacity += last_[i] - begin_[i];
+
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return last_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::nonZeros() const noexcept
+{
+   size_t nonzeros( 0UL );
+
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      nonzeros += end_[i] - begin_[i];
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements from the matrix. Note that the capacity of the
+// rows/columns remains unchanged, which enables the reassembly of a similar sparsity pattern
+// without any reallocation.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void AssemblyMatrix<Type,SO>::reset() noexcept
+{
+   const size_t k( size() );
+   for( size_t i=0UL; i<k; ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to reset.
+// \return void
+//
+// This function removes all non-zero elements from row/column \a i. Note that the capacity of
+// the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void AssemblyMatrix<Type,SO>::reset( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0 and all memory is released.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void AssemblyMatrix<Type,SO>::clear()
+{
+   AssemblyMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the matrix to at least \a nonzeros
+// elements. The current values of the row/column and all other rows/columns are preserved.
+// Since only the memory of row/column \a i is touched, it is possible to reserve capacity for
+// different rows/columns concurrently.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void AssemblyMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < size(), "Invalid row/column access index" );
+
+   if( nonzeros <= capacity( i ) )
+      return;
+
+   Iterator newBegin( allocate<Element>( nonzeros ) );
+   Iterator newEnd( transfer( begin_[i], end_[i], newBegin ) );
+
+   std::swap( begin_[i], newBegin );
+   end_ [i] = newEnd;
+   last_[i] = begin_[i] + nonzeros;
+
+   deallocate( newBegin );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The shrinkToFit() function can be used to reverse the effect of all row/column-specific
+// reserve() calls and of the slack added during the assembly. Rows/columns without any
+// non-zero elements release their complete memory.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void AssemblyMatrix<Type,SO>::shrinkToFit()
+{
+   const size_t k( size() );
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      if( end_[i] == last_[i] ) continue;
+
+      Iterator newBegin( nullptr );
+      Iterator newEnd  ( nullptr );
+
+      if( end_[i] != begin_[i] ) {
+         newBegin = allocate<Element>( end_[i] - begin_[i] );
+         newEnd   = transfer( begin_[i], end_[i], newBegin );
+      }
+
+      std::swap( begin_[i], newBegin );
+      end_ [i] = newEnd;
+      last_[i] = newEnd;
+
+      deallocate( newBegin );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param am The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void AssemblyMatrix<Type,SO>::swap( AssemblyMatrix& am ) noexcept
+{
+   std::swap( m_, am.m_ );
+   std::swap( n_, am.n_ );
+   std::swap( begin_, am.begin_ );
+   std::swap( end_, am.end_ );
+   std::swap( last_, am.last_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of separately stored rows/columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::size() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new capacity for the given row/column.
+//
+// \param k The index of the row/column.
+// \return The new capacity of the row/column.
+//
+// This function calculates a new capacity for the given row/column of the matrix. The
+// capacity grows geometrically in order to guarantee an amortized constant reallocation
+// cost per insertion.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t AssemblyMatrix<Type,SO>::extendCapacity( size_t k ) const noexcept
+{
+   size_t nonzeros( 2UL*capacity( k ) );
+   nonzeros = blaze::max( nonzeros, 4UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity( k ), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the matrix. In case the matrix already contains
+// an element with row index \a i and column index \a j its value is modified, else a new element
+// with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index() == index ) {
+      pos->value() = value;
+      return pos;
+   }
+   else return insert( pos, k, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid matrix access index.
+//
+// This function inserts a new element into the matrix. However, duplicate elements are not
+// allowed. In case the matrix already contains an element with row index \a i and column
+// index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index() == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, k, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a contribution to an element of the matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value to be added to the element.
+// \return Iterator to the modified element.
+//
+// This function adds the given \a value to the element with row index \a i and column index
+// \a j. In case the matrix does not yet contain this element, a new element with the given
+// \a value is inserted. This is the typical operation during the assembly of a finite element
+// system matrix:
+
+   \code
+   blaze::AssemblyMatrix<double> A( 100UL, 100UL, 9UL );
+   A.add( 2UL, 3UL, 1.0 );  // Inserts the element (2,3)
+   A.add( 2UL, 3UL, 2.0 );  // Results in A(2,3) == 3.0
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::add( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index() == index ) {
+      pos->value() += value;
+      return pos;
+   }
+   else return insert( pos, k, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Insertion of an element at the given position of a row/column.
+//
+// \param pos The position of the new element.
+// \param k The index of the row/column.
+// \param index The column/row index of the new element.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+//
+// In case row/column \a k has no free capacity, only this row/column is reallocated with a
+// geometrically increased capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::insert( Iterator pos, size_t k, size_t index, const Type& value )
+{
+   if( end_[k] != last_[k] ) {
+      std::move_backward( pos, end_[k], end_[k]+1UL );
+      *pos = Element( value, index );
+      ++end_[k];
+      return pos;
+   }
+   else {
+      const size_t newCapacity( extendCapacity( k ) );
+
+      Iterator newBegin( allocate<Element>( newCapacity ) );
+      Iterator newPos  ( transfer( begin_[k], pos, newBegin ) );
+      *newPos = Element( value, index );
+      Iterator newEnd  ( transfer( pos, end_[k], newPos+1UL ) );
+
+      std::swap( begin_[k], newBegin );
+      end_ [k] = newEnd;
+      last_[k] = begin_[k] + newCapacity;
+
+      deallocate( newBegin );
+
+      return newPos;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the matrix. Note that the capacity of the according
+// row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void AssemblyMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const Iterator pos( find( i, j ) );
+
+   if( pos != end_[k] ) {
+      end_[k] = transfer( pos+1UL, end_[k], pos );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// In case the element is not found, the function returns the end() iterator of row \a i (for
+// row-major matrices) or column \a j (for column-major matrices).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end_[k] && pos->index() == index )
+      return pos;
+   else return end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::Iterator
+   AssemblyMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// The elements of each row/column are kept in ascending index order. Due to the small number
+// of elements per row/column that is typical for assembled matrices, the search is performed
+// linearly for short rows/columns and via binary search otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ConstIterator
+   AssemblyMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k    ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const ConstIterator first( begin_[k] );
+   const ConstIterator last ( end_[k]   );
+
+   if( last - first <= 16L ) {
+      ConstIterator pos( first );
+      while( pos != last && pos->index() < index )
+         ++pos;
+      return pos;
+   }
+
+   return std::lower_bound( first, last, index,
+                            []( const Element& element, size_t idx )
+                            {
+                               return element.index() < idx;
+                            } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the matrix into a compressed matrix.
+//
+// \return The compressed matrix containing all non-zero elements of the matrix.
+//
+// This function converts the matrix into a CompressedMatrix with the same storage order for
+// the computational phase. The compressed matrix is allocated exactly once with a capacity that
+// exactly matches the number of non-zero elements of each row/column and the elements are
+// copied in a single pass. The assembly matrix itself remains unchanged, which enables a later
+// modification and recompression, for instance after a refinement step.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename AssemblyMatrix<Type,SO>::ResultType AssemblyMatrix<Type,SO>::compress() const
+{
+   const size_t k( size() );
+
+   std::vector<size_t> nonzeros( k );
+   for( size_t i=0UL; i<k; ++i ) {
+      nonzeros[i] = end_[i] - begin_[i];
+   }
+
+   ResultType tmp( m_, n_, nonzeros );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( ConstIterator element=begin_[i]; element!=end_[i]; ++element ) {
+         if( SO )
+            tmp.append( element->index(), i, element->value() );
+         else
+            tmp.append( i, element->index(), element->value() );
+      }
+      tmp.finalize( i );
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the matrix are intact.
+//
+// \return \a true in case the matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the matrix are intact, i.e. if its state is
+// valid. In case the invariants are intact, the function returns \a true, else it will return
+// \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool AssemblyMatrix<Type,SO>::isIntact() const noexcept
+{
+   const size_t k( size() );
+   const size_t n( SO ? m_ : n_ );
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      if( begin_[i] > end_[i] || end_[i] > last_[i] )
+         return false;
+
+      for( ConstIterator element=begin_[i]; element!=end_[i]; ++element ) {
+         if( element->index() >= n )
+            return false;
+         if( element != begin_[i] && (element-1)->index() >= element->index() )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSEMBLYMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name AssemblyMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( AssemblyMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+inline void reset( AssemblyMatrix<Type,SO>& m, size_t i ) noexcept;
+
+template< typename Type, bool SO >
+inline void clear( AssemblyMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const AssemblyMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+inline void swap( AssemblyMatrix<Type,SO>& a, AssemblyMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given assembly matrix.
+// \ingroup assembly_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( AssemblyMatrix<Type,SO>& m ) noexcept
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given assembly matrix.
+// \ingroup assembly_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( AssemblyMatrix<Type,SO>& m, size_t i ) noexcept
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given assembly matrix.
+// \ingroup assembly_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( AssemblyMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given assembly matrix are intact.
+// \ingroup assembly_matrix
+//
+// \param m The assembly matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const AssemblyMatrix<Type,SO>& m ) noexcept
+{
+   return m.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two assembly matrices.
+// \ingroup assembly_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( AssemblyMatrix<Type,SO>& a, AssemblyMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1900 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed sparse row (BSR) matrix
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Block-sparse matrix in block compressed sparse row (BSR) format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is a \f$ M \times N \f$ sparse matrix that consists
+// of dense \f$ B \times B \f$ blocks. Only the non-zero blocks are stored, row by row and sorted
+// by their block column index, similar to the non-zero elements of a row-major CompressedMatrix.
+// The type of the elements and the block size are specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of each block.
+//
+// The number of rows and columns of the matrix have to be multiples of \a B. Each block is
+// stored as a column-major StaticMatrix and only a single column index is stored per block.
+// Therefore the memory traffic for the indices is reduced by a factor of \f$ B^2 \f$ compared to
+// a CompressedMatrix and the multiplication kernels operate on complete SIMD vectors of a block
+// column. This format is particularly suited for systems with several unknowns per node, as for
+// instance in finite element methods for elasticity or multiphysics problems.
+//
+// A BlockCompressedMatrix can be created from any sparse matrix. Alternatively, it can be set
+// up directly via the low-level functions reserve(), append(), and finalize(), which work on
+// block indices, and the stored blocks can be modified in place via the block iterators:
+
+   \code
+   using blaze::BlockCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::StaticMatrix;
+
+   CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization
+
+   BlockCompressedMatrix<double,3UL> S( A );  // Conversion into 3x3 blocks
+
+   // Accumulating an element contribution into the existing block (0,1)
+   StaticMatrix<double,3UL,3UL,blaze::columnMajor> Ke;
+   auto block = S.find( 0UL, 1UL );
+   if( block != S.end( 0UL ) )
+      block->value() += Ke;
+
+   DynamicVector<double> x( 3000UL ), y;
+   DynamicMatrix<double> X( 3000UL, 8UL ), Y;
+   // ... Initialization
+
+   y  = S * x;  // Block-sparse matrix/dense vector multiplication
+   y -= S * x;  // Subtraction assignment
+   Y  = S * X;  // Block-sparse matrix/dense matrix multiplication
+
+   const CompressedMatrix<double> B( S.compress() );  // Conversion into a compressed matrix
+   \endcode
+
+// The multiplications are executed in parallel in case the number of scalar multiplications
+// exceeds the BLAZE_SMP_BLOCKMATMULT_THRESHOLD. Note that the zero elements within a stored
+// block are multiplied explicitly.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+class BlockCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = BlockCompressedMatrix<Type,B>;           //!< Type of this BlockCompressedMatrix instance.
+   using ResultType  = This;                                    //!< Result type for expression template evaluations.
+   using ElementType = Type;                                    //!< Type of the matrix elements.
+   using BlockType   = StaticMatrix<Type,B,B,columnMajor>;      //!< Type of the matrix blocks.
+   using ReturnType  = const Type&;                             //!< Return type for expression template evaluations.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BlockCompressedMatrix<NewType,B>;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**BlockIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero blocks of a block row.
+   */
+   template< typename BT >  // Type of the blocks
+   class BlockIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using ValueType = BT;  //!< Type of the underlying blocks.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor of the BlockIterator class.
+      */
+      inline BlockIterator() noexcept
+         : value_( nullptr )  // Pointer to the current block
+         , index_( nullptr )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor of the BlockIterator class.
+      //
+      // \param value Pointer to the initial block.
+      // \param index Pointer to the block column index of the initial block.
+      */
+      inline BlockIterator( BT* value, const size_t* index ) noexcept
+         : value_( value )  // Pointer to the current block
+         , index_( index )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Conversion constructor from different BlockIterator instances.
+      //
+      // \param it The block iterator to be copied.
+      */
+      template< typename BT2 >
+      inline BlockIterator( const BlockIterator<BT2>& it ) noexcept
+         : value_( it.value_ )  // Pointer to the current block
+         , index_( it.index_ )  // Pointer to the block column index of the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BlockIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BlockIterator operator++( int ) noexcept {
+         const BlockIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current block.
+      //
+      // \return Pointer to the iterator, which provides the value() and index() functions.
+      */
+      inline const BlockIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current block.
+      //
+      // \return Reference to the current block.
+      */
+      inline BT& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the block column index of the current block.
+      //
+      // \return The block column index of the current block.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BlockIterator objects.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return \a true if the iterators refer to the same block, \a false if not.
+      */
+      inline bool operator==( const BlockIterator& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BlockIterator objects.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return \a true if the iterators don't refer to the same block, \a false if they do.
+      */
+      inline bool operator!=( const BlockIterator& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of blocks between two block iterators.
+      //
+      // \param rhs The right-hand side block iterator.
+      // \return The number of blocks between the two block iterators.
+      */
+      inline ptrdiff_t operator-( const BlockIterator& rhs ) const noexcept {
+         return value_ - rhs.value_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      BT*           value_;  //!< Pointer to the current block.
+      const size_t* index_;  //!< Pointer to the block column index of the current block.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename BT2 > friend class BlockIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator      = BlockIterator<BlockType>;        //!< Iterator over non-constant blocks.
+   using ConstIterator = BlockIterator<const BlockType>;  //!< Iterator over constant blocks.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix() noexcept;
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+   explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO >
+   explicit inline BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm );
+
+   inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   inline BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   inline BlockCompressedMatrix& operator=( BlockCompressedMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ReturnType    operator()( size_t i, size_t j ) const noexcept;
+   inline ReturnType    at( size_t i, size_t j ) const;
+   inline Iterator      begin ( size_t i ) noexcept;
+   inline ConstIterator begin ( size_t i ) const noexcept;
+   inline ConstIterator cbegin( size_t i ) const noexcept;
+   inline Iterator      end   ( size_t i ) noexcept;
+   inline ConstIterator end   ( size_t i ) const noexcept;
+   inline ConstIterator cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t blockRows() const noexcept;
+   inline size_t blockColumns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeroBlocks() const noexcept;
+   inline size_t nonZeroBlocks( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( BlockCompressedMatrix& sm ) noexcept;
+
+   static constexpr size_t blockSize() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void reserve ( size_t nonzeros );
+   inline void append  ( size_t i, size_t j, const BlockType& block );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   inline CompressedMatrix<Type,rowMajor> compress() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the element type of the right-hand side operand is suited for a vectorized
+       multiplication with the blocks of the matrix, the variable will be set to 1, otherwise
+       it will be 0. */
+   template< typename T >
+   static constexpr bool UseVectorizedKernel_v =
+      ( useOptimizedKernels &&
+        BlockType::simdEnabled && IsPadded_v<BlockType> &&
+        IsSame_v< Type, T > &&
+        HasSIMDAdd_v< Type, Type > &&
+        HasSIMDMult_v< Type, Type > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename VT >
+   inline MultTrait_t< Type, ElementType_t<VT> > multiply( size_t i, const VT& x ) const;
+
+   template< typename MT >
+   inline MultTrait_t< Type, ElementType_t<MT> > multiply( size_t i, size_t j, const MT& X ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   void multiply( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x, OP op ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2, typename OP >
+   void multiply( DenseMatrix<MT1,SO1>& Y, const DenseMatrix<MT2,SO2>& X, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t threads( size_t columns ) const noexcept;
+   inline size_t partition( size_t t, size_t threads ) const noexcept;
+
+   template< typename XA, typename YA >
+   inline void multiplyBlockRow( size_t i, XA x, YA y, FalseType ) const;
+
+   template< typename XA, typename YA >
+   inline void multiplyBlockRow( size_t i, XA x, YA y, TrueType ) const;
+
+   template< typename MT1, typename MT2, typename OP >
+   inline void multiplyBlockRow( size_t i, MT1& Y, const MT2& X, OP op, FalseType ) const;
+
+   template< typename MT1, typename MT2, typename OP >
+   inline void multiplyBlockRow( size_t i, MT1& Y, const MT2& X, OP op, TrueType ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                                                 //!< The current number of rows of the matrix.
+   size_t n_;                                                 //!< The current number of columns of the matrix.
+   std::vector<BlockType,AlignedAllocator<BlockType>> values_;  //!< The non-zero blocks.
+   std::vector<size_t> indices_;                              //!< The block column indices of the non-zero blocks.
+   std::vector<size_t> offsets_;                              //!< The offset of each block row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+const Type BlockCompressedMatrix<Type,B>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix() noexcept
+   : m_      ( 0UL )       // The current number of rows of the matrix
+   , n_      ( 0UL )       // The current number of columns of the matrix
+   , values_ ()            // The non-zero blocks
+   , indices_()            // The block column indices of the non-zero blocks
+   , offsets_( 1UL, 0UL )  // The offset of each block row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a block-sparse matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid matrix dimensions for the block size.
+//
+// The matrix is initialized as empty sparse matrix without free capacity. In case \a m or
+// \a n is not a multiple of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n )
+   : BlockCompressedMatrix( m, n, 0UL )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a block-sparse matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero blocks.
+// \exception std::invalid_argument Invalid matrix dimensions for the block size.
+//
+// The matrix is initialized as empty sparse matrix with memory for at least \a nonzeros
+// non-zero blocks. In case \a m or \a n is not a multiple of the block size, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_      ( m )                // The current number of rows of the matrix
+   , n_      ( n )                // The current number of columns of the matrix
+   , values_ ()                   // The non-zero blocks
+   , indices_()                   // The block column indices of the non-zero blocks
+   , offsets_( m/B+1UL, 0UL )     // The offset of each block row
+{
+   if( m % B != 0UL || n % B != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix dimensions for the block size" );
+   }
+
+   reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a sparse matrix.
+//
+// \param sm Sparse matrix to be converted.
+// \exception std::invalid_argument Invalid matrix dimensions for the block size.
+//
+// This constructor converts the given sparse matrix into the block compressed format. Each
+// block that contains at least one stored element of \a sm becomes a non-zero block, all other
+// elements of the block are set to zero. In case the number of rows or columns of \a sm is not
+// a multiple of the block size, a \a std::invalid_argument exception is thrown. Column-major
+// matrices are converted into a temporary row-major compressed matrix first.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_      ( (~sm).rows() )             // The current number of rows of the matrix
+   , n_      ( (~sm).columns() )          // The current number of columns of the matrix
+   , values_ ()                           // The non-zero blocks
+   , indices_()                           // The block column indices of the non-zero blocks
+   , offsets_( (~sm).rows()/B+1UL, 0UL )  // The offset of each block row
+{
+   if( m_ % B != 0UL || n_ % B != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix dimensions for the block size" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand A( ~sm );  // Row-major evaluation of the sparse matrix
+
+   const size_t M( blockRows() );
+   const size_t N( blockColumns() );
+   const size_t T( ( A.nonZeros() < SMP_BLOCKMATMULT_THRESHOLD || M < 2UL )
+                   ?( 1UL )
+                   :( min( getNumThreads(), M ) ) );
+
+   // Counting the non-zero blocks of each block row
+   smpFor( T, [&]( size_t t )
+   {
+      std::vector<size_t> marker( N, M );
+
+      for( size_t I=t*M/T; I<(t+1UL)*M/T; ++I )
+      {
+         size_t count( 0UL );
+
+         for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+            for( auto element=A.begin( i ); element!=A.end( i ); ++element ) {
+               const size_t J( element->index() / B );
+               if( marker[J] != I ) {
+                  marker[J] = I;
+                  ++count;
+               }
+            }
+         }
+
+         offsets_[I+1UL] = count;
+      }
+   } );
+
+   std::partial_sum( offsets_.begin(), offsets_.end(), offsets_.begin() );
+
+   values_.resize( offsets_[M] );
+   indices_.resize( offsets_[M] );
+
+   // Filling the non-zero blocks
+   smpFor( T, [&]( size_t t )
+   {
+      std::vector<size_t> marker( N, M );
+      std::vector<size_t> slot( N );
+
+      for( size_t I=t*M/T; I<(t+1UL)*M/T; ++I )
+      {
+         size_t* const indices( indices_.data() + offsets_[I] );
+         size_t count( 0UL );
+
+         for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+            for( auto element=A.begin( i ); element!=A.end( i ); ++element ) {
+               const size_t J( element->index() / B );
+               if( marker[J] != I ) {
+                  marker[J] = I;
+                  indices[count++] = J;
+               }
+            }
+         }
+
+         std::sort( indices, indices+count );
+
+         for( size_t k=0UL; k<count; ++k ) {
+            slot[indices[k]] = offsets_[I] + k;
+         }
+
+         for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+            for( auto element=A.begin( i ); element!=A.end( i ); ++element ) {
+               const size_t j( element->index() );
+               values_[slot[j/B]]( i-I*B, j%B ) = element->value();
+            }
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_      ( sm.m_ )        // The current number of rows of the matrix
+   , n_      ( sm.n_ )        // The current number of columns of the matrix
+   , values_ ( sm.values_ )   // The non-zero blocks
+   , indices_( sm.indices_ )  // The block column indices of the non-zero blocks
+   , offsets_( sm.offsets_ )  // The offset of each block row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BlockCompressedMatrix.
+//
+// \param sm The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept
+   : m_      ( sm.m_ )                    // The current number of rows of the matrix
+   , n_      ( sm.n_ )                    // The current number of columns of the matrix
+   , values_ ( std::move( sm.values_ ) )   // The non-zero blocks
+   , indices_( std::move( sm.indices_ ) )  // The block column indices of the non-zero blocks
+   , offsets_( std::move( sm.offsets_ ) )  // The offset of each block row
+{
+   sm.m_ = 0UL;
+   sm.n_ = 0UL;
+   sm.values_.clear();
+   sm.indices_.clear();
+   sm.offsets_.assign( 1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BlockCompressedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( BlockCompressedMatrix&& rhs ) noexcept
+{
+   BlockCompressedMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ReturnType
+   BlockCompressedMatrix<Type,B>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i/B, j/B ) );
+
+   if( pos == end( i/B ) )
+      return zero_;
+   else
+      return pos->value()( i%B, j%B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ReturnType
+   BlockCompressedMatrix<Type,B>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::Iterator
+   BlockCompressedMatrix<Type,B>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return Iterator( values_.data() + offsets_[i], indices_.data() + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return ConstIterator( values_.data() + offsets_[i], indices_.data() + offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator to the first non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::Iterator
+   BlockCompressedMatrix<Type,B>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return Iterator( values_.data() + offsets_[i+1UL], indices_.data() + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return ConstIterator( values_.data() + offsets_[i+1UL], indices_.data() + offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a i.
+//
+// \param i The block row index.
+// \return Iterator just past the last non-zero block of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::blockRows() const noexcept
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::blockColumns() const noexcept
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix in number of blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::capacity() const noexcept
+{
+   return values_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the sparse matrix.
+//
+// \return The number of elements of all non-zero blocks.
+//
+// Note that this number includes the zero elements within the non-zero blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros() const noexcept
+{
+   return offsets_.back() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the sparse matrix.
+//
+// \return The number of non-zero blocks in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks() const noexcept
+{
+   return offsets_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the specified block row.
+//
+// \param i The index of the block row.
+// \return The number of non-zero blocks of block row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the non-zero blocks to zero, but preserves the sparsity
+// pattern of the matrix. Thus the matrix can be reassembled via the block iterators without
+// setting up the non-zero blocks again.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::reset()
+{
+   for( BlockType& block : values_ ) {
+      blaze::reset( block );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   values_.clear();
+   indices_.clear();
+   offsets_.assign( 1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::swap( BlockCompressedMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( values_, sm.values_ );
+   swap( indices_, sm.indices_ );
+   swap( offsets_, sm.offsets_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the block size of the sparse matrix.
+//
+// \return The number of rows and columns of each block.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+constexpr size_t BlockCompressedMatrix<Type,B>::blockSize() noexcept
+{
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads for a multiplication.
+//
+// \param columns The number of columns of the right-hand side operand.
+// \return The number of threads to be used.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::threads( size_t columns ) const noexcept
+{
+   if( nonZeros()*columns < SMP_BLOCKMATMULT_THRESHOLD || blockRows() < 2UL )
+      return 1UL;
+   return min( getNumThreads(), blockRows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first block row of the given thread.
+//
+// \param t The index of the thread.
+// \param threads The total number of threads.
+// \return The index of the first block row of the given thread.
+//
+// This function partitions the block rows into \a threads contiguous ranges with a similar
+// number of non-zero blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline size_t BlockCompressedMatrix<Type,B>::partition( size_t t, size_t threads ) const noexcept
+{
+   if( t == 0UL ) return 0UL;
+   if( t >= threads ) return blockRows();
+
+   const size_t target( t*nonZeroBlocks()/threads );
+   const auto pos( std::upper_bound( offsets_.begin(), offsets_.end(), target ) );
+   return min( blockRows(), static_cast<size_t>( pos - offsets_.begin() ) - 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific non-zero block.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Iterator to the block in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific block is contained in the sparse
+// matrix. It specifically searches for the block at block row \a i and block column \a j. In
+// case the block is found, the function returns an iterator to the block. Otherwise an iterator
+// just past the last non-zero block of block row \a i (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::Iterator
+   BlockCompressedMatrix<Type,B>::find( size_t i, size_t j )
+{
+   const Iterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific non-zero block.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Iterator to the block in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific block is contained in the sparse
+// matrix. It specifically searches for the block at block row \a i and block column \a j. In
+// case the block is found, the function returns an iterator to the block. Otherwise an iterator
+// just past the last non-zero block of block row \a i (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first block of block row \a i whose block column index is
+//        not less than the given index.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Iterator to the first block with a block column index not less than \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::Iterator
+   BlockCompressedMatrix<Type,B>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+
+   const auto pos( std::lower_bound( indices_.begin()+offsets_[i], indices_.begin()+offsets_[i+1UL], j ) );
+   const size_t k( pos - indices_.begin() );
+   return Iterator( values_.data() + k, indices_.data() + k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first block of block row \a i whose block column index is
+//        not less than the given index.
+//
+// \param i The block row index of the search block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param j The block column index of the search block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \return Iterator to the first block with a block column index not less than \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+
+   const auto pos( std::lower_bound( indices_.begin()+offsets_[i], indices_.begin()+offsets_[i+1UL], j ) );
+   const size_t k( pos - indices_.begin() );
+   return ConstIterator( values_.data() + k, indices_.data() + k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix in number of blocks.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros blocks.
+// The current values of the matrix blocks and the individual capacities are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::reserve( size_t nonzeros )
+{
+   values_.reserve( nonzeros );
+   indices_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending a non-zero block to the specified block row of the sparse matrix.
+//
+// \param i The block row index of the new block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param j The block column index of the new block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The new block to be appended.
+// \return void
+//
+// This function provides a very efficient way to fill a block-sparse matrix with blocks. It
+// appends a new block to the end of the specified block row. Therefore it is strictly necessary
+// to keep the following preconditions in mind:
+//
+//  - the block column index of the new block must be strictly larger than the largest block
+//    column index of the non-zero blocks in the specified block row
+//  - all previous block rows have to be finalized via the finalize() function
+//
+// Ignoring these preconditions might result in undefined behavior! In combination with the
+// reserve() and the finalize() function, append() provides the most efficient way to add new
+// blocks to a (newly created) block-sparse matrix:
+
+   \code
+   using blaze::StaticMatrix;
+   using blaze::columnMajor;
+
+   const StaticMatrix<double,2UL,2UL,columnMajor> K{ { 4.0, -1.0 }, { -1.0, 4.0 } };
+
+   blaze::BlockCompressedMatrix<double,2UL> A( 6UL, 6UL );
+
+   A.reserve( 3UL );            // Reserving enough capacity for 3 non-zero blocks
+   A.append( 0UL, 0UL, K );     // Appending the block K in block row 0 with block column index 0
+   A.append( 0UL, 2UL, -K );    // Appending the block -K in block row 0 with block column index 2
+   A.finalize( 0UL );           // Finalizing block row 0
+   A.finalize( 1UL );           // Finalizing the empty block row 1 to prepare block row 2
+   A.append( 2UL, 2UL, K );     // Appending the block K in block row 2 with block column index 2
+   A.finalize( 2UL );           // Finalizing block row 2
+   \endcode
+
+// \note The \c finalize() function has to be explicitly called for each block row, even for
+// empty ones!
+// \note In case the capacity of the matrix is exceeded, append() reallocates the memory and
+// invalidates all iterators.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::append( size_t i, size_t j, const BlockType& block )
+{
+   BLAZE_USER_ASSERT( i < blockRows()   , "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( j < blockColumns(), "Invalid block column access index" );
+   BLAZE_USER_ASSERT( offsets_[i+1UL] == values_.size(), "Previous block rows are not finalized" );
+   BLAZE_USER_ASSERT( offsets_[i] == offsets_[i+1UL] || j > indices_.back(), "Index is not strictly increasing" );
+
+   values_.push_back( block );
+   indices_.push_back( j );
+   ++offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the block insertion of a block row.
+//
+// \param i The index of the block row to be finalized \f$[0..M/B-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a block-sparse matrix
+// with blocks. After completion of block row \a i via the append() function, this function
+// can be called to finalize block row \a i and prepare the next block row for insertion process
+// via append().
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void BlockCompressedMatrix<Type,B>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < blockRows(), "Invalid block row access index" );
+
+   if( i+1UL < blockRows() )
+      offsets_[i+2UL] = offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the block-sparse matrix into a compressed matrix.
+//
+// \return The row-major compressed matrix containing the elements of the block-sparse matrix.
+//
+// This function converts the block-sparse matrix into a row-major compressed matrix. Zero
+// elements within the non-zero blocks are not stored in the resulting compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline CompressedMatrix<Type,rowMajor> BlockCompressedMatrix<Type,B>::compress() const
+{
+   size_t nonzeros( 0UL );
+
+   for( const BlockType& block : values_ ) {
+      for( size_t j=0UL; j<B; ++j )
+         for( size_t i=0UL; i<B; ++i )
+            if( !isDefault( block(i,j) ) ) ++nonzeros;
+   }
+
+   CompressedMatrix<Type,rowMajor> A( m_, n_, nonzeros );
+
+   for( size_t I=0UL; I<blockRows(); ++I ) {
+      for( size_t r=0UL; r<B; ++r ) {
+         for( size_t k=offsets_[I]; k<offsets_[I+1UL]; ++k ) {
+            for( size_t c=0UL; c<B; ++c ) {
+               if( !isDefault( values_[k](r,c) ) )
+                  A.append( I*B+r, indices_[k]*B+c, values_[k](r,c) );
+            }
+         }
+         A.finalize( I*B+r );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t B >        // Block size
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t B >        // Block size
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a single element of the product of the matrix and a dense vector.
+//
+// \param i The index of the row.
+// \param x The right-hand side dense vector.
+// \return The inner product of the \a i-th row and the given dense vector.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename VT >  // Type of the dense vector
+inline MultTrait_t< Type, ElementType_t<VT> >
+   BlockCompressedMatrix<Type,B>::multiply( size_t i, const VT& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( x.size() == columns(), "Invalid vector size" );
+
+   const size_t I( i/B );
+   const size_t r( i%B );
+
+   MultTrait_t< Type, ElementType_t<VT> > sum{};
+
+   for( size_t k=offsets_[I]; k<offsets_[I+1UL]; ++k ) {
+      const size_t jbegin( indices_[k]*B );
+      for( size_t c=0UL; c<B; ++c ) {
+         sum += values_[k](r,c) * x[jbegin+c];
+      }
+   }
+
+   return sum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a single element of the product of the matrix and a dense matrix.
+//
+// \param i The index of the row.
+// \param j The index of the column of the dense matrix.
+// \param X The right-hand side dense matrix.
+// \return The inner product of the \a i-th row and the \a j-th column of the dense matrix.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename MT >  // Type of the dense matrix
+inline MultTrait_t< Type, ElementType_t<MT> >
+   BlockCompressedMatrix<Type,B>::multiply( size_t i, size_t j, const MT& X ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( X.rows() == columns(), "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( j < X.columns(), "Invalid column access index" );
+
+   const size_t I( i/B );
+   const size_t r( i%B );
+
+   MultTrait_t< Type, ElementType_t<MT> > sum{};
+
+   for( size_t k=offsets_[I]; k<offsets_[I+1UL]; ++k ) {
+      const size_t kbegin( indices_[k]*B );
+      for( size_t c=0UL; c<B; ++c ) {
+         sum += values_[k](r,c) * X(kbegin+c,j);
+      }
+   }
+
+   return sum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the matrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation to combine each element of \a y with the result.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.\n
+// The block rows are processed in parallel with a similar number of non-zero blocks per thread.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Block size
+template< typename VT1    // Type of the target dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void BlockCompressedMatrix<Type,B>::multiply( DenseVector<VT1,false>& y,
+                                              const DenseVector<VT2,false>& x, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == columns(), "Invalid vector size" );
+
+   using Vectorized = BoolConstant< UseVectorizedKernel_v< ElementType_t<VT2> > >;
+
+   const size_t T( threads( 1UL ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t ibegin( partition( t, T ) );
+      const size_t iend  ( partition( t+1UL, T ) );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         multiplyBlockRow( i,
+                           [&x]( size_t k ) { return (~x)[k]; },
+                           [&y,&op]( size_t k, const auto& value ) { op( (~y)[k], value ); },
+                           Vectorized() );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the matrix with a dense matrix (\f$ Y=A*X \f$).
+//
+// \param Y The target dense matrix.
+// \param X The right-hand side dense matrix.
+// \param op The assignment operation to combine each element of \a Y with the result.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.\n
+// The block rows are processed in parallel with a similar number of non-zero blocks per thread.
+// In case \a X is a row-major matrix, the rows of \a X are processed by SIMD vectors. Otherwise
+// each column of \a X is multiplied separately by means of the matrix/vector kernel.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Block size
+template< typename MT1    // Type of the target dense matrix
+        , bool SO1        // Storage order of the target dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , bool SO2        // Storage order of the right-hand side dense matrix
+        , typename OP >   // Type of the assignment operation
+void BlockCompressedMatrix<Type,B>::multiply( DenseMatrix<MT1,SO1>& Y,
+                                              const DenseMatrix<MT2,SO2>& X, OP op ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~Y).rows()    == rows()        , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~X).rows()    == columns()     , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~Y).columns() == (~X).columns(), "Invalid number of columns" );
+
+   using Vectorized = BoolConstant< !SO2 && MT2::simdEnabled &&
+                                    UseVectorizedKernel_v< ElementType_t<MT2> > >;
+
+   const size_t T( threads( (~X).columns() ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t ibegin( partition( t, T ) );
+      const size_t iend  ( partition( t+1UL, T ) );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         multiplyBlockRow( i, ~Y, ~X, op, Vectorized() );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication of a single block row with a dense vector.
+//
+// \param i The index of the block row.
+// \param x The access function for the elements of the right-hand side vector.
+// \param y The assignment function for the elements of the result.
+// \return void
+//
+// This function implements the default multiplication of a single block row with a vector,
+// which is used in case the element types are not suited for a vectorized computation.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename XA    // Type of the access function
+        , typename YA >  // Type of the assignment function
+inline void BlockCompressedMatrix<Type,B>::multiplyBlockRow( size_t i, XA x, YA y, FalseType ) const
+{
+   using ET = MultTrait_t< Type, RemoveCV_t< RemoveReference_t< decltype( x( 0UL ) ) > > >;
+
+   ET tmp[B]{};
+
+   for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k )
+   {
+      const BlockType& block( values_[k] );
+      const size_t jbegin( indices_[k]*B );
+
+      for( size_t c=0UL; c<B; ++c ) {
+         const auto xc( x( jbegin+c ) );
+         for( size_t r=0UL; r<B; ++r ) {
+            tmp[r] += block(r,c) * xc;
+         }
+      }
+   }
+
+   for( size_t r=0UL; r<B; ++r ) {
+      y( i*B+r, tmp[r] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication of a single block row with a dense vector.
+//
+// \param i The index of the block row.
+// \param x The access function for the elements of the right-hand side vector.
+// \param y The assignment function for the elements of the result.
+// \return void
+//
+// This function implements the vectorized multiplication of a single block row with a vector.
+// Each column of a block is loaded as padded SIMD vector and multiplied with the broadcast
+// element of the vector, i.e. the \a B rows of the block row are accumulated in SIMD registers.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename XA    // Type of the access function
+        , typename YA >  // Type of the assignment function
+inline void BlockCompressedMatrix<Type,B>::multiplyBlockRow( size_t i, XA x, YA y, TrueType ) const
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+   constexpr size_t NV( ( B + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   SIMDType xmm[NV];
+
+   for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k )
+   {
+      const BlockType& block( values_[k] );
+      const size_t jbegin( indices_[k]*B );
+
+      for( size_t c=0UL; c<B; ++c ) {
+         const SIMDType xc( set( x( jbegin+c ) ) );
+         for( size_t v=0UL; v<NV; ++v ) {
+            xmm[v] += block.load( v*SIMDSIZE, c ) * xc;
+         }
+      }
+   }
+
+   AlignedArray<Type,NV*SIMDSIZE> tmp;
+
+   for( size_t v=0UL; v<NV; ++v ) {
+      storea( &tmp[v*SIMDSIZE], xmm[v] );
+   }
+
+   for( size_t r=0UL; r<B; ++r ) {
+      y( i*B+r, tmp[r] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication of a single block row with a dense matrix.
+//
+// \param i The index of the block row.
+// \param Y The target dense matrix.
+// \param X The right-hand side dense matrix.
+// \param op The assignment operation to combine each element of \a Y with the result.
+// \return void
+//
+// This function implements the multiplication of a single block row with a column-major dense
+// matrix or a dense matrix that is not suited for a vectorized computation. Each column of \a X
+// is multiplied separately by means of the kernel of the matrix/vector multiplication.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , typename OP >  // Type of the assignment operation
+inline void BlockCompressedMatrix<Type,B>::multiplyBlockRow( size_t i, MT1& Y, const MT2& X,
+                                                             OP op, FalseType ) const
+{
+   using Vectorized = BoolConstant< UseVectorizedKernel_v< ElementType_t<MT2> > >;
+
+   for( size_t j=0UL; j<X.columns(); ++j ) {
+      multiplyBlockRow( i,
+                        [&X,j]( size_t k ) { return X(k,j); },
+                        [&Y,&op,j]( size_t k, const auto& value ) { op( Y(k,j), value ); },
+                        Vectorized() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication of a single block row with a row-major dense matrix.
+//
+// \param i The index of the block row.
+// \param Y The target dense matrix.
+// \param X The right-hand side row-major dense matrix.
+// \param op The assignment operation to combine each element of \a Y with the result.
+// \return void
+//
+// This function implements the vectorized multiplication of a single block row with a row-major
+// dense matrix. The \a B rows of the result are computed for one SIMD vector of columns at a
+// time, i.e. each element of a block is broadcast and multiplied with a SIMD vector of the
+// according row of \a X.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , typename OP >  // Type of the assignment operation
+inline void BlockCompressedMatrix<Type,B>::multiplyBlockRow( size_t i, MT1& Y, const MT2& X,
+                                                             OP op, TrueType ) const
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+   constexpr bool remainder( !IsPadded_v<MT2> );
+
+   const size_t N( X.columns() );
+   const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   AlignedArray<Type,SIMDSIZE> tmp;
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE )
+   {
+      SIMDType xmm[B];
+
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k )
+      {
+         const BlockType& block( values_[k] );
+         const size_t kbegin( indices_[k]*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            const SIMDType x1( X.load( kbegin+c, j ) );
+            for( size_t r=0UL; r<B; ++r ) {
+               xmm[r] += set( block(r,c) ) * x1;
+            }
+         }
+      }
+
+      const size_t jend( min( SIMDSIZE, N-j ) );
+
+      for( size_t r=0UL; r<B; ++r ) {
+         storea( &tmp[0UL], xmm[r] );
+         for( size_t l=0UL; l<jend; ++l ) {
+            op( Y(i*B+r,j+l), tmp[l] );
+         }
+      }
+   }
+
+   for( ; remainder && j<N; ++j )
+   {
+      Type sum[B]{};
+
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k )
+      {
+         const BlockType& block( values_[k] );
+         const size_t kbegin( indices_[k]*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            const Type x1( X(kbegin+c,j) );
+            for( size_t r=0UL; r<B; ++r ) {
+               sum[r] += block(r,c) * x1;
+            }
+         }
+      }
+
+      for( size_t r=0UL; r<B; ++r ) {
+         op( Y(i*B+r,j), sum[r] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B >
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block-sparse matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Block size
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
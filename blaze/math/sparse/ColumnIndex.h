@@ -0,0 +1,353 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/ColumnIndex.h
+//  \brief Implementation of a cached column index for row-major sparse matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COLUMNINDEX_H_
+#define _BLAZE_MATH_SPARSE_COLUMNINDEX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cached column index of a row-major compressed matrix.
+// \ingroup sparse_matrix
+//
+// The ColumnIndex class represents a transposed (compressed column) index of the non-zero
+// elements of a row-major compressed matrix. For every column it stores the row index and the
+// storage offset of all non-zero elements in ascending order of the row indices. This allows to
+// traverse a single column in \f$ O(nnz_j) \f$ steps instead of one binary search per row of
+// the matrix. The index does not store any values, i.e. it only has to be rebuilt in case the
+// sparsity pattern of the matrix changes. The index is owned and managed by the matrix (see
+// for instance the CompressedMatrix::enableColumnIndex() function), which builds it on demand
+// and marks it as outdated on every modification of its sparsity pattern.
+*/
+class ColumnIndex
+{
+ public:
+   //**Entry struct definition*********************************************************************
+   /*!\brief A single entry of the column index.
+   */
+   struct Entry
+   {
+      size_t row;     //!< The row index of the non-zero element.
+      size_t offset;  //!< The offset of the non-zero element from the first stored element.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ColumnIndex() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline const Entry* begin     ( size_t j ) const noexcept;
+   inline const Entry* end       ( size_t j ) const noexcept;
+   inline const Entry* lowerBound( size_t j, size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline bool   isValid() const noexcept;
+   inline void   invalidate() noexcept;
+
+   template< typename Iterator >
+   void build( size_t m, size_t n, const Iterator* begin, const Iterator* end );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> offsets_;  //!< The offsets of the first entry of each column.
+   std::vector<Entry>  entries_;  //!< The entries of all columns in column-major order.
+   bool                valid_;    //!< Flag for the consistency of the index with the matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ColumnIndex.
+//
+// The default constructor creates an empty, outdated column index.
+*/
+inline ColumnIndex::ColumnIndex() noexcept
+   : offsets_()         // The offsets of the first entry of each column
+   , entries_()         // The entries of all columns in column-major order
+   , valid_  ( false )  // Flag for the consistency of the index with the matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first entry of column \a j.
+//
+// \param j The column index.
+// \return Pointer to the first entry of column \a j.
+*/
+inline const ColumnIndex::Entry* ColumnIndex::begin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return entries_.data() + offsets_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer just past the last entry of column \a j.
+//
+// \param j The column index.
+// \return Pointer just past the last entry of column \a j.
+*/
+inline const ColumnIndex::Entry* ColumnIndex::end( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return entries_.data() + offsets_[j+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first entry of column \a j with a row index not less than \a i.
+//
+// \param j The column index.
+// \param i The row index.
+// \return Pointer to the first entry of column \a j with a row index not less than \a i.
+//
+// In case column \a j does not contain an entry with a row index not less than \a i, the
+// function returns end( j ).
+*/
+inline const ColumnIndex::Entry* ColumnIndex::lowerBound( size_t j, size_t i ) const noexcept
+{
+   return std::lower_bound( begin(j), end(j), i, []( const Entry& entry, size_t row ) {
+      return entry.row < row;
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the indexed matrix.
+//
+// \return The number of columns of the indexed matrix.
+*/
+inline size_t ColumnIndex::columns() const noexcept
+{
+   return offsets_.empty() ? 0UL : offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of entries of the column index.
+//
+// \return The total number of entries of the column index.
+*/
+inline size_t ColumnIndex::nonZeros() const noexcept
+{
+   return entries_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the column index is consistent with the indexed matrix.
+//
+// \return \a true in case the index is up to date, \a false if it has to be rebuilt.
+*/
+inline bool ColumnIndex::isValid() const noexcept
+{
+   return valid_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the column index as outdated.
+//
+// \return void
+//
+// This function is called by the indexed matrix on every modification of its sparsity pattern.
+// Note that the entries of the index are not released, i.e. pointers to entries remain valid
+// until the next call to the build() function.
+*/
+inline void ColumnIndex::invalidate() noexcept
+{
+   valid_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the column index of a row-major compressed matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param begin Pointers to the first non-zero element of each row.
+// \param end Pointers one past the last non-zero element of each row.
+// \return void
+//
+// This function (re-)builds the column index from the row pointers of a row-major compressed
+// matrix by means of a counting sort in \f$ O(nnz+n) \f$ time. The offsets of all entries are
+// computed relative to \a begin[0]. Since the rows are traversed in ascending order, the entries
+// of each column are sorted by their row index. The memory of the index is reused if possible.
+*/
+template< typename Iterator >  // Type of the row pointers
+void ColumnIndex::build( size_t m, size_t n, const Iterator* begin, const Iterator* end )
+{
+   offsets_.assign( n+1UL, 0UL );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( Iterator element=begin[i]; element!=end[i]; ++element ) {
+         ++offsets_[element->index()+1UL];
+      }
+      nonzeros += end[i] - begin[i];
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      offsets_[j+1UL] += offsets_[j];
+   }
+
+   BLAZE_INTERNAL_ASSERT( offsets_[n] == nonzeros, "Invalid number of column index entries" );
+
+   entries_.resize( nonzeros );
+
+   std::vector<size_t> positions( offsets_.begin(), offsets_.end()-1L );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( Iterator element=begin[i]; element!=end[i]; ++element ) {
+         Entry& entry( entries_[positions[element->index()]++] );
+         entry.row    = i;
+         entry.offset = element - begin[0UL];
+      }
+   }
+
+   valid_ = true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ColumnIndex functions */
+//@{
+template< typename MT >
+inline const ColumnIndex* getColumnIndex( const MT& matrix, bool build=true ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cached column index of the given matrix.
+// \ingroup sparse_matrix
+//
+// \param matrix The given matrix.
+// \param build \a true to build an outdated index, \a false to only query an up-to-date index.
+// \return Pointer to the column index, \a nullptr in case no column index is available.
+//
+// This function is the hook for views and kernels that traverse a matrix column-wise. The
+// default implementation returns \a nullptr, i.e. the matrix does not provide a column index.
+// Matrix types that are able to provide a column index overload this function.
+*/
+template< typename MT >  // Type of the matrix
+inline const ColumnIndex* getColumnIndex( const MT& matrix, bool build ) noexcept
+{
+   UNUSED_PARAMETER( matrix, build );
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -49,11 +50,16 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/ColumnIndex.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/Triplets.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
@@ -64,6 +70,7 @@
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasRowOffsets.h>
 #include <blaze/math/typetraits/HighType.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsIdentity.h>
@@ -217,6 +224,22 @@ namespace blaze {
    E -= A + C;    // Subtraction assignment
    F *= A * D;    // Multiplication assignment
    \endcode
+
+// In a row-major compressed matrix the access to a single column requires a binary search in
+// every row of the matrix. For applications that repeatedly access the columns of a row-major
+// matrix, it is possible to enable an additional column index via the enableColumnIndex()
+// function. The index is built on the first column-wise access and is rebuilt lazily after any
+// change of the sparsity pattern of the matrix. Column views and Columns views automatically
+// use the column index:
+
+   \code
+   CompressedMatrix<double,rowMajor> A( 10000UL, 10000UL );
+   // ... Initialization
+
+   A.enableColumnIndex();
+
+   auto col = column( A, 5UL );  // Traversal in O(nnz) of column 5
+   \endcode
 */
 template< typename Type                    // Data type of the matrix
         , bool SO = defaultStorageOrder >  // Storage order
@@ -436,6 +459,12 @@ class CompressedMatrix
    inline Iterator insert  ( size_t i, size_t j, const Type& value );
    inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void     finalize( size_t i );
+
+   template< typename RandomIt >
+   inline void setFromTriplets( RandomIt first, RandomIt last );
+
+   template< typename RandomIt, typename OP >
+   inline void setFromTriplets( RandomIt first, RandomIt last, OP combiner );
    //@}
    //**********************************************************************************************
 
@@ -476,6 +505,17 @@ class CompressedMatrix
    //@}
    //**********************************************************************************************
 
+   //**Index functions*****************************************************************************
+   /*!\name Index functions */
+   //@{
+   inline void               enableColumnIndex();
+   inline void               disableColumnIndex() noexcept;
+   inline bool               hasColumnIndex() const noexcept;
+   inline const ColumnIndex* columnIndex( bool build=true ) const;
+   inline const size_t*      rowOffsets() const;
+   //@}
+   //**********************************************************************************************
+
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -508,6 +548,7 @@ class CompressedMatrix
    //@{
    inline size_t extendCapacity() const noexcept;
           void   reserveElements( size_t nonzeros );
+   inline void   invalidateIndices() noexcept;
 
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
@@ -530,6 +571,9 @@ class CompressedMatrix
    Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
 
+   std::unique_ptr<ColumnIndex> index_;  //!< The optional column index of the compressed matrix.
+   mutable std::vector<size_t> offsets_;  //!< The cached prefix sums of the row lengths.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -732,6 +776,8 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noex
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
    , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row
    , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row
+   , index_   ( std::move( sm.index_ ) )    // The optional column index of the compressed matrix
+   , offsets_ ( std::move( sm.offsets_ ) )  // The cached prefix sums of the row lengths
 {
    sm.m_        = 0UL;
    sm.n_        = 0UL;
@@ -1151,6 +1197,8 @@ inline CompressedMatrix<Type,SO>&
 
    if( &rhs == this ) return *this;
 
+   invalidateIndices();
+
    const size_t nonzeros( rhs.nonZeros() );
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
@@ -1200,6 +1248,9 @@ template< typename Type  // Data type of the matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( CompressedMatrix&& rhs ) noexcept
 {
+   invalidateIndices();
+   rhs.invalidateIndices();
+
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
       delete[] begin_;
@@ -1536,6 +1587,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::reset()
 {
+   invalidateIndices();
+
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
 }
@@ -1558,6 +1611,7 @@ template< typename Type  // Data type of the matrix
 inline void CompressedMatrix<Type,SO>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   invalidateIndices();
    end_[i] = begin_[i];
 }
 //*************************************************************************************************
@@ -1574,6 +1628,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::clear()
 {
+   invalidateIndices();
+
    if( end_ != nullptr )
       end_[0UL] = end_[m_];
    m_ = 0UL;
@@ -1608,6 +1664,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   invalidateIndices();
+
    if( begin_ == nullptr )
    {
       begin_ = new Iterator[2UL*m+2UL];
@@ -1698,6 +1756,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 {
+   invalidateIndices();
+
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
 }
@@ -1729,6 +1789,8 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
+   invalidateIndices();
+
    const size_t current( capacity(i) );
 
    if( current >= nonzeros ) return;
@@ -1817,6 +1879,8 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
+   invalidateIndices();
+
    if( i < ( m_ - 1UL ) )
       end_[i+1] = castDown( std::move( begin_[i+1], end_[i+1], castUp( end_[i] ) ) );
    begin_[i+1] = end_[i];
@@ -1856,6 +1920,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
+   invalidateIndices();
+   sm.invalidateIndices();
+
    swap( m_, sm.m_ );
    swap( n_, sm.n_ );
    swap( capacity_, sm.capacity_ );
@@ -1987,6 +2054,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   invalidateIndices();
+
    const Iterator pos( lowerBound( i, j ) );
 
    if( pos != end_[i] && pos->index_ == j ) {
@@ -2019,6 +2088,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   invalidateIndices();
+
    const Iterator pos( lowerBound( i, j ) );
 
    if( pos != end_[i] && pos->index_ == j ) {
@@ -2171,6 +2242,8 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
    BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved capacity left" );
    BLAZE_USER_ASSERT( begin_[i] == end_[i] || j > ( end_[i]-1UL )->index_, "Index is not strictly increasing" );
 
+   invalidateIndices();
+
    end_[i]->value_ = value;
 
    if( !check || !isDefault<strict>( end_[i]->value_ ) ) {
@@ -2200,6 +2273,8 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
+   invalidateIndices();
+
    begin_[i+1UL] = end_[i];
    if( i != m_-1UL )
       end_[i+1UL] = end_[i];
@@ -2207,6 +2282,98 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the elements of the compressed matrix from a set of (row, column, value) triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the compressed matrix by the elements given
+// by the (unsorted) range of triplets \f$[first..last)\f$. Triplets referring to the same
+// element are summed up. For details see the setFromTriplets() function with user-defined
+// combiner.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO >            // Storage order
+template< typename RandomIt >  // Type of the triplet iterator
+inline void CompressedMatrix<Type,SO>::setFromTriplets( RandomIt first, RandomIt last )
+{
+   setFromTriplets( first, last, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the elements of the compressed matrix from a set of (row, column, value) triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \param combiner The binary operation for the combination of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function provides an efficient way to assemble a compressed matrix from an unsorted
+// range of (row, column, value) triplets, which may contain several triplets for the same
+// element (as for instance produced by a finite element assembly). The triplets are accessed
+// via \c std::get<0> (row index), \c std::get<1> (column index) and \c std::get<2> (value),
+// i.e. the range can for instance consist of \c std::tuple<size_t,size_t,Type> elements. The
+// iterators are required to be random access iterators.
+
+   \code
+   using Triplet = std::tuple<size_t,size_t,double>;
+
+   std::vector<Triplet> triplets{ Triplet{ 0, 1, 1.0 }, Triplet{ 2, 0, 3.0 }, Triplet{ 0, 1, 2.0 } };
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 3, 3 );
+   A.setFromTriplets( triplets.begin(), triplets.end() );  // Results in A(0,1) == 3 and A(2,0) == 3
+   \endcode
+
+// The triplets are sorted by means of a (parallel) counting sort on the row (or column) index,
+// followed by a sort of the elements within each row (or column). Duplicate triplets are
+// combined in the order they appear in the given range by means of the given binary \a combiner
+// (i.e. \c combiner(previous,next)), which makes the result independent of the number of
+// threads. The resulting elements are stored in a single allocation of exactly the required
+// size. Note that elements that are combined to a default value are stored as explicit
+// elements. The matrix keeps its dimensions and the previous content of the matrix is
+// discarded. In case any of the triplets refers to an element outside the matrix, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged. Since the
+// combiner is potentially executed in parallel, it must not throw any exception.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO >            // Storage order
+template< typename RandomIt    // Type of the triplet iterator
+        , typename OP >        // Type of the combiner
+inline void CompressedMatrix<Type,SO>::setFromTriplets( RandomIt first, RandomIt last, OP combiner )
+{
+   invalidateIndices();
+
+   SortedTriplets<Type> triplets( sortTriplets<SO,Type>( first, last, m_, n_, combiner ) );
+
+   CompressedMatrix tmp( m_, n_, triplets.nonzeros );
+
+   smpFor( triplets.partition.size()-1UL, [&]( size_t t )
+   {
+      for( size_t i=triplets.partition[t]; i<triplets.partition[t+1UL]; ++i )
+      {
+         const size_t* const indices( triplets.indices.get() + triplets.offsets[i] );
+         Type* const values( triplets.values.get() + triplets.offsets[i] );
+
+         Iterator element( tmp.begin_[i] );
+         for( size_t k=0UL; k<triplets.nonzeros[i]; ++k, ++element ) {
+            element->value_ = std::move( values[k] );
+            element->index_ = indices[k];
+         }
+         tmp.end_[i] = element;
+      }
+   } );
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2231,6 +2398,8 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   invalidateIndices();
+
    const Iterator pos( find( i, j ) );
    if( pos != end_[i] )
       end_[i] = castDown( std::move( pos+1, end_[i], castUp( pos ) ) );
@@ -2257,6 +2426,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
 
+   invalidateIndices();
+
    if( pos != end_[i] )
       end_[i] = castDown( std::move( pos+1, end_[i], castUp( pos ) ) );
 
@@ -2287,6 +2458,8 @@ inline typename CompressedMatrix<Type,SO>::Iterator
    BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid compressed matrix iterator" );
    BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid compressed matrix iterator" );
 
+   invalidateIndices();
+
    if( first != last )
       end_[i] = castDown( std::move( last, end_[i], castUp( first ) ) );
 
@@ -2321,6 +2494,8 @@ template< typename Type    // Data type of the matrix
 template< typename Pred >  // Type of the unary predicate
 inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
 {
+   invalidateIndices();
+
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::remove_if( castUp( begin_[i] ), castUp( end_[i] ),
                                           [predicate=predicate]( const ElementBase& element) {
@@ -2368,6 +2543,8 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator
    BLAZE_USER_ASSERT( first >= begin_[i] && first <= end_[i], "Invalid compressed matrix iterator" );
    BLAZE_USER_ASSERT( last  >= begin_[i] && last  <= end_[i], "Invalid compressed matrix iterator" );
 
+   invalidateIndices();
+
    const auto pos = std::remove_if( castUp( first ), castUp( last ),
                                     [predicate=predicate]( const ElementBase& element ) {
                                        return predicate( element.value() );
@@ -2622,6 +2799,155 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 
 
 
+//=================================================================================================
+//
+//  INDEX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Enables the column index of the compressed matrix.
+//
+// \return void
+//
+// This function enables the column index of the row-major compressed matrix. The index itself
+// is built on demand, i.e. on the first column-wise access to the matrix (for instance via
+// a column view), and is rebuilt on the first column-wise access after any modification of the
+// sparsity pattern. Modifications of the values of the non-zero elements do not require a new
+// index. Note that the column index is not copied in case the matrix is copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::enableColumnIndex()
+{
+   if( !index_ ) {
+      index_.reset( new ColumnIndex() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Disables the column index of the compressed matrix.
+//
+// \return void
+//
+// This function disables the column index of the row-major compressed matrix and releases all
+// memory of the index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::disableColumnIndex() noexcept
+{
+   index_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the column index of the compressed matrix is enabled.
+//
+// \return \a true in case the column index is enabled, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompressedMatrix<Type,SO>::hasColumnIndex() const noexcept
+{
+   return static_cast<bool>( index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the column index of the compressed matrix.
+//
+// \param build \a true to rebuild an outdated index, \a false to only query an up-to-date index.
+// \return Pointer to the column index, \a nullptr in case the index is not available.
+//
+// This function returns the column index of the row-major compressed matrix. In case the index
+// is enabled but outdated, it is rebuilt if \a build is set to \a true. In case the index is
+// disabled or outdated and \a build is set to \a false, the function returns \a nullptr. Note
+// that since the index is rebuilt on demand, concurrent calls of this function on the same
+// matrix are only safe in case the index is up to date.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const ColumnIndex* CompressedMatrix<Type,SO>::columnIndex( bool build ) const
+{
+   if( !index_ )
+      return nullptr;
+
+   if( !index_->isValid() ) {
+      if( !build ) return nullptr;
+      index_->build( m_, n_, begin_, end_ );
+   }
+
+   BLAZE_INTERNAL_ASSERT( index_->columns()  == n_        , "Invalid column index detected" );
+   BLAZE_INTERNAL_ASSERT( index_->nonZeros() == nonZeros(), "Invalid column index detected" );
+
+   return index_.get();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the prefix sums of the number of non-zero elements per row.
+//
+// \return Pointer to the first of the \f$ M+1 \f$ row offsets.
+//
+// This function returns the prefix sums of the number of non-zero elements in the rows of the
+// row-major compressed matrix, i.e. the \a i-th row contains the elements with the positions
+// \f$[offsets[i]..offsets[i+1]) \f$ in the sequence of all non-zero elements. The offsets are
+// computed on demand and cached until the next modification of the sparsity pattern. They are
+// used for instance to split the non-zero elements evenly among threads. Note that since the
+// offsets are computed on demand, concurrent calls of this function on the same matrix are
+// only safe in case the offsets are up to date. Also note that the returned pointer is
+// invalidated by any modification of the sparsity pattern.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const size_t* CompressedMatrix<Type,SO>::rowOffsets() const
+{
+   if( offsets_.empty() )
+   {
+      offsets_.resize( m_+1UL );
+      offsets_[0UL] = 0UL;
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         offsets_[i+1UL] = offsets_[i] + static_cast<size_t>( end_[i] - begin_[i] );
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( offsets_.size() == m_+1UL     , "Invalid row offsets detected" );
+   BLAZE_INTERNAL_ASSERT( offsets_[m_]    == nonZeros(), "Invalid row offsets detected" );
+
+   return offsets_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the column index and the row offsets of the compressed matrix as outdated.
+//
+// \return void
+//
+// This function is called by all functions that modify the sparsity pattern of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::invalidateIndices() noexcept
+{
+   if( index_ ) {
+      index_->invalidate();
+   }
+
+   offsets_.clear();
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
@@ -2707,6 +3033,8 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
+   invalidateIndices();
+
    if( m_ == 0UL || n_ == 0UL )
       return;
 
@@ -2770,6 +3098,8 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   invalidateIndices();
+
    if( m_ == 0UL || begin_[0] == nullptr )
       return;
 
@@ -2782,19 +3112,28 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the assignment of a column-major compressed matrix.
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
 //
-// \param rhs The right-hand side compressed matrix to be assigned.
+// \param rhs The right-hand side sparse matrix to be assigned.
 // \return void
 //
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// assignment operator.\n
+// The elements are transposed into the rows of the compressed matrix by means of a counting
+// sort, which writes each element directly to its final position. The columns of the sparse
+// matrix are split into contiguous ranges and each range counts its elements per row. Based
+// on the prefix sums of these counts each range scatters its elements into a distinct section
+// of each row. Since the columns are traversed in increasing order, the elements of each row
+// are sorted and the result does not depend on the number of threads. The counting and the
+// scattering are executed in parallel in case the number of non-zero elements exceeds the
+// BLAZE_SMP_SMATTRANSPOSE_THRESHOLD. The number of threads is limited to the average number
+// of elements per row in order to bound the memory for the counts by the number of elements.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side compressed matrix
+template< typename MT >  // Type of the right-hand side sparse matrix
 inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
@@ -2804,25 +3143,78 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   invalidateIndices();
+
    using RhsIterator = ConstIterator_t<MT>;
 
-   // Counting the number of elements per row
-   std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
-   }
+   if( m_ == 0UL )
+      return;
+
+   const size_t nonzeros( (~rhs).nonZeros() );
+   const size_t T( ( nonzeros < SMP_SMATTRANSPOSE_THRESHOLD || n_ < 2UL )
+                   ?( 1UL )
+                   :( min( getNumThreads(), n_, max( 1UL, nonzeros / m_ ) ) ) );
+
+   std::vector<size_t> counts( T*m_ );
+   std::vector<size_t> rowLengths( m_ );
+
+   // Counting the number of elements per row for each range of columns
+   smpFor( T, [&]( size_t t )
+   {
+      size_t* const count( counts.data() + t*m_ );
+
+      for( size_t j=t*n_/T; j<(t+1UL)*n_/T; ++j ) {
+         for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            ++count[element->index()];
+      }
+   } );
+
+   // Computing the number of elements per row
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t i=t*m_/T; i<(t+1UL)*m_/T; ++i ) {
+         size_t sum( 0UL );
+         for( size_t s=0UL; s<T; ++s ) {
+            sum += counts[s*m_+i];
+         }
+         rowLengths[i] = sum;
+      }
+   } );
 
    // Resizing the compressed matrix
    for( size_t i=0UL; i<m_; ++i ) {
-      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+      begin_[i+1UL] = end_[i] = begin_[i] + rowLengths[i];
    }
+   end_[m_] = begin_[m_];
 
-   // Appending the elements to the rows of the compressed matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
-   }
+   // Computing the starting position of each range of columns within each row
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t i=t*m_/T; i<(t+1UL)*m_/T; ++i ) {
+         size_t pos( begin_[i] - begin_[0UL] );
+         for( size_t s=0UL; s<T; ++s ) {
+            const size_t tmp( counts[s*m_+i] );
+            counts[s*m_+i] = pos;
+            pos += tmp;
+         }
+      }
+   } );
+
+   // Scattering the elements into the rows of the compressed matrix
+   smpFor( T, [&]( size_t t )
+   {
+      size_t* const count( counts.data() + t*m_ );
+      const Iterator first( begin_[0UL] );
+
+      for( size_t j=t*n_/T; j<(t+1UL)*n_/T; ++j ) {
+         for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+            const size_t i( element->index() );
+            const Iterator pos( first + count[i]++ );
+            pos->value_ = element->value();
+            pos->index_ = j;
+         }
+      }
+   } );
 }
 //*************************************************************************************************
 
@@ -2951,6 +3343,8 @@ inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& r
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
+   invalidateIndices();
+
    BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
 
    for( size_t i=0UL; i<m_; ++i ) {
@@ -3199,6 +3593,12 @@ class CompressedMatrix<Type,true>
    inline Iterator insert  ( size_t i, size_t j, const Type& value );
    inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void     finalize( size_t j );
+
+   template< typename RandomIt >
+   inline void setFromTriplets( RandomIt first, RandomIt last );
+
+   template< typename RandomIt, typename OP >
+   inline void setFromTriplets( RandomIt first, RandomIt last, OP combiner );
    //@}
    //**********************************************************************************************
 
@@ -4982,6 +5382,78 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the elements of the compressed matrix from a set of (row, column, value) triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the compressed matrix by the elements given
+// by the (unsorted) range of triplets \f$[first..last)\f$. Triplets referring to the same
+// element are summed up. For details see the setFromTriplets() function with user-defined
+// combiner.
+*/
+template< typename Type >      // Data type of the matrix
+template< typename RandomIt >  // Type of the triplet iterator
+inline void CompressedMatrix<Type,true>::setFromTriplets( RandomIt first, RandomIt last )
+{
+   setFromTriplets( first, last, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the elements of the compressed matrix from a set of (row, column, value) triplets.
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \param combiner The binary operation for the combination of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the compressed matrix by the elements given
+// by the (unsorted) range of triplets \f$[first..last)\f$. The triplets are sorted by column
+// and row index and duplicate triplets are combined in the order they appear in the given
+// range by means of the given binary \a combiner. In case any of the triplets refers to an
+// element outside the matrix, a \a std::invalid_argument exception is thrown and the matrix
+// remains unchanged.
+*/
+template< typename Type >      // Data type of the matrix
+template< typename RandomIt    // Type of the triplet iterator
+        , typename OP >        // Type of the combiner
+inline void CompressedMatrix<Type,true>::setFromTriplets( RandomIt first, RandomIt last, OP combiner )
+{
+   SortedTriplets<Type> triplets( sortTriplets<true,Type>( first, last, m_, n_, combiner ) );
+
+   CompressedMatrix tmp( m_, n_, triplets.nonzeros );
+
+   smpFor( triplets.partition.size()-1UL, [&]( size_t t )
+   {
+      for( size_t j=triplets.partition[t]; j<triplets.partition[t+1UL]; ++j )
+      {
+         const size_t* const indices( triplets.indices.get() + triplets.offsets[j] );
+         Type* const values( triplets.values.get() + triplets.offsets[j] );
+
+         Iterator element( tmp.begin_[j] );
+         for( size_t k=0UL; k<triplets.nonzeros[j]; ++k, ++element ) {
+            element->value_ = std::move( values[k] );
+            element->index_ = indices[k];
+         }
+         tmp.end_[j] = element;
+      }
+   } );
+
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -5560,18 +6032,27 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the assignment of a row-major compressed matrix.
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
-// \param rhs The right-hand side compressed matrix to be assigned.
+// \param rhs The right-hand side sparse matrix to be assigned.
 // \return void
 //
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// assignment operator.\n
+// The elements are transposed into the columns of the compressed matrix by means of a counting
+// sort, which writes each element directly to its final position. The rows of the sparse matrix
+// are split into contiguous ranges and each range counts its elements per column. Based on the
+// prefix sums of these counts each range scatters its elements into a distinct section of each
+// column. Since the rows are traversed in increasing order, the elements of each column are
+// sorted and the result does not depend on the number of threads. The counting and the
+// scattering are executed in parallel in case the number of non-zero elements exceeds the
+// BLAZE_SMP_SMATTRANSPOSE_THRESHOLD. The number of threads is limited to the average number
+// of elements per column in order to bound the memory for the counts by the number of elements.
 */
 template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side compressed matrix
+template< typename MT >    // Type of the right-hand side sparse matrix
 inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
@@ -5583,23 +6064,74 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 
    using RhsIterator = ConstIterator_t<MT>;
 
-   // Counting the number of elements per column
-   std::vector<size_t> columnLengths( n_, 0UL );
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         ++columnLengths[element->index()];
-   }
+   if( n_ == 0UL )
+      return;
+
+   const size_t nonzeros( (~rhs).nonZeros() );
+   const size_t T( ( nonzeros < SMP_SMATTRANSPOSE_THRESHOLD || m_ < 2UL )
+                   ?( 1UL )
+                   :( min( getNumThreads(), m_, max( 1UL, nonzeros / n_ ) ) ) );
+
+   std::vector<size_t> counts( T*n_ );
+   std::vector<size_t> columnLengths( n_ );
+
+   // Counting the number of elements per column for each range of rows
+   smpFor( T, [&]( size_t t )
+   {
+      size_t* const count( counts.data() + t*n_ );
+
+      for( size_t i=t*m_/T; i<(t+1UL)*m_/T; ++i ) {
+         for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            ++count[element->index()];
+      }
+   } );
+
+   // Computing the number of elements per column
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t j=t*n_/T; j<(t+1UL)*n_/T; ++j ) {
+         size_t sum( 0UL );
+         for( size_t s=0UL; s<T; ++s ) {
+            sum += counts[s*n_+j];
+         }
+         columnLengths[j] = sum;
+      }
+   } );
 
    // Resizing the compressed matrix
    for( size_t j=0UL; j<n_; ++j ) {
-      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
+      begin_[j+1UL] = end_[j] = begin_[j] + columnLengths[j];
    }
+   end_[n_] = begin_[n_];
 
-   // Appending the elements to the columns of the compressed matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         append( i, element->index(), element->value() );
-   }
+   // Computing the starting position of each range of rows within each column
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t j=t*n_/T; j<(t+1UL)*n_/T; ++j ) {
+         size_t pos( begin_[j] - begin_[0UL] );
+         for( size_t s=0UL; s<T; ++s ) {
+            const size_t tmp( counts[s*n_+j] );
+            counts[s*n_+j] = pos;
+            pos += tmp;
+         }
+      }
+   } );
+
+   // Scattering the elements into the columns of the compressed matrix
+   smpFor( T, [&]( size_t t )
+   {
+      size_t* const count( counts.data() + t*n_ );
+      const Iterator first( begin_[0UL] );
+
+      for( size_t i=t*m_/T; i<(t+1UL)*m_/T; ++i ) {
+         for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+            const size_t j( element->index() );
+            const Iterator pos( first + count[j]++ );
+            pos->value_ = element->value();
+            pos->index_ = i;
+         }
+      }
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5777,6 +6309,9 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m );
 
 template< typename Type, bool SO >
 inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
+
+template< typename Type >
+inline const ColumnIndex* getColumnIndex( const CompressedMatrix<Type,false>& m, bool build=true );
 //@}
 //*************************************************************************************************
 
@@ -5914,6 +6449,43 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) n
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the column index of the given row-major compressed matrix.
+// \ingroup compressed_matrix
+//
+// \param m The given row-major compressed matrix.
+// \param build \a true to rebuild an outdated index, \a false to only query an up-to-date index.
+// \return Pointer to the column index, \a nullptr in case the index is not available.
+//
+// This function provides the column index of a row-major compressed matrix to views and kernels
+// that access the matrix column-wise (see CompressedMatrix::columnIndex()).
+*/
+template< typename Type >  // Data type of the matrix
+inline const ColumnIndex* getColumnIndex( const CompressedMatrix<Type,false>& m, bool build )
+{
+   return m.columnIndex( build );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASROWOFFSETS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct HasRowOffsets< CompressedMatrix<T,false> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
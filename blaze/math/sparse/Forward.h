@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,9 +51,13 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class AssemblyMatrix;
+template< typename, size_t > class BlockCompressedMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 template< typename, bool > class IdentityMatrix;
+template< typename, size_t > class SellMatrix;
+template< typename > class SymmetricCompressedMatrix;
 
 } // namespace blaze
 
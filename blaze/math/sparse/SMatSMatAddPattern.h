@@ -0,0 +1,529 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMatSMatAddPattern.h
+//  \brief Sparse matrix/sparse matrix addition with precomputed sparsity pattern
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SMATSMATADDPATTERN_H_
+#define _BLAZE_MATH_SPARSE_SMATSMATADDPATTERN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sparse matrix/sparse matrix addition with precomputed sparsity pattern.
+// \ingroup sparse_matrix
+//
+// The SMatSMatAddPattern class template splits the addition of two sparse matrices into a
+// symbolic and a numeric phase. The symbolic phase, which is performed by the constructor,
+// merges the sparsity patterns of the two operands and records for every non-zero element of
+// both operands the position of the according element within the result (the scatter map).
+// The numeric phase, which is performed by the assign() function, writes the sum directly into
+// the existing storage of a CompressedMatrix without any index merging, reallocation or
+// sorting. The numeric phase is executed in parallel with a balanced number of non-zero elements
+// per thread:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SMatSMatAddPattern;
+   using blaze::rowMajor;
+
+   CompressedMatrix<double,rowMajor> A, B, C;
+   // ... Resizing and initialization
+
+   const SMatSMatAddPattern<rowMajor> pattern( A, B );  // Symbolic phase
+
+   while( ... ) {
+      // ... Updating the values (but not the sparsity patterns) of A and B
+      pattern.assign( C, A, B );  // Numeric phase: C = A + B
+   }
+   \endcode
+
+// The operands passed to the assign() function must have the same sparsity patterns as the
+// operands passed to the constructor. In case the number of non-zero elements of any row (for
+// row-major matrices) or column (for column-major matrices) differs, a \a std::invalid_argument
+// exception is thrown. In case the given target matrix does not (yet) have the sparsity pattern
+// of the result, it is restructured once. Afterwards, the structure of the target matrix must
+// not be modified between subsequent calls to assign().
+*/
+template< bool SO = defaultStorageOrder >  // Storage order
+class SMatSMatAddPattern
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT1, typename MT2 >
+   explicit inline SMatSMatAddPattern( const SparseMatrix<MT1,SO>& lhs,
+                                       const SparseMatrix<MT2,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+
+   template< typename Type >
+   inline bool isStructured( const CompressedMatrix<Type,SO>& C ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Type, typename MT1, typename MT2 >
+   void assign( CompressedMatrix<Type,SO>& C,
+                const SparseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,SO>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t threads( size_t work ) const noexcept;
+
+   template< typename MT >
+   void checkOperand( const MT& mat, const std::vector<size_t>& offsets ) const;
+
+   template< typename Type >
+   void structure( CompressedMatrix<Type,SO>& C ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                        //!< The number of rows of the result.
+   size_t n_;                        //!< The number of columns of the result.
+   std::vector<size_t> offsets_;     //!< Offset of each row/column of the result.
+   std::vector<size_t> indices_;     //!< Column/row indices of the non-zero elements of the result.
+   std::vector<size_t> lhsOffsets_;  //!< Offset of each row/column of the left-hand side operand.
+   std::vector<size_t> lhsMap_;      //!< Result positions of the left-hand side non-zero elements.
+   std::vector<size_t> rhsOffsets_;  //!< Offset of each row/column of the right-hand side operand.
+   std::vector<size_t> rhsMap_;      //!< Result positions of the right-hand side non-zero elements.
+   std::vector<size_t> partition_;   //!< Balanced partition of the rows/columns of the result.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of the sparse matrix/sparse matrix addition.
+//
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side sparse matrix operand.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This constructor computes the sparsity pattern of the sum of the two given sparse matrices
+// and the position of every non-zero element of both operands within the result.
+*/
+template< bool SO >  // Storage order
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline SMatSMatAddPattern<SO>::SMatSMatAddPattern( const SparseMatrix<MT1,SO>& lhs,
+                                                   const SparseMatrix<MT2,SO>& rhs )
+   : m_( (~lhs).rows()    )  // The number of rows of the result
+   , n_( (~lhs).columns() )  // The number of columns of the result
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT1> A( ~lhs );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_t<MT2> B( ~rhs );  // Evaluation of the right-hand side sparse matrix operand
+
+   const size_t M( size() );
+
+   lhsOffsets_.resize( M+1UL, 0UL );
+   rhsOffsets_.resize( M+1UL, 0UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      lhsOffsets_[i+1UL] = lhsOffsets_[i] + A.nonZeros( i );
+      rhsOffsets_[i+1UL] = rhsOffsets_[i] + B.nonZeros( i );
+   }
+
+   lhsMap_.resize( lhsOffsets_[M] );
+   rhsMap_.resize( rhsOffsets_[M] );
+
+   const size_t T( threads( lhsOffsets_[M] + rhsOffsets_[M] ) );
+
+   // Merging the indices of a single row/column; in case no index array is given the indices
+   // of the result are only counted
+   const auto merge = [&]( size_t i, size_t* indices )
+   {
+      auto a( A.begin( i ) );
+      auto b( B.begin( i ) );
+      const auto aend( A.end( i ) );
+      const auto bend( B.end( i ) );
+
+      size_t* lmap( lhsMap_.data() + lhsOffsets_[i] );
+      size_t* rmap( rhsMap_.data() + rhsOffsets_[i] );
+      size_t pos( 0UL );
+
+      while( a != aend || b != bend )
+      {
+         const bool useA( a != aend && ( b == bend || a->index() <= b->index() ) );
+         const bool useB( b != bend && ( a == aend || b->index() <= a->index() ) );
+         const size_t index( useA ? a->index() : b->index() );
+
+         if( indices != nullptr ) {
+            indices[pos] = index;
+            if( useA ) *lmap++ = pos;
+            if( useB ) *rmap++ = pos;
+         }
+
+         if( useA ) ++a;
+         if( useB ) ++b;
+         ++pos;
+      }
+
+      return pos;
+   };
+
+   // Counting the non-zero elements of each row/column of the result
+   offsets_.resize( M+1UL, 0UL );
+
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t i=t*M/T; i<(t+1UL)*M/T; ++i ) {
+         offsets_[i+1UL] = merge( i, nullptr );
+      }
+   } );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+   }
+
+   // Computing the indices of the result and the scatter maps of both operands
+   indices_.resize( offsets_[M] );
+
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t i=t*M/T; i<(t+1UL)*M/T; ++i ) {
+         merge( i, indices_.data() + offsets_[i] );
+      }
+   } );
+
+   // Partitioning the rows/columns into chunks with a similar number of non-zero elements
+   const size_t nonzeros( offsets_[M] );
+
+   partition_.resize( T+1UL, M );
+   partition_[0UL] = 0UL;
+
+   for( size_t t=1UL; t<T; ++t ) {
+      const auto pos( std::upper_bound( offsets_.begin(), offsets_.end(), t*nonzeros/T ) );
+      partition_[t] = max( partition_[t-1UL],
+                           min( M, static_cast<size_t>( pos - offsets_.begin() ) - 1UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the result.
+//
+// \return The number of rows of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatAddPattern<SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the result.
+//
+// \return The number of columns of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatAddPattern<SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the result.
+//
+// \return The number of non-zero elements of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatAddPattern<SO>::nonZeros() const noexcept
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given matrix has the sparsity pattern of the result.
+//
+// \param C The compressed matrix to be tested.
+// \return \a true in case the given matrix has the sparsity pattern of the result, \a false if not.
+//
+// This function only compares the size of the given matrix and the number of non-zero elements
+// of each row/column with the result. The individual indices are only compared in case the
+// BLAZE_INTERNAL_ASSERT() macro is active.
+*/
+template< bool SO >  // Storage order
+template< typename Type >  // Data type of the compressed matrix
+inline bool SMatSMatAddPattern<SO>::isStructured( const CompressedMatrix<Type,SO>& C ) const noexcept
+{
+   if( C.rows() != m_ || C.columns() != n_ || C.nonZeros() != nonZeros() )
+      return false;
+
+   const size_t M( size() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( C.nonZeros( i ) != offsets_[i+1UL] - offsets_[i] )
+         return false;
+      BLAZE_INTERNAL_ASSERT( std::equal( indices_.begin()+offsets_[i], indices_.begin()+offsets_[i+1UL], C.begin( i ),
+                                         []( size_t index, const auto& element ) { return index == element.index(); } )
+                           , "Invalid sparsity pattern of the target matrix detected" );
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the result.
+//
+// \return The number of rows/columns of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatAddPattern<SO>::size() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads for an operation with the given amount of work.
+//
+// \param work The number of scalar operations.
+// \return The number of threads to be used.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatAddPattern<SO>::threads( size_t work ) const noexcept
+{
+   if( work < SMP_SPARSEPATTERN_THRESHOLD || size() < 2UL )
+      return 1UL;
+   return min( getNumThreads(), size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the sparsity pattern of the given operand.
+//
+// \param mat The operand to be checked.
+// \param offsets The offsets of the rows/columns of the operand during the symbolic phase.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern of the operand.
+*/
+template< bool SO >  // Storage order
+template< typename MT >  // Type of the sparse matrix operand
+void SMatSMatAddPattern<SO>::checkOperand( const MT& mat, const std::vector<size_t>& offsets ) const
+{
+   if( mat.rows() != m_ || mat.columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t M( size() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( mat.nonZeros( i ) != offsets[i+1UL] - offsets[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern of the operand" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restructuring the given matrix to the sparsity pattern of the result.
+//
+// \param C The compressed matrix to be restructured.
+// \return void
+//
+// This function resizes the given compressed matrix to the size of the result and inserts all
+// non-zero elements of the result with a default value. The capacity of the matrix exactly
+// matches the number of non-zero elements.
+*/
+template< bool SO >  // Storage order
+template< typename Type >  // Data type of the compressed matrix
+void SMatSMatAddPattern<SO>::structure( CompressedMatrix<Type,SO>& C ) const
+{
+   const size_t M( size() );
+
+   std::vector<size_t> nonzeros( M );
+   for( size_t i=0UL; i<M; ++i ) {
+      nonzeros[i] = offsets_[i+1UL] - offsets_[i];
+   }
+
+   CompressedMatrix<Type,SO> tmp( m_, n_, nonzeros );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         if( SO ) tmp.append( indices_[k], i, Type() );
+         else     tmp.append( i, indices_[k], Type() );
+      }
+      tmp.finalize( i );
+   }
+
+   C.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Numeric phase of the sparse matrix/sparse matrix addition (\f$ C=A+B \f$).
+//
+// \param C The target compressed matrix.
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid sparsity pattern of the operand.
+//
+// This function computes the sum of the two given sparse matrices and writes the result directly
+// into the storage of the given target matrix. The two operands must have the same sparsity
+// patterns as during the symbolic phase. In case the target matrix does not have the sparsity
+// pattern of the result, it is restructured before the computation.
+*/
+template< bool SO >  // Storage order
+template< typename Type   // Data type of the target matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void SMatSMatAddPattern<SO>::assign( CompressedMatrix<Type,SO>& C,
+                                     const SparseMatrix<MT1,SO>& lhs,
+                                     const SparseMatrix<MT2,SO>& rhs ) const
+{
+   CompositeType_t<MT1> A( ~lhs );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_t<MT2> B( ~rhs );  // Evaluation of the right-hand side sparse matrix operand
+
+   checkOperand( A, lhsOffsets_ );
+   checkOperand( B, rhsOffsets_ );
+
+   if( !isStructured( C ) ) {
+      structure( C );
+   }
+
+   smpFor( partition_.size()-1UL, [&]( size_t t )
+   {
+      for( size_t i=partition_[t]; i<partition_[t+1UL]; ++i )
+      {
+         const auto c( C.begin( i ) );
+         const size_t nonzeros( offsets_[i+1UL] - offsets_[i] );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            c[k].value() = Type();
+         }
+
+         const size_t* lmap( lhsMap_.data() + lhsOffsets_[i] );
+         for( auto a=A.begin( i ); a!=A.end( i ); ++a, ++lmap ) {
+            c[*lmap].value() += a->value();
+         }
+
+         const size_t* rmap( rhsMap_.data() + rhsOffsets_[i] );
+         for( auto b=B.begin( i ); b!=B.end( i ); ++b, ++rmap ) {
+            c[*rmap].value() += b->value();
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
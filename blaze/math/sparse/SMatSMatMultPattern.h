@@ -0,0 +1,733 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMatSMatMultPattern.h
+//  \brief Sparse matrix/sparse matrix multiplication with precomputed sparsity pattern
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SMATSMATMULTPATTERN_H_
+#define _BLAZE_MATH_SPARSE_SMATSMATMULTPATTERN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sparse matrix/sparse matrix multiplication with precomputed sparsity pattern.
+// \ingroup sparse_matrix
+//
+// The SMatSMatMultPattern class template splits the multiplication of two sparse matrices into
+// a symbolic and a numeric phase. The symbolic phase, which is performed by the constructor,
+// computes the sparsity pattern of the product and the number of scalar multiplications per
+// row (for row-major matrices) or column (for column-major matrices) of the result. The numeric
+// phase, which is performed by the assign() function, accumulates the products directly into
+// the existing storage of a CompressedMatrix without any index merging, reallocation or
+// sorting. The numeric phase is executed in parallel with a balanced number of scalar
+// multiplications per thread:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SMatSMatMultPattern;
+   using blaze::rowMajor;
+
+   CompressedMatrix<double,rowMajor> A, B, C;
+   // ... Resizing and initialization
+
+   const SMatSMatMultPattern<rowMajor> pattern( A, B );  // Symbolic phase
+
+   while( ... ) {
+      // ... Updating the values (but not the sparsity patterns) of A and B
+      pattern.assign( C, A, B );  // Numeric phase: C = A * B
+   }
+   \endcode
+
+// In contrast to the SMatSMatAddPattern class template, no explicit scatter map is stored since
+// its size would be proportional to the number of scalar multiplications. Instead, each thread
+// uses a dense workspace to map the indices of a row/column of the result to their position
+// within the target matrix.
+//
+// The operands passed to the assign() function must have the same sparsity patterns as the
+// operands passed to the constructor. In case the number of non-zero elements of any row (for
+// row-major matrices) or column (for column-major matrices) differs, a \a std::invalid_argument
+// exception is thrown. In case the given target matrix does not (yet) have the sparsity pattern
+// of the result, it is restructured once. Afterwards, the structure of the target matrix must
+// not be modified between subsequent calls to assign().
+*/
+template< bool SO = defaultStorageOrder >  // Storage order
+class SMatSMatMultPattern
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   template< typename MT1, typename MT2 >
+   explicit inline SMatSMatMultPattern( const SparseMatrix<MT1,SO>& lhs,
+                                        const SparseMatrix<MT2,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t flops() const noexcept;
+
+   template< typename Type >
+   inline bool isStructured( const CompressedMatrix<Type,SO>& C ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Type, typename MT1, typename MT2 >
+   void assign( CompressedMatrix<Type,SO>& C,
+                const SparseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,SO>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t threads( size_t work ) const noexcept;
+
+   template< typename MT >
+   void checkOperand( const MT& mat, const std::vector<size_t>& offsets ) const;
+
+   template< typename Type >
+   void structure( CompressedMatrix<Type,SO>& C ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Symbolic functions**************************************************************************
+   /*!\name Symbolic functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   inline void symbolic( const MT1& A, const MT2& B, FalseType );
+
+   template< typename MT1, typename MT2 >
+   inline void symbolic( const MT1& A, const MT2& B, TrueType );
+
+   template< typename MTX, typename MTY >
+   void symbolic( const MTX& X, const MTY& Y );
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Type, typename MT1, typename MT2 >
+   inline void numeric( CompressedMatrix<Type,SO>& C, const MT1& A, const MT2& B, FalseType ) const;
+
+   template< typename Type, typename MT1, typename MT2 >
+   inline void numeric( CompressedMatrix<Type,SO>& C, const MT1& A, const MT2& B, TrueType ) const;
+
+   template< typename Type, typename MTX, typename MTY >
+   void numeric( CompressedMatrix<Type,SO>& C, const MTX& X, const MTY& Y ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                        //!< The number of rows of the result.
+   size_t n_;                        //!< The number of columns of the result.
+   std::vector<size_t> offsets_;     //!< Offset of each row/column of the result.
+   std::vector<size_t> indices_;     //!< Column/row indices of the non-zero elements of the result.
+   std::vector<size_t> flops_;       //!< Accumulated number of multiplications per row/column.
+   std::vector<size_t> lhsOffsets_;  //!< Offset of each row/column of the left-hand side operand.
+   std::vector<size_t> rhsOffsets_;  //!< Offset of each row/column of the right-hand side operand.
+   std::vector<size_t> partition_;   //!< Balanced partition of the rows/columns of the result.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of the sparse matrix/sparse matrix multiplication.
+//
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side sparse matrix operand.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This constructor computes the sparsity pattern of the product of the two given sparse matrices
+// and the number of scalar multiplications of each row/column of the result.
+*/
+template< bool SO >  // Storage order
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline SMatSMatMultPattern<SO>::SMatSMatMultPattern( const SparseMatrix<MT1,SO>& lhs,
+                                                     const SparseMatrix<MT2,SO>& rhs )
+   : m_( (~lhs).rows()    )  // The number of rows of the result
+   , n_( (~rhs).columns() )  // The number of columns of the result
+{
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT1> A( ~lhs );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_t<MT2> B( ~rhs );  // Evaluation of the right-hand side sparse matrix operand
+
+   const auto count = []( const auto& mat, std::vector<size_t>& offsets )
+   {
+      const size_t M( SO ? mat.columns() : mat.rows() );
+      offsets.resize( M+1UL, 0UL );
+      for( size_t i=0UL; i<M; ++i ) {
+         offsets[i+1UL] = offsets[i] + mat.nonZeros( i );
+      }
+   };
+
+   count( A, lhsOffsets_ );
+   count( B, rhsOffsets_ );
+
+   symbolic( A, B, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the result.
+//
+// \return The number of rows of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the result.
+//
+// \return The number of columns of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the result.
+//
+// \return The number of non-zero elements of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::nonZeros() const noexcept
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of scalar multiplications of the numeric phase.
+//
+// \return The number of scalar multiplications.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::flops() const noexcept
+{
+   return flops_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given matrix has the sparsity pattern of the result.
+//
+// \param C The compressed matrix to be tested.
+// \return \a true in case the given matrix has the sparsity pattern of the result, \a false if not.
+//
+// This function only compares the size of the given matrix and the number of non-zero elements
+// of each row/column with the result. The individual indices are only compared in case the
+// BLAZE_INTERNAL_ASSERT() macro is active.
+*/
+template< bool SO >  // Storage order
+template< typename Type >  // Data type of the compressed matrix
+inline bool SMatSMatMultPattern<SO>::isStructured( const CompressedMatrix<Type,SO>& C ) const noexcept
+{
+   if( C.rows() != m_ || C.columns() != n_ || C.nonZeros() != nonZeros() )
+      return false;
+
+   const size_t M( size() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( C.nonZeros( i ) != offsets_[i+1UL] - offsets_[i] )
+         return false;
+      BLAZE_INTERNAL_ASSERT( std::equal( indices_.begin()+offsets_[i], indices_.begin()+offsets_[i+1UL], C.begin( i ),
+                                         []( size_t index, const auto& element ) { return index == element.index(); } )
+                           , "Invalid sparsity pattern of the target matrix detected" );
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the result.
+//
+// \return The number of rows/columns of the result.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::size() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads for an operation with the given amount of work.
+//
+// \param work The number of scalar operations.
+// \return The number of threads to be used.
+*/
+template< bool SO >  // Storage order
+inline size_t SMatSMatMultPattern<SO>::threads( size_t work ) const noexcept
+{
+   if( work < SMP_SPARSEPATTERN_THRESHOLD || size() < 2UL )
+      return 1UL;
+   return min( getNumThreads(), size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the sparsity pattern of the given operand.
+//
+// \param mat The operand to be checked.
+// \param offsets The offsets of the rows/columns of the operand during the symbolic phase.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern of the operand.
+*/
+template< bool SO >  // Storage order
+template< typename MT >  // Type of the sparse matrix operand
+void SMatSMatMultPattern<SO>::checkOperand( const MT& mat, const std::vector<size_t>& offsets ) const
+{
+   const size_t M( SO ? mat.columns() : mat.rows() );
+
+   if( M+1UL != offsets.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( mat.nonZeros( i ) != offsets[i+1UL] - offsets[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern of the operand" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restructuring the given matrix to the sparsity pattern of the result.
+//
+// \param C The compressed matrix to be restructured.
+// \return void
+//
+// This function resizes the given compressed matrix to the size of the result and inserts all
+// non-zero elements of the result with a default value. The capacity of the matrix exactly
+// matches the number of non-zero elements.
+*/
+template< bool SO >  // Storage order
+template< typename Type >  // Data type of the compressed matrix
+void SMatSMatMultPattern<SO>::structure( CompressedMatrix<Type,SO>& C ) const
+{
+   const size_t M( size() );
+
+   std::vector<size_t> nonzeros( M );
+   for( size_t i=0UL; i<M; ++i ) {
+      nonzeros[i] = offsets_[i+1UL] - offsets_[i];
+   }
+
+   CompressedMatrix<Type,SO> tmp( m_, n_, nonzeros );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         if( SO ) tmp.append( indices_[k], i, Type() );
+         else     tmp.append( i, indices_[k], Type() );
+      }
+      tmp.finalize( i );
+   }
+
+   C.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMBOLIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase for row-major matrices.
+//
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// Each row \f$ i \f$ of the result is the combination of the rows of \a B selected by the
+// non-zero elements of the \f$ i \f$-th row of \a A.
+*/
+template< bool SO >  // Storage order
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void SMatSMatMultPattern<SO>::symbolic( const MT1& A, const MT2& B, FalseType )
+{
+   symbolic( A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic phase for column-major matrices.
+//
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+//
+// Each column \f$ j \f$ of the result is the combination of the columns of \a A selected by
+// the non-zero elements of the \f$ j \f$-th column of \a B.
+*/
+template< bool SO >  // Storage order
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void SMatSMatMultPattern<SO>::symbolic( const MT1& A, const MT2& B, TrueType )
+{
+   symbolic( B, A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the sparsity pattern of the result.
+//
+// \param X The operand selecting the rows/columns of \a Y.
+// \param Y The operand providing the rows/columns of the result.
+// \return void
+//
+// This function computes the sparsity pattern of the result in two passes. The first pass
+// counts the number of non-zero elements and the number of scalar multiplications of each
+// row/column of the result, the second pass computes the sorted indices. The second pass and
+// the numeric phase are partitioned based on the number of scalar multiplications.
+*/
+template< bool SO >  // Storage order
+template< typename MTX    // Type of the selecting sparse matrix
+        , typename MTY >  // Type of the selected sparse matrix
+void SMatSMatMultPattern<SO>::symbolic( const MTX& X, const MTY& Y )
+{
+   const size_t M( size() );
+   const size_t K( SO ? m_ : n_ );
+
+   // Traversing a single row/column of the result; in case no index array is given the indices
+   // are only counted
+   const auto traverse = [&]( size_t i, size_t* marker, size_t* indices, size_t& flops )
+   {
+      size_t pos( 0UL );
+
+      for( auto x=X.begin( i ); x!=X.end( i ); ++x )
+      {
+         const size_t k( x->index() );
+
+         for( auto y=Y.begin( k ); y!=Y.end( k ); ++y ) {
+            const size_t j( y->index() );
+            if( marker[j] != i ) {
+               marker[j] = i;
+               if( indices != nullptr ) indices[pos] = j;
+               ++pos;
+            }
+         }
+
+         flops += Y.nonZeros( k );
+      }
+
+      if( indices != nullptr ) {
+         std::sort( indices, indices+pos );
+      }
+
+      return pos;
+   };
+
+   size_t T( threads( lhsOffsets_.back() + rhsOffsets_.back() ) );
+
+   // Counting the non-zero elements and scalar multiplications of each row/column of the result
+   offsets_.resize( M+1UL, 0UL );
+   flops_.resize( M+1UL, 0UL );
+
+   smpFor( T, [&]( size_t t )
+   {
+      std::vector<size_t> marker( K, M );
+
+      for( size_t i=t*M/T; i<(t+1UL)*M/T; ++i ) {
+         offsets_[i+1UL] = traverse( i, marker.data(), nullptr, flops_[i+1UL] );
+      }
+   } );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+      flops_[i+1UL]   += flops_[i];
+   }
+
+   // Partitioning the rows/columns into chunks with a similar number of multiplications
+   const size_t total( flops_[M] );
+
+   T = threads( total );
+
+   partition_.resize( T+1UL, M );
+   partition_[0UL] = 0UL;
+
+   for( size_t t=1UL; t<T; ++t ) {
+      const auto pos( std::upper_bound( flops_.begin(), flops_.end(), t*total/T ) );
+      partition_[t] = max( partition_[t-1UL],
+                           min( M, static_cast<size_t>( pos - flops_.begin() ) - 1UL ) );
+   }
+
+   // Computing the sorted indices of each row/column of the result
+   indices_.resize( offsets_[M] );
+
+   smpFor( T, [&]( size_t t )
+   {
+      std::vector<size_t> marker( K, M );
+      size_t flops( 0UL );
+
+      for( size_t i=partition_[t]; i<partition_[t+1UL]; ++i ) {
+         traverse( i, marker.data(), indices_.data() + offsets_[i], flops );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Numeric phase of the sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+//
+// \param C The target compressed matrix.
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid sparsity pattern of the operand.
+//
+// This function computes the product of the two given sparse matrices and writes the result
+// directly into the storage of the given target matrix. The two operands must have the same
+// sparsity patterns as during the symbolic phase. In case the target matrix does not have the
+// sparsity pattern of the result, it is restructured before the computation.
+*/
+template< bool SO >  // Storage order
+template< typename Type   // Data type of the target matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void SMatSMatMultPattern<SO>::assign( CompressedMatrix<Type,SO>& C,
+                                      const SparseMatrix<MT1,SO>& lhs,
+                                      const SparseMatrix<MT2,SO>& rhs ) const
+{
+   CompositeType_t<MT1> A( ~lhs );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_t<MT2> B( ~rhs );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( A.rows() != m_ || B.columns() != n_ || A.columns() != B.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   checkOperand( A, lhsOffsets_ );
+   checkOperand( B, rhsOffsets_ );
+
+   if( !isStructured( C ) ) {
+      structure( C );
+   }
+
+   numeric( C, A, B, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase for row-major matrices.
+//
+// \param C The target compressed matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+*/
+template< bool SO >  // Storage order
+template< typename Type   // Data type of the target matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void SMatSMatMultPattern<SO>::numeric( CompressedMatrix<Type,SO>& C,
+                                              const MT1& A, const MT2& B, FalseType ) const
+{
+   numeric( C, A, B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase for column-major matrices.
+//
+// \param C The target compressed matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+*/
+template< bool SO >  // Storage order
+template< typename Type   // Data type of the target matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline void SMatSMatMultPattern<SO>::numeric( CompressedMatrix<Type,SO>& C,
+                                              const MT1& A, const MT2& B, TrueType ) const
+{
+   numeric( C, B, A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Accumulation of the products into the storage of the target matrix.
+//
+// \param C The target compressed matrix.
+// \param X The operand selecting the rows/columns of \a Y.
+// \param Y The operand providing the rows/columns of the result.
+// \return void
+//
+// Each thread maps the indices of the current row/column of the result to their position within
+// the target matrix via a dense workspace. Since the sparsity pattern of the target matrix is
+// fixed, the workspace does not have to be reset between two rows/columns.
+*/
+template< bool SO >  // Storage order
+template< typename Type   // Data type of the target matrix
+        , typename MTX    // Type of the selecting sparse matrix
+        , typename MTY >  // Type of the selected sparse matrix
+void SMatSMatMultPattern<SO>::numeric( CompressedMatrix<Type,SO>& C,
+                                       const MTX& X, const MTY& Y ) const
+{
+   const size_t K( SO ? m_ : n_ );
+
+   smpFor( partition_.size()-1UL, [&]( size_t t )
+   {
+      std::unique_ptr<size_t[],Deallocate> slot( allocate<size_t>( K ) );
+
+      for( size_t i=partition_[t]; i<partition_[t+1UL]; ++i )
+      {
+         const auto c( C.begin( i ) );
+         const size_t nonzeros( offsets_[i+1UL] - offsets_[i] );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            slot[c[k].index()] = k;
+            c[k].value() = Type();
+         }
+
+         for( auto x=X.begin( i ); x!=X.end( i ); ++x )
+         {
+            const size_t k( x->index() );
+
+            for( auto y=Y.begin( k ); y!=Y.end( k ); ++y ) {
+               BLAZE_USER_ASSERT( slot[y->index()] < nonzeros && c[slot[y->index()]].index() == y->index()
+                                , "Invalid sparsity pattern of the operand detected" );
+               if( SO ) c[slot[y->index()]].value() += y->value() * x->value();
+               else     c[slot[y->index()]].value() += x->value() * y->value();
+            }
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1083 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a SELL-C-sigma sparse matrix
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only sparse matrix in SELL-C-sigma format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template is a \f$ M \times N \f$ read-only sparse matrix in the sliced
+// ELLPACK (SELL-C-sigma) format, which is optimized for fast sparse matrix/dense vector
+// multiplications. The type of the elements and the chunk height of the matrix can be specified
+// via the two template parameters:
+
+   \code
+   template< typename Type, size_t C >
+   class SellMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SellMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - C   : specifies the chunk height, i.e. the number of rows that are stored interleaved.
+//          The default value is the number of elements of type \a Type in a SIMD vector.
+//
+// The rows of the matrix are grouped into chunks of \a C consecutive rows. Within each chunk,
+// all rows are padded with zero elements to the length of the longest row of the chunk and the
+// elements are stored column by column, i.e. the \f$ k \f$-th elements of the \a C rows of a
+// chunk are stored contiguously in memory. Thus the inner loop of a multiplication processes
+// \a C rows at once with unit stride accesses to the matrix elements, which can be mapped
+// directly onto SIMD operations. In order to reduce the number of padding elements, the rows
+// within each window of \a sigma consecutive rows are sorted by decreasing number of non-zero
+// elements before the chunks are formed. The sorting is transparent to the user, i.e. all
+// operations refer to the original row indices.
+//
+// A SellMatrix is created from any sparse matrix, most commonly from a CompressedMatrix. It
+// cannot be modified after construction, but it can be used in multiplications with dense
+// vectors, both as \f$ A*\vec{x} \f$ and as \f$ A^T*\vec{x} \f$:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SellMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 10000UL, 10000UL );
+   // ... Initialization
+
+   const SellMatrix<double> S( A );  // Default sorting scope
+   const SellMatrix<double> T( A, 1UL );  // No sorting
+
+   DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization
+
+   y  = S * x;          // Sparse matrix/dense vector multiplication
+   y += S * x;          // Addition assignment
+   y  = trans( S ) * x;  // Transpose sparse matrix/dense vector multiplication
+   y  = trans( trans( x ) * S );  // Equivalent formulation
+   \endcode
+
+// Both multiplications are executed in parallel in case the number of stored elements of the
+// matrix (including the padding elements) exceeds the BLAZE_SMP_SELLDVECMULT_THRESHOLD. Note
+// that the padding elements are stored as explicit zeros, which are multiplied with elements
+// of the dense vector. Therefore non-finite values in the dense vector may propagate to rows
+// (or, in case of \f$ A^T*\vec{x} \f$, to columns) that do not contain an according non-zero
+// element.
+*/
+template< typename Type                         // Data type of the matrix
+        , size_t C = SIMDTrait<Type>::size >  // Chunk height
+class SellMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = SellMatrix<Type,C>;  //!< Type of this SellMatrix instance.
+   using ResultType  = This;                //!< Result type for expression template evaluations.
+   using ElementType = Type;                //!< Type of the matrix elements.
+   using ReturnType  = const Type&;         //!< Return type for expression template evaluations.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SellMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SellMatrix<NewType,C>;  //!< The type of the other SellMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The default size of the sorting scope.
+   static constexpr size_t defaultSigma = 32UL*C;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SellMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline SellMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma = defaultSigma );
+
+   inline SellMatrix( const SellMatrix& sm );
+   inline SellMatrix( SellMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SellMatrix& operator=( const SellMatrix& rhs );
+   inline SellMatrix& operator=( SellMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ReturnType operator()( size_t i, size_t j ) const noexcept;
+   inline ReturnType at( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t sigma() const noexcept;
+   inline size_t chunks() const noexcept;
+   inline void   swap( SellMatrix& sm ) noexcept;
+
+   static constexpr size_t chunkHeight() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename VT >
+   inline MultTrait_t< Type, ElementType_t<VT> > multiply( size_t i, const VT& x ) const;
+
+   template< typename VT >
+   inline MultTrait_t< Type, ElementType_t<VT> > tmultiply( size_t j, const VT& x ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   void multiply( VT1& y, const VT2& x, OP op ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   void tmultiply( VT1& y, const VT2& x, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t threads() const noexcept;
+   inline size_t partition( size_t t, size_t threads ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                                     //!< The current number of rows of the matrix.
+   size_t n_;                                     //!< The current number of columns of the matrix.
+   size_t nonzeros_;                              //!< The number of non-zero elements.
+   size_t sigma_;                                 //!< The size of the sorting scope.
+   std::vector<size_t> permutation_;              //!< The original index of each sorted row.
+   std::vector<size_t> positions_;                //!< The sorted position of each original row.
+   std::vector<size_t> lengths_;                  //!< The number of non-zero elements of each row.
+   std::vector<size_t> offsets_;                  //!< The offset of each chunk.
+   std::unique_ptr<Type[],Deallocate>   values_;   //!< The values of the stored elements.
+   std::unique_ptr<size_t[],Deallocate> indices_;  //!< The column indices of the stored elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+const Type SellMatrix<Type,C>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline SellMatrix<Type,C>::SellMatrix() noexcept
+   : m_          ( 0UL )           // The current number of rows of the matrix
+   , n_          ( 0UL )           // The current number of columns of the matrix
+   , nonzeros_   ( 0UL )           // The number of non-zero elements
+   , sigma_      ( defaultSigma )  // The size of the sorting scope
+   , permutation_()                // The original index of each sorted row
+   , positions_  ()                // The sorted position of each original row
+   , lengths_    ()                // The number of non-zero elements of each row
+   , offsets_    ( 1UL, 0UL )      // The offset of each chunk
+   , values_     ()                // The values of the stored elements
+   , indices_    ()                // The column indices of the stored elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a sparse matrix.
+//
+// \param sm Sparse matrix to be converted.
+// \param sigma The size of the sorting scope.
+// \exception std::invalid_argument Invalid sorting scope.
+//
+// This constructor converts the given sparse matrix into the SELL-C-sigma format. The rows
+// within each window of \a sigma consecutive rows are sorted by decreasing number of non-zero
+// elements. A sorting scope of 1 disables the sorting, a sorting scope of 0 is invalid and
+// results in a \a std::invalid_argument exception. Column-major matrices are converted into
+// a temporary row-major compressed matrix first.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline SellMatrix<Type,C>::SellMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma )
+   : m_          ( (~sm).rows() )           // The current number of rows of the matrix
+   , n_          ( (~sm).columns() )        // The current number of columns of the matrix
+   , nonzeros_   ( 0UL )                    // The number of non-zero elements
+   , sigma_      ( sigma )                  // The size of the sorting scope
+   , permutation_( m_ )                     // The original index of each sorted row
+   , positions_  ( m_ )                     // The sorted position of each original row
+   , lengths_    ( m_ )                     // The number of non-zero elements of each row
+   , offsets_    ( (m_+C-1UL)/C+1UL, 0UL )  // The offset of each chunk
+   , values_     ()                         // The values of the stored elements
+   , indices_    ()                         // The column indices of the stored elements
+{
+   if( sigma == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sorting scope" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand A( ~sm );  // Row-major evaluation of the sparse matrix
+
+   // Sorting the rows within each sorting scope by decreasing number of non-zero elements
+   for( size_t i=0UL; i<m_; ++i ) {
+      permutation_[i] = i;
+      lengths_[i] = A.nonZeros( i );
+      nonzeros_ += lengths_[i];
+   }
+
+   if( sigma_ > 1UL )
+   {
+      for( size_t ibegin=0UL; ibegin<m_; )
+      {
+         const size_t iend( ( m_-ibegin > sigma_ )?( ibegin+sigma_ ):( m_ ) );
+
+         std::stable_sort( permutation_.begin()+ibegin, permutation_.begin()+iend,
+                           [this]( size_t i1, size_t i2 ) { return lengths_[i1] > lengths_[i2]; } );
+
+         ibegin = iend;
+      }
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      positions_[permutation_[i]] = i;
+   }
+
+   // Computing the width of each chunk
+   const size_t chunks( offsets_.size()-1UL );
+
+   for( size_t c=0UL; c<chunks; ++c )
+   {
+      const size_t rend( min( C, m_-c*C ) );
+
+      size_t width( 0UL );
+      for( size_t r=0UL; r<rend; ++r ) {
+         width = max( width, lengths_[permutation_[c*C+r]] );
+      }
+
+      offsets_[c+1UL] = offsets_[c] + width*C;
+   }
+
+   values_.reset( allocate<Type>( offsets_[chunks] ) );
+   indices_.reset( allocate<size_t>( offsets_[chunks] ) );
+
+   // Filling the chunks; the padding elements repeat the last column index of the row
+   const size_t T( threads() );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t cbegin( partition( t, T ) );
+      const size_t cend  ( partition( t+1UL, T ) );
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         Type*   const values ( values_.get()  + offsets_[c] );
+         size_t* const indices( indices_.get() + offsets_[c] );
+
+         const size_t width( ( offsets_[c+1UL] - offsets_[c] ) / C );
+
+         for( size_t r=0UL; r<C; ++r )
+         {
+            size_t k( 0UL );
+            size_t index( 0UL );
+
+            if( c*C+r < m_ ) {
+               const size_t i( permutation_[c*C+r] );
+               for( auto element=A.begin( i ); element!=A.end( i ); ++element, ++k ) {
+                  values [k*C+r] = element->value();
+                  indices[k*C+r] = index = element->index();
+               }
+            }
+
+            for( ; k<width; ++k ) {
+               values [k*C+r] = Type();
+               indices[k*C+r] = index;
+            }
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SellMatrix.
+//
+// \param sm Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline SellMatrix<Type,C>::SellMatrix( const SellMatrix& sm )
+   : m_          ( sm.m_ )            // The current number of rows of the matrix
+   , n_          ( sm.n_ )            // The current number of columns of the matrix
+   , nonzeros_   ( sm.nonzeros_ )     // The number of non-zero elements
+   , sigma_      ( sm.sigma_ )        // The size of the sorting scope
+   , permutation_( sm.permutation_ )  // The original index of each sorted row
+   , positions_  ( sm.positions_ )    // The sorted position of each original row
+   , lengths_    ( sm.lengths_ )      // The number of non-zero elements of each row
+   , offsets_    ( sm.offsets_ )      // The offset of each chunk
+   , values_     ( allocate<Type>( sm.capacity() ) )    // The values of the stored elements
+   , indices_    ( allocate<size_t>( sm.capacity() ) )  // The column indices of the stored elements
+{
+   std::copy( sm.values_.get() , sm.values_.get()  + capacity(), values_.get()  );
+   std::copy( sm.indices_.get(), sm.indices_.get() + capacity(), indices_.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SellMatrix.
+//
+// \param sm The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline SellMatrix<Type,C>::SellMatrix( SellMatrix&& sm ) noexcept
+   : m_          ( sm.m_ )                       // The current number of rows of the matrix
+   , n_          ( sm.n_ )                       // The current number of columns of the matrix
+   , nonzeros_   ( sm.nonzeros_ )                // The number of non-zero elements
+   , sigma_      ( sm.sigma_ )                   // The size of the sorting scope
+   , permutation_( std::move( sm.permutation_ ) )  // The original index of each sorted row
+   , positions_  ( std::move( sm.positions_ ) )    // The sorted position of each original row
+   , lengths_    ( std::move( sm.lengths_ ) )      // The number of non-zero elements of each row
+   , offsets_    ( std::move( sm.offsets_ ) )      // The offset of each chunk
+   , values_     ( std::move( sm.values_ ) )       // The values of the stored elements
+   , indices_    ( std::move( sm.indices_ ) )      // The column indices of the stored elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.nonzeros_ = 0UL;
+   sm.permutation_.clear();
+   sm.positions_.clear();
+   sm.lengths_.clear();
+   sm.offsets_.assign( 1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SellMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline SellMatrix<Type,C>& SellMatrix<Type,C>::operator=( const SellMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SellMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SellMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline SellMatrix<Type,C>& SellMatrix<Type,C>::operator=( SellMatrix&& rhs ) noexcept
+{
+   SellMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline typename SellMatrix<Type,C>::ReturnType
+   SellMatrix<Type,C>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t pos( positions_[i] );
+   const size_t offset( offsets_[pos/C] + pos%C );
+
+   for( size_t k=0UL; k<lengths_[i]; ++k ) {
+      if( indices_[offset+k*C] == j )
+         return values_[offset+k*C];
+   }
+
+   return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline typename SellMatrix<Type,C>::ReturnType
+   SellMatrix<Type,C>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the sparse matrix.
+//
+// \return The number of stored elements including the padding elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::capacity() const noexcept
+{
+   return offsets_.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return lengths_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting scope.
+//
+// \return The size of the sorting scope.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::chunks() const noexcept
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the chunk height of the sparse matrix.
+//
+// \return The number of rows per chunk.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+constexpr size_t SellMatrix<Type,C>::chunkHeight() noexcept
+{
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline void SellMatrix<Type,C>::swap( SellMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( nonzeros_, sm.nonzeros_ );
+   swap( sigma_, sm.sigma_ );
+   swap( permutation_, sm.permutation_ );
+   swap( positions_, sm.positions_ );
+   swap( lengths_, sm.lengths_ );
+   swap( offsets_, sm.offsets_ );
+   swap( values_, sm.values_ );
+   swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads for a multiplication.
+//
+// \return The number of threads to be used.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::threads() const noexcept
+{
+   if( capacity() < SMP_SELLDVECMULT_THRESHOLD || chunks() < 2UL )
+      return 1UL;
+   return min( getNumThreads(), chunks() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first chunk of the given thread.
+//
+// \param t The index of the thread.
+// \param threads The total number of threads.
+// \return The index of the first chunk of the given thread.
+//
+// This function partitions the chunks into \a threads contiguous ranges with a similar number
+// of stored elements.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline size_t SellMatrix<Type,C>::partition( size_t t, size_t threads ) const noexcept
+{
+   if( t == 0UL ) return 0UL;
+   if( t >= threads ) return chunks();
+
+   const auto pos( std::upper_bound( offsets_.begin(), offsets_.end(), t*capacity()/threads ) );
+   return min( chunks(), static_cast<size_t>( pos - offsets_.begin() ) - 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t C >        // Chunk height
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,C>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t C >        // Chunk height
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type,C>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a single element of the product of the matrix and a dense vector.
+//
+// \param i The index of the row.
+// \param x The right-hand side dense vector.
+// \return The inner product of the \a i-th row and the given dense vector.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+template< typename VT >  // Type of the dense vector
+inline MultTrait_t< Type, ElementType_t<VT> >
+   SellMatrix<Type,C>::multiply( size_t i, const VT& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( x.size() == columns(), "Invalid vector size" );
+
+   const size_t pos( positions_[i] );
+   const size_t offset( offsets_[pos/C] + pos%C );
+
+   MultTrait_t< Type, ElementType_t<VT> > sum{};
+
+   for( size_t k=0UL; k<lengths_[i]; ++k ) {
+      sum += values_[offset+k*C] * x[indices_[offset+k*C]];
+   }
+
+   return sum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a single element of the product of the transpose matrix and a dense vector.
+//
+// \param j The index of the column.
+// \param x The right-hand side dense vector.
+// \return The inner product of the \a j-th column and the given dense vector.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator. Note that this function traverses all non-zero elements of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+template< typename VT >  // Type of the dense vector
+inline MultTrait_t< Type, ElementType_t<VT> >
+   SellMatrix<Type,C>::tmultiply( size_t j, const VT& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( x.size() == rows(), "Invalid vector size" );
+
+   MultTrait_t< Type, ElementType_t<VT> > sum{};
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t pos( positions_[i] );
+      const size_t offset( offsets_[pos/C] + pos%C );
+      for( size_t k=0UL; k<lengths_[i]; ++k ) {
+         if( indices_[offset+k*C] == j )
+            sum += values_[offset+k*C] * x[i];
+      }
+   }
+
+   return sum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the matrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation to combine each element of \a y with the result.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.\n
+// The chunks are processed in parallel with a similar number of stored elements per thread.
+// The \a C rows of a chunk are computed simultaneously with unit stride accesses to the matrix
+// elements, i.e. the innermost loop has a compile time trip count of \a C and can be mapped
+// onto SIMD operations (including gather operations for the elements of \a x).
+*/
+template< typename Type   // Data type of the matrix
+        , size_t C >      // Chunk height
+template< typename VT1    // Type of the target dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void SellMatrix<Type,C>::multiply( VT1& y, const VT2& x, OP op ) const
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( x.size() == columns(), "Invalid vector size" );
+
+   const size_t T( threads() );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t cbegin( partition( t, T ) );
+      const size_t cend  ( partition( t+1UL, T ) );
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const Type*   values ( values_.get()  + offsets_[c] );
+         const size_t* indices( indices_.get() + offsets_[c] );
+
+         const size_t width( ( offsets_[c+1UL] - offsets_[c] ) / C );
+
+         ET tmp[C]{};
+
+         for( size_t k=0UL; k<width; ++k, values+=C, indices+=C ) {
+            for( size_t r=0UL; r<C; ++r ) {
+               tmp[r] += values[r] * x[indices[r]];
+            }
+         }
+
+         const size_t* const rows( permutation_.data() + c*C );
+         const size_t rend( min( C, m_-c*C ) );
+
+         for( size_t r=0UL; r<rend; ++r ) {
+            op( y[rows[r]], tmp[r] );
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the transpose matrix with a dense vector (\f$ \vec{y}=A^T*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation to combine each element of \a y with the result.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.\n
+// Since several rows of a chunk may contribute to the same element of the result, each thread
+// accumulates its chunks into a private dense buffer. The buffers are summed up in parallel and
+// combined with the target vector afterwards. Thus the result does not depend on the execution
+// order of the threads.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t C >      // Chunk height
+template< typename VT1    // Type of the target dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void SellMatrix<Type,C>::tmultiply( VT1& y, const VT2& x, OP op ) const
+{
+   using ET = ElementType_t<VT1>;
+   using XT = ElementType_t<VT2>;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == columns(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( x.size() == rows()   , "Invalid vector size" );
+
+   const size_t T( threads() );
+   const size_t N( n_ );
+
+   std::unique_ptr<ET[],Deallocate> buffer( allocate<ET>( T*N ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      ET* const tmp( buffer.get() + t*N );
+      std::fill( tmp, tmp+N, ET() );
+
+      const size_t cbegin( partition( t, T ) );
+      const size_t cend  ( partition( t+1UL, T ) );
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const Type*   values ( values_.get()  + offsets_[c] );
+         const size_t* indices( indices_.get() + offsets_[c] );
+
+         const size_t width( ( offsets_[c+1UL] - offsets_[c] ) / C );
+         const size_t* const rows( permutation_.data() + c*C );
+         const size_t rend( min( C, m_-c*C ) );
+
+         XT xr[C]{};
+
+         for( size_t r=0UL; r<rend; ++r ) {
+            xr[r] = x[rows[r]];
+         }
+
+         for( size_t k=0UL; k<width; ++k, values+=C, indices+=C ) {
+            for( size_t r=0UL; r<C; ++r ) {
+               tmp[indices[r]] += values[r] * xr[r];
+            }
+         }
+      }
+   } );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t jbegin( t*N/T );
+      const size_t jend  ( (t+1UL)*N/T );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         ET sum( buffer[j] );
+         for( size_t s=1UL; s<T; ++s ) {
+            sum += buffer[s*N+j];
+         }
+         op( y[j], sum );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type, size_t C >
+inline void swap( SellMatrix<Type,C>& a, SellMatrix<Type,C>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t C >     // Chunk height
+inline void swap( SellMatrix<Type,C>& a, SellMatrix<Type,C>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
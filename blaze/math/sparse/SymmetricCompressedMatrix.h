@@ -0,0 +1,1092 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymmetricCompressedMatrix.h
+//  \brief Implementation of a half-storage symmetric compressed sparse matrix
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup symmetric_compressed_matrix SymmetricCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Symmetric sparse matrix storing only the upper triangle.
+// \ingroup symmetric_compressed_matrix
+//
+// The SymmetricCompressedMatrix class template is a \f$ N \times N \f$ symmetric sparse matrix
+// that stores only the diagonal and the upper triangle in compressed row format. In contrast to
+// a SymmetricMatrix adaptor wrapping a CompressedMatrix, which stores both triangles and mirrors
+// every write, each off-diagonal element is stored once. This halves the memory consumption and
+// the setup costs and, in a multiplication with a dense vector, each stored off-diagonal element
+// \f$ a_{ij} \f$ is loaded once and used twice: for \f$ y_i \mathrel{+}= a_{ij} x_j \f$ and for
+// \f$ y_j \mathrel{+}= a_{ij} x_i \f$. The type of the elements can be specified via the single
+// template parameter:
+
+   \code
+   template< typename Type >
+   class SymmetricCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SymmetricCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//
+// A SymmetricCompressedMatrix can be created from any square sparse matrix. Only the diagonal
+// and the upper triangle of the given matrix are used, the lower triangle is ignored. Thus a
+// matrix that has been assembled in the lower triangle only is converted via its transpose.
+// Alternatively, the upper triangle can be set up directly via the low-level functions
+// reserve(), append(), and finalize():
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SymmetricCompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 10000UL, 10000UL );  // Symmetric or upper triangular matrix
+   CompressedMatrix<double> L( 10000UL, 10000UL );  // Lower triangular matrix
+   // ... Initialization
+
+   const SymmetricCompressedMatrix<double> S( A );
+   const SymmetricCompressedMatrix<double> T( trans( L ) );
+
+   DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization
+
+   y  = S * x;            // Symmetric sparse matrix/dense vector multiplication
+   y += S * x;            // Addition assignment
+   y  = trans( x * S );  // Equivalent formulation
+
+   const CompressedMatrix<double> B( S.compress() );  // Conversion into a general matrix
+   \endcode
+
+// The multiplication with a dense vector is executed in parallel in case the number of stored
+// elements exceeds the BLAZE_SMP_SYMDVECMULT_THRESHOLD. The rows are partitioned into contiguous
+// ranges with a similar number of stored elements. Each thread adds the contributions to its own
+// range directly to the result and collects the mirrored contributions to the rows of the
+// subsequent ranges in a private buffer, which is limited to the largest column index of its
+// rows. Thus the threads never write to the same memory location and the result does not depend
+// on the execution order of the threads.
+*/
+template< typename Type >  // Data type of the matrix
+class SymmetricCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = SymmetricCompressedMatrix<Type>;  //!< Type of this SymmetricCompressedMatrix instance.
+   using ResultType  = This;                             //!< Result type for expression template evaluations.
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using ReturnType  = const Type&;                      //!< Return type for expression template evaluations.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SymmetricCompressedMatrix with different element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SymmetricCompressedMatrix<NewType>;  //!< The type of the other SymmetricCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SymmetricCompressedMatrix() noexcept;
+   explicit inline SymmetricCompressedMatrix( size_t n );
+   explicit inline SymmetricCompressedMatrix( size_t n, size_t nonzeros );
+
+   template< typename MT, bool SO >
+   explicit inline SymmetricCompressedMatrix( const SparseMatrix<MT,SO>& sm );
+
+   inline SymmetricCompressedMatrix( const SymmetricCompressedMatrix& sm );
+   inline SymmetricCompressedMatrix( SymmetricCompressedMatrix&& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SymmetricCompressedMatrix& operator=( const SymmetricCompressedMatrix& rhs );
+   inline SymmetricCompressedMatrix& operator=( SymmetricCompressedMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ReturnType operator()( size_t i, size_t j ) const noexcept;
+   inline ReturnType at( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear();
+   inline void   swap( SymmetricCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void reserve ( size_t nonzeros );
+   inline void append  ( size_t i, size_t j, const Type& value );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   inline CompressedMatrix<Type,rowMajor> compress() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename VT >
+   inline MultTrait_t< Type, ElementType_t<VT> > multiply( size_t i, const VT& x ) const;
+
+   template< typename VT1, typename VT2, typename OP >
+   void multiply( VT1& y, const VT2& x, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t threads() const noexcept;
+   inline size_t partition( size_t t, size_t threads ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                     //!< The current number of rows and columns of the matrix.
+   std::vector<Type>   values_;   //!< The values of the stored elements.
+   std::vector<size_t> indices_;  //!< The column indices of the stored elements.
+   std::vector<size_t> offsets_;  //!< The offset of each row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >  // Data type of the matrix
+const Type SymmetricCompressedMatrix<Type>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SymmetricCompressedMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix() noexcept
+   : n_      ( 0UL )        // The current number of rows and columns of the matrix
+   , values_ ()             // The values of the stored elements
+   , indices_()             // The column indices of the stored elements
+   , offsets_( 1UL, 0UL )   // The offset of each row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix( size_t n )
+   : n_      ( n )            // The current number of rows and columns of the matrix
+   , values_ ()               // The values of the stored elements
+   , indices_()               // The column indices of the stored elements
+   , offsets_( n+1UL, 0UL )   // The offset of each row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+// \param nonzeros The number of expected elements in the upper triangle.
+//
+// The matrix is initialized to the zero matrix and provides enough capacity for at least
+// \a nonzeros elements of the diagonal and the upper triangle.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix( size_t n, size_t nonzeros )
+   : n_      ( n )            // The current number of rows and columns of the matrix
+   , values_ ()               // The values of the stored elements
+   , indices_()               // The column indices of the stored elements
+   , offsets_( n+1UL, 0UL )   // The offset of each row
+{
+   reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a sparse matrix.
+//
+// \param sm Sparse matrix to be converted.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// This constructor converts the given square sparse matrix into a half-storage symmetric matrix.
+// Only the diagonal and the upper triangle of \a sm are used, the lower triangle is ignored. In
+// case \a sm is not a square matrix, a \a std::invalid_argument exception is thrown. Column-major
+// matrices are converted into a temporary row-major compressed matrix first.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : n_      ( (~sm).rows() )           // The current number of rows and columns of the matrix
+   , values_ ()                         // The values of the stored elements
+   , indices_()                         // The column indices of the stored elements
+   , offsets_( (~sm).rows()+1UL, 0UL )  // The offset of each row
+{
+   if( (~sm).rows() != (~sm).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of symmetric matrix" );
+   }
+
+   using Operand = If_t< SO, const CompressedMatrix<Type,rowMajor>, CompositeType_t<MT> >;
+
+   Operand A( ~sm );  // Row-major evaluation of the sparse matrix
+
+   reserve( ( A.nonZeros() + n_ ) / 2UL );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=A.begin( i ); element!=A.end( i ); ++element ) {
+         if( element->index() >= i ) {
+            values_.push_back( element->value() );
+            indices_.push_back( element->index() );
+         }
+      }
+      offsets_[i+1UL] = values_.size();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SymmetricCompressedMatrix.
+//
+// \param sm Matrix to be copied.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix( const SymmetricCompressedMatrix& sm )
+   : n_      ( sm.n_ )        // The current number of rows and columns of the matrix
+   , values_ ( sm.values_ )   // The values of the stored elements
+   , indices_( sm.indices_ )  // The column indices of the stored elements
+   , offsets_( sm.offsets_ )  // The offset of each row
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SymmetricCompressedMatrix.
+//
+// \param sm The matrix to be moved into this instance.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>::SymmetricCompressedMatrix( SymmetricCompressedMatrix&& sm ) noexcept
+   : n_      ( sm.n_ )                     // The current number of rows and columns of the matrix
+   , values_ ( std::move( sm.values_ ) )   // The values of the stored elements
+   , indices_( std::move( sm.indices_ ) )  // The column indices of the stored elements
+   , offsets_( std::move( sm.offsets_ ) )  // The offset of each row
+{
+   sm.n_ = 0UL;
+   sm.values_.clear();
+   sm.indices_.clear();
+   sm.offsets_.assign( 1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SymmetricCompressedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>&
+   SymmetricCompressedMatrix<Type>::operator=( const SymmetricCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SymmetricCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SymmetricCompressedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SymmetricCompressedMatrix<Type>&
+   SymmetricCompressedMatrix<Type>::operator=( SymmetricCompressedMatrix&& rhs ) noexcept
+{
+   SymmetricCompressedMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices. Accesses to
+// elements of the lower triangle are redirected to the according element of the upper triangle.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SymmetricCompressedMatrix<Type>::ReturnType
+   SymmetricCompressedMatrix<Type>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( i > j ) {
+      std::swap( i, j );
+   }
+
+   const auto begin( indices_.begin() + offsets_[i] );
+   const auto end  ( indices_.begin() + offsets_[i+1UL] );
+   const auto pos  ( std::lower_bound( begin, end, j ) );
+
+   if( pos != end && *pos == j )
+      return values_[pos - indices_.begin()];
+   return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SymmetricCompressedMatrix<Type>::ReturnType
+   SymmetricCompressedMatrix<Type>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::capacity() const noexcept
+{
+   return values_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the sparse matrix.
+//
+// \return The number of stored elements of the diagonal and the upper triangle.
+//
+// Note that each stored off-diagonal element represents two non-zero elements of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::nonZeros() const noexcept
+{
+   return offsets_[n_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of stored elements of row \a i on and above the diagonal.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type >  // Data type of the matrix
+inline void SymmetricCompressedMatrix<Type>::clear()
+{
+   n_ = 0UL;
+   values_.clear();
+   indices_.clear();
+   offsets_.assign( 1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void SymmetricCompressedMatrix<Type>::swap( SymmetricCompressedMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( n_, sm.n_ );
+   swap( values_, sm.values_ );
+   swap( indices_, sm.indices_ );
+   swap( offsets_, sm.offsets_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads for a multiplication.
+//
+// \return The number of threads to be used.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::threads() const noexcept
+{
+   if( nonZeros() < SMP_SYMDVECMULT_THRESHOLD || n_ < 2UL )
+      return 1UL;
+   return min( getNumThreads(), n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first row of the given thread.
+//
+// \param t The index of the thread.
+// \param threads The total number of threads.
+// \return The index of the first row of the given thread.
+//
+// This function partitions the rows into \a threads contiguous ranges with a similar number
+// of stored elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SymmetricCompressedMatrix<Type>::partition( size_t t, size_t threads ) const noexcept
+{
+   if( t == 0UL ) return 0UL;
+   if( t >= threads ) return n_;
+
+   const auto pos( std::upper_bound( offsets_.begin(), offsets_.end(), t*nonZeros()/threads ) );
+   return min( n_, static_cast<size_t>( pos - offsets_.begin() ) - 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements
+// of the diagonal and the upper triangle. The current values of the matrix elements are
+// preserved.
+*/
+template< typename Type >  // Data type of the matrix
+inline void SymmetricCompressedMatrix<Type>::reserve( size_t nonzeros )
+{
+   values_.reserve( nonzeros );
+   indices_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[i..N-1]\f$.
+// \param value The value of the element to be appended.
+// \return void
+//
+// This function provides a very efficient way to fill a half-storage symmetric sparse matrix
+// with elements. It appends a new element to the end of the specified row. Therefore it is
+// strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be on or above the diagonal, i.e. \a j >= \a i
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row of the sparse matrix
+//  - all previous rows have to be finalized via the finalize() function
+//
+// Ignoring these preconditions might result in undefined behavior! Each off-diagonal element
+// represents both the element \f$ a_{ij} \f$ and the element \f$ a_{ji} \f$:
+
+   \code
+   using blaze::SymmetricCompressedMatrix;
+
+   SymmetricCompressedMatrix<double> A( 3UL );
+   A.reserve( 4UL );             // Reserving enough capacity for 4 stored elements
+   A.append( 0UL, 0UL, 4.0 );    // Appending the diagonal element (0,0)
+   A.append( 0UL, 2UL, -1.0 );   // Appending the elements (0,2) and (2,0)
+   A.finalize( 0UL );            // Finalizing row 0
+   A.append( 1UL, 1UL, 4.0 );    // Appending the diagonal element (1,1)
+   A.finalize( 1UL );            // Finalizing row 1
+   A.append( 2UL, 2UL, 4.0 );    // Appending the diagonal element (2,2)
+   A.finalize( 2UL );            // Finalizing row 2
+   \endcode
+
+// \note The \c finalize() function has to be explicitly called for each row, even for empty
+// ones!
+*/
+template< typename Type >  // Data type of the matrix
+inline void SymmetricCompressedMatrix<Type>::append( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   BLAZE_USER_ASSERT( i <= j, "Invalid access to lower triangle" );
+   BLAZE_USER_ASSERT( offsets_[i+1UL] == values_.size(), "Previous rows are not finalized" );
+   BLAZE_USER_ASSERT( offsets_[i] == offsets_[i+1UL] || j > indices_.back(), "Index is not strictly increasing" );
+
+   values_.push_back( value );
+   indices_.push_back( j );
+   ++offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row.
+//
+// \param i The index of the row to be finalized \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a half-storage symmetric
+// sparse matrix with elements. After completion of row \a i via the append() function, this
+// function can be called to finalize row \a i and prepare the next row for insertion process
+// via append().
+*/
+template< typename Type >  // Data type of the matrix
+inline void SymmetricCompressedMatrix<Type>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   if( i+1UL < n_ )
+      offsets_[i+2UL] = offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the half-storage symmetric matrix into a compressed matrix.
+//
+// \return The row-major compressed matrix containing both triangles of the symmetric matrix.
+//
+// This function converts the half-storage symmetric matrix into a general row-major compressed
+// matrix by mirroring the stored upper triangle into the lower triangle.
+*/
+template< typename Type >  // Data type of the matrix
+inline CompressedMatrix<Type,rowMajor> SymmetricCompressedMatrix<Type>::compress() const
+{
+   // Counting the mirrored elements of each row
+   std::vector<size_t> lower( n_+1UL, 0UL );
+
+   for( size_t k=0UL; k<nonZeros(); ++k ) {
+      ++lower[indices_[k]+1UL];
+   }
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      if( offsets_[i] != offsets_[i+1UL] && indices_[offsets_[i]] == i )
+         --lower[i+1UL];
+   }
+
+   std::partial_sum( lower.begin(), lower.end(), lower.begin() );
+
+   // Mirroring the strictly upper triangle in increasing order of the row indices
+   std::vector<size_t> positions( lower.begin(), lower.end()-1UL );
+   std::vector<size_t> rows( lower[n_] );
+   std::vector<size_t> elements( lower[n_] );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         if( indices_[k] != i ) {
+            const size_t pos( positions[indices_[k]]++ );
+            rows[pos] = i;
+            elements[pos] = k;
+         }
+      }
+   }
+
+   CompressedMatrix<Type,rowMajor> A( n_, n_, nonZeros() + lower[n_] );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t k=lower[i]; k<lower[i+1UL]; ++k ) {
+         A.append( i, rows[k], values_[elements[k]] );
+      }
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         A.append( i, indices_[k], values_[k] );
+      }
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricCompressedMatrix<Type>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricCompressedMatrix<Type>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a single element of the product of the matrix and a dense vector.
+//
+// \param i The index of the row.
+// \param x The right-hand side dense vector.
+// \return The inner product of the \a i-th row and the given dense vector.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator. Note that the part of row \a i below the diagonal is found by means
+// of a binary search in each of the first \a i rows.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT >    // Type of the dense vector
+inline MultTrait_t< Type, ElementType_t<VT> >
+   SymmetricCompressedMatrix<Type>::multiply( size_t i, const VT& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( x.size() == columns(), "Invalid vector size" );
+
+   MultTrait_t< Type, ElementType_t<VT> > sum{};
+
+   for( size_t r=0UL; r<i; ++r ) {
+      const auto end( indices_.begin() + offsets_[r+1UL] );
+      const auto pos( std::lower_bound( indices_.begin() + offsets_[r], end, i ) );
+      if( pos != end && *pos == i )
+         sum += values_[pos - indices_.begin()] * x[r];
+   }
+
+   for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+      sum += values_[k] * x[indices_[k]];
+   }
+
+   return sum;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the matrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param op The assignment operation to combine each element of \a y with the result.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// multiplication operator.\n
+// The matrix is traversed once. Each stored off-diagonal element \f$ a_{ij} \f$ contributes
+// to the inner product of row \a i and is scattered to row \a j of the result. The rows are
+// processed in parallel in contiguous ranges with a similar number of stored elements. Since
+// \f$ j > i \f$, a thread scatters only to its own range and to the ranges of the subsequent
+// threads. The contributions to its own range are accumulated in a shared buffer, all others
+// in a private buffer that reaches from the end of its range to its largest column index. The
+// buffers are summed up in parallel and combined with the target vector afterwards.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT1     // Type of the target dense vector
+        , typename VT2     // Type of the right-hand side dense vector
+        , typename OP >    // Type of the assignment operation
+void SymmetricCompressedMatrix<Type>::multiply( VT1& y, const VT2& x, OP op ) const
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( x.size() == columns(), "Invalid vector size" );
+
+   const size_t T( threads() );
+
+   std::vector<size_t> bounds( T+1UL );   // The first row of each thread
+   std::vector<size_t> extents( T+1UL );  // The offset of the private buffer of each thread
+
+   for( size_t t=0UL; t<=T; ++t ) {
+      bounds[t] = partition( t, T );
+   }
+
+   for( size_t t=0UL; t<T; ++t ) {
+      size_t jend( bounds[t+1UL] );
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+         if( offsets_[i] != offsets_[i+1UL] )
+            jend = max( jend, indices_[offsets_[i+1UL]-1UL]+1UL );
+      }
+      extents[t+1UL] = extents[t] + jend - bounds[t+1UL];
+   }
+
+   std::unique_ptr<ET[],Deallocate> shared ( allocate<ET>( n_ ) );
+   std::unique_ptr<ET[],Deallocate> buffers( allocate<ET>( extents[T] ) );
+
+   smpFor( T, [&]( size_t t )
+   {
+      const size_t ibegin( bounds[t] );
+      const size_t iend  ( bounds[t+1UL] );
+
+      ET* const tmp( shared.get() );
+      ET* const buffer( buffers.get() + extents[t] );
+
+      std::fill( tmp+ibegin, tmp+iend, ET() );
+      std::fill( buffer, buffers.get()+extents[t+1UL], ET() );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const auto xi( x[i] );
+         size_t k( offsets_[i] );
+         const size_t kend( offsets_[i+1UL] );
+
+         ET sum{};
+
+         if( k != kend && indices_[k] == i ) {
+            sum += values_[k] * xi;
+            ++k;
+         }
+
+         for( ; k<kend && indices_[k]<iend; ++k ) {
+            const size_t j( indices_[k] );
+            sum    += values_[k] * x[j];
+            tmp[j] += values_[k] * xi;
+         }
+
+         for( ; k<kend; ++k ) {
+            const size_t j( indices_[k] );
+            sum            += values_[k] * x[j];
+            buffer[j-iend] += values_[k] * xi;
+         }
+
+         tmp[i] += sum;
+      }
+   } );
+
+   smpFor( T, [&]( size_t t )
+   {
+      for( size_t j=bounds[t]; j<bounds[t+1UL]; ++j )
+      {
+         ET sum( shared[j] );
+
+         for( size_t s=0UL; s<t; ++s ) {
+            if( j < bounds[s+1UL] + extents[s+1UL] - extents[s] )
+               sum += buffers[extents[s]+j-bounds[s+1UL]];
+         }
+
+         op( y[j], sum );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRICCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SymmetricCompressedMatrix operators */
+//@{
+template< typename Type >
+inline const SymmetricCompressedMatrix<Type>&
+   trans( const SymmetricCompressedMatrix<Type>& sm ) noexcept;
+
+template< typename Type >
+inline void swap( SymmetricCompressedMatrix<Type>& a, SymmetricCompressedMatrix<Type>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the transpose of the given symmetric sparse matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param sm The symmetric sparse matrix to be transposed.
+// \return Reference to the given matrix.
+//
+// Since the matrix is symmetric, this function returns a reference to the given matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline const SymmetricCompressedMatrix<Type>&
+   trans( const SymmetricCompressedMatrix<Type>& sm ) noexcept
+{
+   return sm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+// \ingroup symmetric_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void swap( SymmetricCompressedMatrix<Type>& a, SymmetricCompressedMatrix<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
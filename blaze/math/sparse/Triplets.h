@@ -0,0 +1,301 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Triplets.h
+//  \brief Header file for the sorting of (row, column, value) triplets
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETS_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SORTEDTRIPLETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compressed representation of a sorted set of (row, column, value) triplets.
+// \ingroup sparse_matrix
+//
+// The SortedTriplets class template holds the result of the sortTriplets() function. The
+// triplets of the \a k-th row (row-major) or column (column-major) are stored in the range
+// \f$[offsets[k]..offsets[k]+nonzeros[k]-1]\f$ of the \a indices and \a values arrays, sorted
+// by their minor index and free of duplicates.
+*/
+template< typename Type >  // Data type of the values
+struct SortedTriplets
+{
+   std::vector<size_t> offsets;                    //!< The first position of each row/column.
+   std::vector<size_t> nonzeros;                   //!< The number of elements of each row/column.
+   std::vector<size_t> partition;                  //!< Balanced partition of the rows/columns.
+   std::unique_ptr<size_t[],Deallocate> indices;   //!< The minor indices of the elements.
+   std::unique_ptr<Type[],Deallocate>   values;    //!< The values of the elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stable sorting of the elements of a single row/column by their minor index.
+// \ingroup sparse_matrix
+//
+// \param indices Pointer to the first minor index of the row/column.
+// \param values Pointer to the first value of the row/column.
+// \param n The number of elements of the row/column.
+// \return void
+*/
+template< typename Type >  // Data type of the values
+void sortTripletSegment( size_t* indices, Type* values, size_t n )
+{
+   if( n <= 32UL )
+   {
+      for( size_t k=1UL; k<n; ++k ) {
+         const size_t index( indices[k] );
+         if( indices[k-1UL] <= index ) continue;
+         Type value( std::move( values[k] ) );
+         size_t l( k );
+         for( ; l>0UL && indices[l-1UL] > index; --l ) {
+            indices[l] = indices[l-1UL];
+            values[l]  = std::move( values[l-1UL] );
+         }
+         indices[l] = index;
+         values[l]  = std::move( value );
+      }
+   }
+   else
+   {
+      std::vector< std::pair<size_t,Type> > tmp;
+      tmp.reserve( n );
+      for( size_t k=0UL; k<n; ++k ) {
+         tmp.emplace_back( indices[k], std::move( values[k] ) );
+      }
+
+      std::stable_sort( tmp.begin(), tmp.end(),
+                        []( const std::pair<size_t,Type>& a, const std::pair<size_t,Type>& b ) {
+                           return a.first < b.first;
+                        } );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         indices[k] = tmp[k].first;
+         values[k]  = std::move( tmp[k].second );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorting of a set of (row, column, value) triplets.
+// \ingroup sparse_matrix
+//
+// \param first Iterator to the first triplet.
+// \param last Iterator one past the last triplet.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param combiner The binary operation for the combination of duplicate triplets.
+// \return The sorted triplets.
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function sorts the given triplets by row and column (row-major, \a SO = \a false) or by
+// column and row (column-major, \a SO = \a true) and combines all triplets with equal row and
+// column index by means of the given \a combiner. The triplets are accessed via \c std::get<0>
+// (row index), \c std::get<1> (column index) and \c std::get<2> (value). The function performs
+// a parallel counting sort on the major index, followed by a stable sort of the minor indices
+// of each row/column. Thus duplicates are combined in the order they appear in the given range
+// and the result does not depend on the number of threads. In case any of the triplets refers
+// to an element outside the \f$ m \times n \f$ matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< bool SO           // Storage order of the target matrix
+        , typename Type     // Data type of the values
+        , typename RandomIt // Type of the triplet iterator
+        , typename OP >     // Type of the combiner
+SortedTriplets<Type> sortTriplets( RandomIt first, RandomIt last, size_t m, size_t n, OP combiner )
+{
+   const size_t N( static_cast<size_t>( std::distance( first, last ) ) );
+   const size_t M( SO ? n : m );
+   const size_t K( SO ? m : n );
+
+   const size_t threads( ( N == 0UL || N < SMP_SMATTRIPLETS_THRESHOLD )
+                         ?( 1UL )
+                         :( min( getNumThreads(), N ) ) );
+
+   const auto major = [first]( size_t k ) {
+      return static_cast<size_t>( SO ? std::get<1>( first[k] ) : std::get<0>( first[k] ) );
+   };
+
+   const auto minor = [first]( size_t k ) {
+      return static_cast<size_t>( SO ? std::get<0>( first[k] ) : std::get<1>( first[k] ) );
+   };
+
+   SortedTriplets<Type> result;
+   result.offsets.resize( M+1UL, 0UL );
+   result.nonzeros.resize( M, 0UL );
+   result.partition.resize( threads+1UL, M );
+   result.partition[0UL] = 0UL;
+   result.indices.reset( allocate<size_t>( N ) );
+   result.values.reset( allocate<Type>( N ) );
+
+   std::unique_ptr<size_t[],Deallocate> counts( allocate<size_t>( threads*M ) );
+   std::vector<char> invalid( threads, 0 );
+
+   // Counting the elements per row/column of each chunk of triplets
+   smpFor( threads, [&]( size_t t )
+   {
+      size_t* const count( counts.get() + t*M );
+      std::fill( count, count+M, 0UL );
+
+      for( size_t k=t*N/threads; k<(t+1UL)*N/threads; ++k ) {
+         const size_t i( major( k ) );
+         if( i >= M || minor( k ) >= K ) {
+            invalid[t] = 1;
+            continue;
+         }
+         ++count[i];
+      }
+   } );
+
+   if( std::find( invalid.begin(), invalid.end(), 1 ) != invalid.end() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid triplet index" );
+   }
+
+   // Computing the starting position of each chunk within each row/column
+   smpFor( threads, [&]( size_t t )
+   {
+      for( size_t i=t*M/threads; i<(t+1UL)*M/threads; ++i ) {
+         size_t sum( 0UL );
+         for( size_t l=0UL; l<threads; ++l ) {
+            const size_t tmp( counts[l*M+i] );
+            counts[l*M+i] = sum;
+            sum += tmp;
+         }
+         result.offsets[i+1UL] = sum;
+      }
+   } );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      result.offsets[i+1UL] += result.offsets[i];
+   }
+
+   // Scattering the triplets into their rows/columns
+   smpFor( threads, [&]( size_t t )
+   {
+      size_t* const count( counts.get() + t*M );
+
+      for( size_t k=t*N/threads; k<(t+1UL)*N/threads; ++k ) {
+         const size_t i( major( k ) );
+         const size_t pos( result.offsets[i] + count[i]++ );
+         result.indices[pos] = minor( k );
+         result.values[pos]  = std::get<2>( first[k] );
+      }
+   } );
+
+   counts.reset();
+
+   // Partitioning the rows/columns into chunks with a similar number of elements
+   for( size_t t=1UL; t<threads; ++t ) {
+      const auto pos( std::upper_bound( result.offsets.begin(), result.offsets.end(), t*N/threads ) );
+      result.partition[t] = max( result.partition[t-1UL],
+                                 static_cast<size_t>( pos - result.offsets.begin() ) - 1UL );
+   }
+
+   // Sorting each row/column and combining duplicate elements
+   smpFor( threads, [&]( size_t t )
+   {
+      for( size_t i=result.partition[t]; i<result.partition[t+1UL]; ++i )
+      {
+         size_t* const indices( result.indices.get() + result.offsets[i] );
+         Type*   const values ( result.values.get()  + result.offsets[i] );
+         const size_t size( result.offsets[i+1UL] - result.offsets[i] );
+
+         if( size == 0UL ) continue;
+
+         sortTripletSegment( indices, values, size );
+
+         size_t last( 0UL );
+         for( size_t k=1UL; k<size; ++k ) {
+            if( indices[k] == indices[last] ) {
+               values[last] = combiner( values[last], values[k] );
+            }
+            else if( ++last != k ) {
+               indices[last] = indices[k];
+               values[last]  = std::move( values[k] );
+            }
+         }
+
+         result.nonzeros[i] = last + 1UL;
+      }
+   } );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
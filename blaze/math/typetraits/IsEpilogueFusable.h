@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsEpilogueFusable.h
+//  \brief Header file for the IsEpilogueFusable type trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISEPILOGUEFUSABLE_H_
+#define _BLAZE_MATH_TYPETRAITS_ISEPILOGUEFUSABLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for expressions with a fusable epilogue.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the given data type is a dense matrix expression that can be
+// assigned by means of a single matrix multiplication kernel with fused bias and epilogue
+// operations, i.e. whether the element-wise operations following the multiplication (as for
+// instance the addition of a bias matrix or a custom map operation) can be applied during the
+// write-back of the multiplication kernel instead of in a separate pass over the target. Such
+// expressions provide an \c epilogueAssign() function, which is called with the target matrix,
+// the expression, a bias operation \c bias(i,j), and an epilogue operation
+// \c epilogue(i,j,value). In case the expression is fusable, the
+// \a value member constant is set to \a true, the nested type definition \a Type is
+// \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to \a false,
+// \a Type is \a FalseType, and the class derives from \a FalseType. Examples:
+
+   \code
+   using blaze::DynamicMatrix;
+
+   using MT = DynamicMatrix<double>;
+   using MultType = decltype( std::declval<MT>() * std::declval<MT>() );
+   using AddType  = decltype( std::declval<MultType>() + std::declval<MT>() );
+
+   blaze::IsEpilogueFusable< MultType >::value       // Evaluates to 1
+   blaze::IsEpilogueFusable< const AddType >::Type   // Results in TrueType
+   blaze::IsEpilogueFusable< MT >::value             // Evaluates to 0
+   blaze::IsEpilogueFusable< const MT >::Type        // Results in FalseType
+   \endcode
+*/
+template< typename T >
+struct IsEpilogueFusable
+   : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsEpilogueFusable type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsEpilogueFusable< const T >
+   : public IsEpilogueFusable<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsEpilogueFusable type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsEpilogueFusable< volatile T >
+   : public IsEpilogueFusable<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsEpilogueFusable type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsEpilogueFusable< const volatile T >
+   : public IsEpilogueFusable<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary variable template for the IsEpilogueFusable type trait.
+// \ingroup type_traits
+//
+// The IsEpilogueFusable_v variable template provides a convenient shortcut to access the nested \a value
+// of the IsEpilogueFusable class template. For instance, given the type \a T the following two statements
+// are identical:
+
+   \code
+   constexpr bool value1 = blaze::IsEpilogueFusable<T>::value;
+   constexpr bool value2 = blaze::IsEpilogueFusable_v<T>;
+   \endcode
+*/
+template< typename T >
+constexpr bool IsEpilogueFusable_v = IsEpilogueFusable<T>::value;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -62,6 +62,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/ColumnIndex.h>
 #include <blaze/math/sparse/SparseElement.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -2268,6 +2269,8 @@ class Column<MT,false,false,false,CCAs...>
          , row_   ( 0UL )      // The current row index
          , column_( 0UL )      // The current column index
          , pos_   ()           // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {}
       //*******************************************************************************************
 
@@ -2283,10 +2286,22 @@ class Column<MT,false,false,false,CCAs...>
          , row_   ( row     )  // The current row index
          , column_( column  )  // The current column index
          , pos_   ()           // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {
-         for( ; row_<matrix_->rows(); ++row_ ) {
-            pos_ = matrix_->find( row_, column_ );
-            if( pos_ != matrix_->end( row_ ) ) break;
+         // End iterators only use an up-to-date column index and never trigger a rebuild
+         const ColumnIndex* index( getColumnIndex( matrix, row < matrix.rows() ) );
+
+         if( index != nullptr ) {
+            entry_ = index->lowerBound( column_, row_ );
+            last_  = index->end( column_ );
+            update();
+         }
+         else {
+            for( ; row_<matrix_->rows(); ++row_ ) {
+               pos_ = matrix_->find( row_, column_ );
+               if( pos_ != matrix_->end( row_ ) ) break;
+            }
          }
       }
       //*******************************************************************************************
@@ -2304,8 +2319,19 @@ class Column<MT,false,false,false,CCAs...>
          , row_   ( row     )  // The current row index
          , column_( column  )  // The current column index
          , pos_   ( pos     )  // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {
          BLAZE_INTERNAL_ASSERT( matrix.find( row, column ) == pos, "Invalid initial iterator position" );
+
+         const ColumnIndex* index( getColumnIndex( matrix, false ) );
+
+         if( index != nullptr ) {
+            entry_ = index->lowerBound( column_, row_ );
+            last_  = index->end( column_ );
+            BLAZE_INTERNAL_ASSERT( entry_ != last_ && entry_->row == row_,
+                                   "Invalid column index detected" );
+         }
       }
       //*******************************************************************************************
 
@@ -2320,6 +2346,8 @@ class Column<MT,false,false,false,CCAs...>
          , row_   ( it.row_    )  // The current row index
          , column_( it.column_ )  // The current column index
          , pos_   ( it.pos_    )  // Iterator to the current sparse element
+         , entry_ ( it.entry_  )  // The current entry of the column index
+         , last_  ( it.last_   )  // The end of the column in the column index
       {}
       //*******************************************************************************************
 
@@ -2329,10 +2357,16 @@ class Column<MT,false,false,false,CCAs...>
       // \return Reference to the incremented iterator.
       */
       inline ColumnIterator& operator++() {
-         ++row_;
-         for( ; row_<matrix_->rows(); ++row_ ) {
-            pos_ = matrix_->find( row_, column_ );
-            if( pos_ != matrix_->end( row_ ) ) break;
+         if( entry_ != nullptr ) {
+            ++entry_;
+            update();
+         }
+         else {
+            ++row_;
+            for( ; row_<matrix_->rows(); ++row_ ) {
+               pos_ = matrix_->find( row_, column_ );
+               if( pos_ != matrix_->end( row_ ) ) break;
+            }
          }
 
          return *this;
@@ -2402,6 +2436,10 @@ class Column<MT,false,false,false,CCAs...>
       // \return The number of elements between the two column iterators.
       */
       inline DifferenceType operator-( const ColumnIterator& rhs ) const {
+         if( entry_ != nullptr && rhs.entry_ != nullptr ) {
+            return entry_ - rhs.entry_;
+         }
+
          size_t counter( 0UL );
          for( size_t i=rhs.row_; i<row_; ++i ) {
             if( matrix_->find( i, column_ ) != matrix_->end( i ) )
@@ -2412,11 +2450,31 @@ class Column<MT,false,false,false,CCAs...>
       //*******************************************************************************************
 
     private:
+      //**Update function**************************************************************************
+      /*!\brief Moves the iterator to the current entry of the column index.
+      //
+      // \return void
+      */
+      inline void update() {
+         if( entry_ != last_ ) {
+            row_ = entry_->row;
+            pos_ = matrix_->find( row_, column_ );
+            BLAZE_INTERNAL_ASSERT( pos_ != matrix_->end( row_ ), "Invalid column index detected" );
+         }
+         else {
+            row_ = matrix_->rows();
+         }
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       MatrixType*  matrix_;  //!< The sparse matrix containing the column.
       size_t       row_;     //!< The current row index.
       size_t       column_;  //!< The current column index.
       IteratorType pos_;     //!< Iterator to the current sparse element.
+
+      const ColumnIndex::Entry* entry_;  //!< The current entry of the column index.
+      const ColumnIndex::Entry* last_;   //!< The end of the column in the column index.
       //*******************************************************************************************
 
       //**Friend declarations**********************************************************************
@@ -3543,6 +3601,13 @@ inline typename Column<MT,false,false,false,CCAs...>::Iterator
    if( row == size() )
       return pos;
 
+   if( pos.entry_ != nullptr ) {
+      Iterator next( pos );
+      ++next;
+      matrix_.erase( row, pos.pos_ );
+      return next;
+   }
+
    matrix_.erase( row, pos.pos_ );
    return Iterator( matrix_, row+1UL, column() );
 }
@@ -3603,7 +3668,9 @@ template< typename Pred     // Type of the unary predicate
         , typename >        // Type restriction on the unary predicate
 inline void Column<MT,false,false,false,CCAs...>::erase( Pred predicate )
 {
-   for( Iterator element=begin(); element!=end(); ++element ) {
+   const Iterator last( end() );
+
+   for( Iterator element=begin(); element!=last; ++element ) {
       if( predicate( element->value() ) )
          matrix_.erase( element.row_, element.pos_ );
    }
@@ -3738,15 +3805,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Column<MT,false,false,false,CCAs...>::Iterator
    Column<MT,false,false,false,CCAs...>::lowerBound( size_t index )
 {
-   for( size_t i=index; i<size(); ++i )
-   {
-      const Iterator_t<MT> pos( matrix_.find( i, column() ) );
-
-      if( pos != matrix_.end( i ) )
-         return Iterator( matrix_, i, column(), pos );
-   }
-
-   return end();
+   return Iterator( matrix_, index, column() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3770,15 +3829,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Column<MT,false,false,false,CCAs...>::ConstIterator
    Column<MT,false,false,false,CCAs...>::lowerBound( size_t index ) const
 {
-   for( size_t i=index; i<size(); ++i )
-   {
-      const ConstIterator_t<MT> pos( matrix_.find( i, column() ) );
-
-      if( pos != matrix_.end( i ) )
-         return ConstIterator( matrix_, i, column(), pos );
-   }
-
-   return end();
+   return ConstIterator( matrix_, index, column() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3802,15 +3853,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Column<MT,false,false,false,CCAs...>::Iterator
    Column<MT,false,false,false,CCAs...>::upperBound( size_t index )
 {
-   for( size_t i=index+1UL; i<size(); ++i )
-   {
-      const Iterator_t<MT> pos( matrix_.find( i, column() ) );
-
-      if( pos != matrix_.end( i ) )
-         return Iterator( matrix_, i, column(), pos );
-   }
-
-   return end();
+   return Iterator( matrix_, index+1UL, column() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3834,15 +3877,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Column<MT,false,false,false,CCAs...>::ConstIterator
    Column<MT,false,false,false,CCAs...>::upperBound( size_t index ) const
 {
-   for( size_t i=index+1UL; i<size(); ++i )
-   {
-      const ConstIterator_t<MT> pos( matrix_.find( i, column() ) );
-
-      if( pos != matrix_.end( i ) )
-         return ConstIterator( matrix_, i, column(), pos );
-   }
-
-   return end();
+   return ConstIterator( matrix_, index+1UL, column() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -60,6 +60,7 @@
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/ColumnIndex.h>
 #include <blaze/math/sparse/SparseElement.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
@@ -2422,6 +2423,8 @@ class Columns<MT,false,false,false,CCAs...>
          , row_   ( 0UL )      // The current row index
          , column_( 0UL )      // The current column index
          , pos_   ()           // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {}
       //*******************************************************************************************
 
@@ -2437,10 +2440,22 @@ class Columns<MT,false,false,false,CCAs...>
          , row_   ( row     )  // The current row index
          , column_( column  )  // The current column index
          , pos_   ()           // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {
-         for( ; row_<matrix_->rows(); ++row_ ) {
-            pos_ = matrix_->find( row_, column_ );
-            if( pos_ != matrix_->end( row_ ) ) break;
+         // End iterators only use an up-to-date column index and never trigger a rebuild
+         const ColumnIndex* index( getColumnIndex( matrix, row < matrix.rows() ) );
+
+         if( index != nullptr ) {
+            entry_ = index->lowerBound( column_, row_ );
+            last_  = index->end( column_ );
+            update();
+         }
+         else {
+            for( ; row_<matrix_->rows(); ++row_ ) {
+               pos_ = matrix_->find( row_, column_ );
+               if( pos_ != matrix_->end( row_ ) ) break;
+            }
          }
       }
       //*******************************************************************************************
@@ -2458,8 +2473,19 @@ class Columns<MT,false,false,false,CCAs...>
          , row_   ( row     )  // The current row index
          , column_( column  )  // The current column index
          , pos_   ( pos     )  // Iterator to the current sparse element
+         , entry_ ( nullptr )  // The current entry of the column index
+         , last_  ( nullptr )  // The end of the column in the column index
       {
          BLAZE_INTERNAL_ASSERT( matrix.find( row, column ) == pos, "Invalid initial iterator position" );
+
+         const ColumnIndex* index( getColumnIndex( matrix, false ) );
+
+         if( index != nullptr ) {
+            entry_ = index->lowerBound( column_, row_ );
+            last_  = index->end( column_ );
+            BLAZE_INTERNAL_ASSERT( entry_ != last_ && entry_->row == row_,
+                                   "Invalid column index detected" );
+         }
       }
       //*******************************************************************************************
 
@@ -2474,6 +2500,8 @@ class Columns<MT,false,false,false,CCAs...>
          , row_   ( it.row_    )  // The current row index
          , column_( it.column_ )  // The current column index
          , pos_   ( it.pos_    )  // Iterator to the current sparse element
+         , entry_ ( it.entry_  )  // The current entry of the column index
+         , last_  ( it.last_   )  // The end of the column in the column index
       {}
       //*******************************************************************************************
 
@@ -2483,10 +2511,16 @@ class Columns<MT,false,false,false,CCAs...>
       // \return Reference to the incremented iterator.
       */
       inline ColumnsIterator& operator++() {
-         ++row_;
-         for( ; row_<matrix_->rows(); ++row_ ) {
-            pos_ = matrix_->find( row_, column_ );
-            if( pos_ != matrix_->end( row_ ) ) break;
+         if( entry_ != nullptr ) {
+            ++entry_;
+            update();
+         }
+         else {
+            ++row_;
+            for( ; row_<matrix_->rows(); ++row_ ) {
+               pos_ = matrix_->find( row_, column_ );
+               if( pos_ != matrix_->end( row_ ) ) break;
+            }
          }
 
          return *this;
@@ -2556,6 +2590,10 @@ class Columns<MT,false,false,false,CCAs...>
       // \return The number of elements between the two column iterators.
       */
       inline DifferenceType operator-( const ColumnsIterator& rhs ) const {
+         if( entry_ != nullptr && rhs.entry_ != nullptr ) {
+            return entry_ - rhs.entry_;
+         }
+
          size_t counter( 0UL );
          for( size_t i=rhs.row_; i<row_; ++i ) {
             if( matrix_->find( i, column_ ) != matrix_->end( i ) )
@@ -2566,11 +2604,31 @@ class Columns<MT,false,false,false,CCAs...>
       //*******************************************************************************************
 
     private:
+      //**Update function**************************************************************************
+      /*!\brief Moves the iterator to the current entry of the column index.
+      //
+      // \return void
+      */
+      inline void update() {
+         if( entry_ != last_ ) {
+            row_ = entry_->row;
+            pos_ = matrix_->find( row_, column_ );
+            BLAZE_INTERNAL_ASSERT( pos_ != matrix_->end( row_ ), "Invalid column index detected" );
+         }
+         else {
+            row_ = matrix_->rows();
+         }
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       MatrixType*  matrix_;  //!< The sparse matrix containing the selected column.
       size_t       row_;     //!< The current row index.
       size_t       column_;  //!< The current column index.
       IteratorType pos_;     //!< Iterator to the current sparse element.
+
+      const ColumnIndex::Entry* entry_;  //!< The current entry of the column index.
+      const ColumnIndex::Entry* last_;   //!< The end of the column in the column index.
       //*******************************************************************************************
 
       //**Friend declarations**********************************************************************
@@ -3893,6 +3951,13 @@ inline typename Columns<MT,false,false,false,CCAs...>::Iterator
    if( row == rows() )
       return pos;
 
+   if( pos.entry_ != nullptr ) {
+      Iterator next( pos );
+      ++next;
+      matrix_.erase( row, pos.pos_ );
+      return next;
+   }
+
    matrix_.erase( row, pos.pos_ );
    return Iterator( matrix_, row+1UL, idx(j) );
 }
@@ -3959,7 +4024,8 @@ template< typename Pred >   // Type of the unary predicate
 inline void Columns<MT,false,false,false,CCAs...>::erase( Pred predicate )
 {
    for( size_t j=0UL; j<columns(); ++j ) {
-      for( Iterator element=begin(j); element!=end(j); ++element ) {
+      const Iterator last( end(j) );
+      for( Iterator element=begin(j); element!=last; ++element ) {
          if( predicate( element->value() ) )
             matrix_.erase( element.row_, element.pos_ );
       }
@@ -4105,17 +4171,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Columns<MT,false,false,false,CCAs...>::Iterator
    Columns<MT,false,false,false,CCAs...>::lowerBound( size_t i, size_t j )
 {
-   const size_t index( idx(j) );
-
-   for( ; i<rows(); ++i )
-   {
-      const Iterator_t<MT> pos( matrix_.find( i, index ) );
-
-      if( pos != matrix_.end( i ) )
-         return Iterator( matrix_, i, index, pos );
-   }
-
-   return end( j );
+   return Iterator( matrix_, i, idx(j) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4140,17 +4196,7 @@ template< typename MT       // Type of the sparse matrix
 inline typename Columns<MT,false,false,false,CCAs...>::ConstIterator
    Columns<MT,false,false,false,CCAs...>::lowerBound( size_t i, size_t j ) const
 {
-   const size_t index( idx(j) );
-
-   for( ; i<rows(); ++i )
-   {
-      const ConstIterator_t<MT> pos( matrix_.find( i, index ) );
-
-      if( pos != matrix_.end( i ) )
-         return ConstIterator( matrix_, i, index, pos );
-   }
-
-   return end( j );
+   return ConstIterator( matrix_, i, idx(j) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -54,6 +54,7 @@
 #include <blaze/math/constraints/TransExpr.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/dense/InitializerMatrix.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/View.h>
@@ -68,10 +69,12 @@
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -109,6 +112,7 @@
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsReference.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/Unused.h>
 
 
@@ -713,6 +717,16 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
         IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+        IsContiguous_v<MT2> && HasConstDataAccess_v<MT2> &&
+        IsSame_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -784,7 +798,12 @@ class Submatrix<MT,unaligned,false,true,CSAs...>
    template< typename MT2 >
    inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< TransposeAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< TransposeAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -2690,7 +2709,8 @@ inline auto Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+inline auto Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -2715,6 +2735,35 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose kernel based implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( data(), spacing(), (~rhs).data(), (~rhs).spacing(), columns(), rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -3994,6 +4043,16 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
         IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+        IsContiguous_v<MT2> && HasConstDataAccess_v<MT2> &&
+        IsSame_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -4065,7 +4124,12 @@ class Submatrix<MT,unaligned,true,true,CSAs...>
    template< typename MT2 >
    inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> DisableIf_t< TransposeAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< TransposeAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -5927,7 +5991,8 @@ inline auto Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline auto Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -5952,6 +6017,35 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose kernel based implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( data(), spacing(), (~rhs).data(), (~rhs).spacing(), rows(), columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -6820,6 +6914,16 @@ class Submatrix<MT,aligned,false,true,CSAs...>
         IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+        IsContiguous_v<MT2> && HasConstDataAccess_v<MT2> &&
+        IsSame_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -6891,7 +6995,12 @@ class Submatrix<MT,aligned,false,true,CSAs...>
    template< typename MT2 >
    inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&  rhs );
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< TransposeAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< TransposeAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>& rhs );
 
@@ -8787,7 +8896,8 @@ inline auto Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+inline auto Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -8812,6 +8922,35 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose kernel based implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( data(), spacing(), (~rhs).data(), (~rhs).spacing(), columns(), rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
@@ -9679,6 +9818,16 @@ class Submatrix<MT,aligned,true,true,CSAs...>
         IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool TransposeAssign_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+        IsContiguous_v<MT2> && HasConstDataAccess_v<MT2> &&
+        IsSame_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT2 >
@@ -9750,7 +9899,12 @@ class Submatrix<MT,aligned,true,true,CSAs...>
    template< typename MT2 >
    inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> DisableIf_t< TransposeAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< TransposeAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
@@ -11602,7 +11756,8 @@ inline auto Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time submatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline auto Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> DisableIf_t< TransposeAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
 
@@ -11627,6 +11782,35 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transpose kernel based implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time submatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< TransposeAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dmattrans( data(), spacing(), (~rhs).data(), (~rhs).spacing(), rows(), columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -246,6 +246,31 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Narrow matrix multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_NARROW_MMM_THRESHOLD while the Blaze debug
+// mode is active. It specifies the maximum number of columns of a row-major dense matrix,
+// which is multiplied with a row-major dense or sparse matrix, for which the specialized
+// narrow matrix multiplication kernels are used.
+*/
+constexpr size_t NARROW_MMM_DEBUG_THRESHOLD = 8UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Strassen-Winograd matrix multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_STRASSEN_THRESHOLD while the Blaze debug mode
+// is active. It specifies the minimum size of all dimensions of a dense matrix/dense matrix
+// multiplication for a recursion step of the Strassen-Winograd algorithm.
+*/
+constexpr size_t STRASSEN_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
@@ -260,6 +285,8 @@ constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DE
 constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
 constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
 constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+constexpr size_t NARROW_MMM_THRESHOLD     = ( BLAZE_DEBUG_MODE ? NARROW_MMM_DEBUG_THRESHOLD     : BLAZE_NARROW_MMM_THRESHOLD     );
+constexpr size_t STRASSEN_THRESHOLD       = ( BLAZE_DEBUG_MODE ? STRASSEN_DEBUG_THRESHOLD       : BLAZE_STRASSEN_THRESHOLD       );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -967,6 +994,92 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix triplet construction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRIPLETS_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the construction of a sparse matrix from a set of
+// triplets can be executed in parallel. In case the number of triplets is larger or equal to
+// this threshold, the operation is executed in parallel. If the number of triplets is below
+// this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATTRIPLETS_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRANSPOSE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the assignment of a sparse matrix to a compressed
+// matrix with opposite storage order can be executed in parallel. In case the number of non-zero
+// elements is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATTRANSPOSE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse pattern operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SPARSEPATTERN_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a sparse matrix operation with precomputed sparsity
+// pattern can be executed in parallel. In case the number of scalar operations is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of operations
+// is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SPARSEPATTERN_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP SELL matrix/dense vector multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SELLDVECMULT_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a SELL matrix/dense vector multiplication can be
+// executed in parallel. In case the number of stored elements of the SELL matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of stored
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SELLDVECMULT_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP block-sparse matrix multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_BLOCKMATMULT_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a multiplication between a block-sparse matrix and a
+// dense vector or a dense matrix can be executed in parallel. In case the number of scalar
+// multiplications is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of scalar multiplications is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_BLOCKMATMULT_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP half-storage symmetric sparse matrix/dense vector multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SYMDVECMULT_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a multiplication between a half-storage symmetric sparse
+// matrix and a dense vector can be executed in parallel. In case the number of stored elements
+// of the matrix is larger or equal to this threshold, the operation is executed in parallel. If
+// the number of stored elements is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_SYMDVECMULT_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
@@ -1018,6 +1131,12 @@ constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSM
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
 constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_SMATTRIPLETS_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTRIPLETS_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTRIPLETS_THRESHOLD   );
+constexpr size_t SMP_SMATTRANSPOSE_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTRANSPOSE_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTRANSPOSE_THRESHOLD  );
+constexpr size_t SMP_SPARSEPATTERN_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SPARSEPATTERN_DEBUG_THRESHOLD  : BLAZE_SMP_SPARSEPATTERN_THRESHOLD  );
+constexpr size_t SMP_SELLDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SELLDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SELLDVECMULT_THRESHOLD   );
+constexpr size_t SMP_BLOCKMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_BLOCKMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_BLOCKMATMULT_THRESHOLD   );
+constexpr size_t SMP_SYMDVECMULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SYMDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SYMDVECMULT_THRESHOLD    );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1044,6 +1163,8 @@ BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
 BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::NARROW_MMM_THRESHOLD     > 0UL );
+BLAZE_STATIC_ASSERT( blaze::STRASSEN_THRESHOLD       > 1UL );
 
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
@@ -1094,6 +1215,12 @@ BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRIPLETS_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRANSPOSE_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SPARSEPATTERN_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SELLDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BLOCKMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SYMDVECMULT_THRESHOLD    >= 0UL );
 
 }
 /*! \endcond */
@@ -57,6 +57,7 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double cg( size_t N, size_t steps, size_t iterations );
+double cgsolver( size_t N, size_t steps, size_t iterations );
 //@}
 //*************************************************************************************************
 
@@ -41,6 +41,7 @@
 #include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/CG.h>
 #include <blazemark/blaze/init/DynamicVector.h>
@@ -65,7 +66,8 @@ namespace blaze {
 // \return Minimum runtime of the kernel function.
 //
 // This kernel function implements the conjugate gradient method by means of the Blaze
-// functionality.
+// functionality. The updates of the solution and the residual as well as the computation of
+// the squared residual norm are performed in a single sweep via the fused assignments.
 */
 double cg( size_t N, size_t steps, size_t iterations )
 {
@@ -109,17 +111,14 @@ double cg( size_t N, size_t steps, size_t iterations )
       for( size_t step=0UL; step<steps; ++step )
       {
          x = start;
-         r = A * x - b;
-         delta = trans(r) * r;
+         delta = ::blaze::fusedAssign( ::blaze::SqrNorm(), r, A * x - b );
          d = -r;
 
          for( size_t iteration=0UL; iteration<iterations; ++iteration )
          {
             h = A * d;
             alpha = delta / ( trans(d) * h );
-            x += alpha * d;
-            r += alpha * h;
-            beta = trans(r) * r;
+            beta = ::blaze::fusedAddAssign( ::blaze::SqrNorm(), r, alpha * h, x, alpha * d );
             d = ( beta / delta ) * d - r;
             delta = beta;
          }
@@ -143,6 +142,85 @@ double cg( size_t N, size_t steps, size_t iterations )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Blaze conjugate gradient solver kernel.
+//
+// \param N The number of rows and columns of the 2D discretized grid.
+// \param steps The number of solving steps to perform.
+// \param iterations The number of iterations to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function solves the same system as the conjugate gradient kernel by means of
+// the built-in cg() solver. In order to perform exactly \a iterations iterations, the solver
+// is run with a tolerance of zero.
+*/
+double cgsolver( size_t N, size_t steps, size_t iterations )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   const size_t NN( N*N );
+
+   std::vector<size_t> nnz( NN, 5UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i == 0UL || i == N-1UL ) --nnz[i*N+j];
+         if( j == 0UL || j == N-1UL ) --nnz[i*N+j];
+      }
+   }
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), start( NN );
+   ::blaze::SolverSettings settings;
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i > 0UL   ) A.append( i*N+j, (i-1UL)*N+j, -1.0 );  // Top neighbor
+         if( j > 0UL   ) A.append( i*N+j, i*N+j-1UL  , -1.0 );  // Left neighbor
+         A.append( i*N+j, i*N+j, 4.0 );
+         if( j < N-1UL ) A.append( i*N+j, i*N+j+1UL  , -1.0 );  // Right neighbor
+         if( i < N-1UL ) A.append( i*N+j, (i+1UL)*N+j, -1.0 );  // Bottom neighbor
+      }
+   }
+
+   init( start );
+   b = A * start;
+
+   settings.maxIterations = iterations;
+   settings.tolerance     = 0.0;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step )
+      {
+         reset( x );
+         ::blaze::cg( A, x, b, settings );
+      }
+      timer.end();
+
+      if( x.size() != NN )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'cgsolver': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 } // namespace blazemark
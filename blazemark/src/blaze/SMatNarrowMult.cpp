@@ -0,0 +1,134 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/SMatNarrowMult.cpp
+//  \brief Source file for the Blaze sparse matrix/narrow dense matrix multiplication kernel
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/SMatNarrowMult.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze sparse matrix/narrow dense matrix multiplication kernel.
+//
+// \param N The number of rows and columns of the 2D discretized grid.
+// \param K The number of columns of the dense matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the multiplication of the 5-point Laplacian of a 2D grid
+// with a row-major dense matrix of \a K columns (as for instance in block Krylov methods or
+// multi-vector products) by means of the Blaze functionality.
+*/
+double smatnarrowmult( size_t N, size_t K, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   const size_t NN( N*N );
+
+   std::vector<size_t> nnz( NN, 5UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i == 0UL || i == N-1UL ) --nnz[i*N+j];
+         if( j == 0UL || j == N-1UL ) --nnz[i*N+j];
+      }
+   }
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::DynamicMatrix<element_t,rowMajor> B( NN, K ), C( NN, K );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i > 0UL   ) A.append( i*N+j, (i-1UL)*N+j, -1.0 );  // Top neighbor
+         if( j > 0UL   ) A.append( i*N+j, i*N+j-1UL  , -1.0 );  // Left neighbor
+         A.append( i*N+j, i*N+j, 4.0 );
+         if( j < N-1UL ) A.append( i*N+j, i*N+j+1UL  , -1.0 );  // Right neighbor
+         if( i < N-1UL ) A.append( i*N+j, (i+1UL)*N+j, -1.0 );  // Bottom neighbor
+      }
+   }
+
+   init( B );
+
+   C = A * B;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         C = A * B;
+      }
+      timer.end();
+
+      if( C.rows() != NN )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'smatnarrowmult': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -0,0 +1,228 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/SMatTriplets.cpp
+//  \brief Source file for the Blaze sparse matrix triplet assembly kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/SMatTriplets.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of a single (row, column, value) triplet.
+*/
+using Triplet = std::tuple<size_t,size_t,element_t>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the triplets of a 2D bilinear finite element discretization.
+//
+// \param N The number of elements in each dimension of the 2D grid.
+// \return The element triplets in random element order.
+//
+// This function creates the 16 triplets of the element stiffness matrix of each of the
+// \f$ N \times N \f$ bilinear quadrilateral elements of a 2D grid. The elements are processed
+// in random order, resulting in an unsorted set of triplets with many duplicates.
+*/
+std::vector<Triplet> setupTriplets( size_t N )
+{
+   static const element_t stiffness[4][4] = { {  4.0, -1.0, -2.0, -1.0 },
+                                              { -1.0,  4.0, -1.0, -2.0 },
+                                              { -2.0, -1.0,  4.0, -1.0 },
+                                              { -1.0, -2.0, -1.0,  4.0 } };
+
+   std::vector<size_t> elements( N*N );
+   for( size_t e=0UL; e<N*N; ++e ) {
+      elements[e] = e;
+   }
+
+   std::shuffle( elements.begin(), elements.end(), std::mt19937( seed ) );
+
+   std::vector<Triplet> triplets;
+   triplets.reserve( 16UL*N*N );
+
+   for( size_t e : elements )
+   {
+      const size_t i( e / N );
+      const size_t j( e % N );
+      const size_t nodes[4] = { i*(N+1UL)+j, i*(N+1UL)+j+1UL, (i+1UL)*(N+1UL)+j+1UL, (i+1UL)*(N+1UL)+j };
+
+      for( size_t k=0UL; k<4UL; ++k ) {
+         for( size_t l=0UL; l<4UL; ++l ) {
+            triplets.emplace_back( nodes[k], nodes[l], stiffness[k][l] / 6.0 );
+         }
+      }
+   }
+
+   return triplets;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze sparse matrix triplet assembly kernel.
+//
+// \param N The number of elements in each dimension of the 2D grid.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the assembly of the stiffness matrix of a 2D bilinear finite
+// element discretization from unsorted triplets by means of the setFromTriplets() function of
+// the Blaze CompressedMatrix.
+*/
+double smattriplets( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   const size_t NN( (N+1UL)*(N+1UL) );
+
+   const std::vector<Triplet> triplets( setupTriplets( N ) );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN );
+   ::blaze::timing::WcTimer timer;
+
+   A.setFromTriplets( triplets.begin(), triplets.end() );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         A.setFromTriplets( triplets.begin(), triplets.end() );
+      }
+      timer.end();
+
+      if( A.nonZeros() != 9UL*NN - 12UL*(N+1UL) + 4UL )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'smattriplets': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze sparse matrix element-wise insertion kernel.
+//
+// \param N The number of elements in each dimension of the 2D grid.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the assembly of the stiffness matrix of a 2D bilinear finite
+// element discretization from unsorted triplets by means of the element-wise insertion into a
+// Blaze CompressedMatrix. The capacity of each row is preallocated for the nine non-zero
+// elements of the 9-point stencil.
+*/
+double smatinsert( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   const size_t NN( (N+1UL)*(N+1UL) );
+
+   const std::vector<Triplet> triplets( setupTriplets( N ) );
+
+   const std::vector<size_t> nonzeros( NN, 9UL );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         A = ::blaze::CompressedMatrix<element_t,rowMajor>( NN, NN, nonzeros );
+         for( const Triplet& t : triplets ) {
+            A(std::get<0>(t),std::get<1>(t)) += std::get<2>(t);
+         }
+      }
+      timer.end();
+
+      if( A.nonZeros() != 9UL*NN - 12UL*(N+1UL) + 4UL )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'smatinsert': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
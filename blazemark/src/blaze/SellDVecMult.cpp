@@ -0,0 +1,176 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/SellDVecMult.cpp
+//  \brief Source file for the Blaze SELL matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SellMatrix.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/CompressedMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/blaze/SellDVecMult.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze SELL matrix/dense vector multiplication kernel.
+//
+// \param N The number of rows and columns of the matrix and the size of the vector.
+// \param F The number of non-zero elements in each row of the sparse matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the SELL matrix/dense vector multiplication by means of the
+// Blaze SellMatrix class template. The matrix is set up as row-major compressed matrix and
+// converted into the SELL-C-sigma format prior to the time measurement.
+*/
+double selldvecmult( size_t N, size_t F, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
+   ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
+   ::blaze::timing::WcTimer timer;
+
+   init( A, F );
+   init( a );
+
+   const ::blaze::SellMatrix<element_t> S( A );
+
+   b = S * a;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = S * a;
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'selldvecmult': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze transpose SELL matrix/dense vector multiplication kernel.
+//
+// \param N The number of rows and columns of the matrix and the size of the vector.
+// \param F The number of non-zero elements in each row of the sparse matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the transpose SELL matrix/dense vector multiplication by
+// means of the Blaze SellMatrix class template. The matrix is set up as row-major compressed matrix and
+// converted into the SELL-C-sigma format prior to the time measurement.
+*/
+double tselldvecmult( size_t N, size_t F, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
+   ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
+   ::blaze::timing::WcTimer timer;
+
+   init( A, F );
+   init( a );
+
+   const ::blaze::SellMatrix<element_t> S( A );
+
+   b = trans( S ) * a;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = trans( S ) * a;
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'tselldvecmult': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
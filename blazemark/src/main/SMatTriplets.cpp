@@ -0,0 +1,260 @@
+//=================================================================================================
+/*!
+//  \file src/main/SMatTriplets.cpp
+//  \brief Source file for the sparse matrix triplet assembly benchmark
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/SMatTriplets.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/DynamicDenseRun.h>
+#include <blazemark/util/Parser.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::Benchmarks;
+using blazemark::DynamicDenseRun;
+using blazemark::Parser;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of a benchmark run.
+//
+// This type definition specifies the type of a single benchmark run for the sparse matrix
+// triplet assembly benchmark. The size of a run specifies the number of elements in each
+// dimension of the 2D grid.
+*/
+using Run = DynamicDenseRun;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Estimating the necessary number of steps for each benchmark.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the necessary number of steps for the given benchmark based on the
+// performance of the Blaze library.
+*/
+void estimateSteps( Run& run )
+{
+   const size_t N( run.getSize() );
+
+   size_t steps( 1UL );
+   double wct( 0.0 );
+
+   while( true ) {
+      wct = blazemark::blaze::smattriplets( N, steps );
+      if( wct >= 0.2 ) break;
+      steps *= 2UL;
+   }
+
+   const size_t estimatedSteps( ( blazemark::runtime * steps ) / wct );
+   run.setSteps( blaze::max( 1UL, estimatedSteps ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimating the number of processed triplets.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function sets the number of triplets processed by a single assembly as the number of
+// operations of the benchmark run.
+*/
+void estimateFlops( Run& run )
+{
+   const size_t N( run.getSize() );
+
+   run.setFlops( 16UL*N*N );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sparse matrix triplet assembly benchmark function.
+//
+// \param runs The specified benchmark runs.
+// \param benchmarks The selection of benchmarks.
+// \return void
+*/
+void smattriplets( std::vector<Run>& runs, Benchmarks benchmarks )
+{
+   std::cout << std::left;
+
+   std::sort( runs.begin(), runs.end() );
+
+   size_t slowSize( blaze::inf );
+   for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
+   {
+      estimateFlops( *run );
+
+      if( run->getSteps() == 0UL ) {
+         if( run->getSize() < slowSize ) {
+            estimateSteps( *run );
+            if( run->getSteps() == 1UL )
+               slowSize = run->getSize();
+         }
+         else run->setSteps( 1UL );
+      }
+   }
+
+   if( benchmarks.runBlaze ) {
+      std::cout << "   Blaze (setFromTriplets) [MTriplets/s]:\n";
+      for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
+         const size_t N    ( run->getSize()  );
+         const size_t steps( run->getSteps() );
+         run->setBlazeResult( blazemark::blaze::smattriplets( N, steps ) );
+         const double mtriplets( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
+         std::cout << "     " << std::setw(12) << N << mtriplets << std::endl;
+      }
+
+      std::cout << "   Blaze (insert) [MTriplets/s]:\n";
+      for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
+         const size_t N    ( run->getSize()  );
+         const size_t steps( run->getSteps() );
+         const double time ( blazemark::blaze::smatinsert( N, steps ) );
+         const double mtriplets( run->getFlops() * steps / time / 1E6 );
+         std::cout << "     " << std::setw(12) << N << mtriplets << std::endl;
+      }
+   }
+
+   for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
+      std::cout << *run;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the sparse matrix triplet assembly benchmark.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+*/
+int main( int argc, char** argv )
+{
+   std::cout << "\n Sparse Matrix Triplet Assembly:\n";
+
+   Benchmarks benchmarks;
+
+   try {
+      parseCommandLineArguments( argc, argv, benchmarks );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   const std::string installPath( INSTALL_PATH );
+   const std::string parameterFile( installPath + "/params/smattriplets.prm" );
+   Parser<Run> parser;
+   std::vector<Run> runs;
+
+   try {
+      parser.parse( parameterFile.c_str(), runs );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during parameter extraction: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   try {
+      smattriplets( runs, benchmarks );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
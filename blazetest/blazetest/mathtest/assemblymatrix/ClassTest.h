@@ -0,0 +1,440 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/assemblymatrix/ClassTest.h
+//  \brief Header file for the AssemblyMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ASSEMBLYMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_ASSEMBLYMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/AssemblyMatrix.h>
+#include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace assemblymatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the AssemblyMatrix class template.
+//
+// This class represents a test suite for the blaze::AssemblyMatrix class template. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testFunctionCall();
+   void testAt          ();
+   void testIterator    ();
+   void testReset       ();
+   void testClear       ();
+   void testReserve     ();
+   void testShrinkToFit ();
+   void testSwap        ();
+   void testSet         ();
+   void testInsert      ();
+   void testAdd         ();
+   void testErase       ();
+   void testFind        ();
+   void testLowerBound  ();
+   void testCompress    ();
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t index, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkValue( const Type& matrix, size_t i, size_t j, int expectedValue ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT  = blaze::AssemblyMatrix<int,blaze::rowMajor>;     //!< Type of the assembly matrix.
+   using OMT = blaze::AssemblyMatrix<int,blaze::columnMajor>;  //!< Opposite assembly matrix type.
+
+   using RMT  = MT::Rebind<double>::Other;   //!< Rebound assembly matrix type.
+   using ORMT = OMT::Rebind<double>::Other;  //!< Opposite rebound assembly matrix type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT::ResultType   );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( OMT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ORMT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT::ResultType   );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OMT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( RMT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( ORMT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType  , MT::ResultType::ElementType   );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OMT::ElementType , OMT::ResultType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType , RMT::ResultType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ORMT::ElementType, ORMT::ResultType::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType , double                        );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param minCapacity The expected minimum capacity of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given matrix. In case the actual capacity is smaller
+// than the given expected minimum capacity, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t minCapacity ) const
+{
+   if( matrix.capacity() < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << matrix.capacity() << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of a specific row/column of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The row/column to be checked.
+// \param minCapacity The expected minimum capacity of the specified row/column.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of a specific row/column of the given matrix. In case the
+// actual capacity is smaller than the given expected minimum capacity, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t index, size_t minCapacity ) const
+{
+   if( matrix.capacity( index ) < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected in row/column " << index << "\n"
+          << " Details:\n"
+          << "   Capacity                 : " << matrix.capacity( index ) << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( matrix.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( matrix.capacity() < matrix.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << matrix.nonZeros() << "\n"
+          << "   Capacity           : " << matrix.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements in a specific row/column of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The row/column to be checked.
+// \param expectedNonZeros The expected number of non-zero elements in the specified row/column.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements in the specified row/column of the
+// given matrix. In case the actual number of non-zero elements does not correspond to the
+// given expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const
+{
+   if( matrix.nonZeros( index ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements in row/column " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros( index ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( matrix.capacity( index ) < matrix.nonZeros( index ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected in row/column " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << matrix.nonZeros( index ) << "\n"
+          << "   Capacity           : " << matrix.capacity( index ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the value of a specific element of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param expectedValue The expected value of the element.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the value of the element \f$ (i,j) \f$ of the given matrix. In case
+// the actual value does not correspond to the given expected value, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkValue( const Type& matrix, size_t i, size_t j, int expectedValue ) const
+{
+   if( matrix(i,j) != expectedValue ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid value of element (" << i << "," << j << ")\n"
+          << " Details:\n"
+          << "   Value         : " << matrix(i,j) << "\n"
+          << "   Expected value: " << expectedValue << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the AssemblyMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the AssemblyMatrix class test.
+*/
+#define RUN_ASSEMBLYMATRIX_CLASS_TEST \
+   blazetest::mathtest::assemblymatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace assemblymatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
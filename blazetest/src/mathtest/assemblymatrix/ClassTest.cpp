@@ -0,0 +1,1367 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/assemblymatrix/ClassTest.cpp
+//  \brief Source file for the AssemblyMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/assemblymatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace assemblymatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AssemblyMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testReset();
+   testClear();
+   testReserve();
+   testShrinkToFit();
+   testSwap();
+   testSet();
+   testInsert();
+   testAdd();
+   testErase();
+   testFind();
+   testLowerBound();
+   testCompress();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the AssemblyMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the AssemblyMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major AssemblyMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major AssemblyMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major AssemblyMatrix size constructor (3x4,5)";
+
+      MT mat( 3UL, 4UL, 5UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 15UL );
+      checkCapacity( mat, 0UL, 5UL );
+      checkCapacity( mat, 1UL, 5UL );
+      checkCapacity( mat, 2UL, 5UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major AssemblyMatrix copy constructor";
+
+      MT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 0UL, 2 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 0UL, 2 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+   {
+      test_ = "Row-major AssemblyMatrix move constructor";
+
+      MT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      MT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major AssemblyMatrix default constructor";
+
+      OMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix size constructor (3x4)";
+
+      OMT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix size constructor (3x4,5)";
+
+      OMT mat( 3UL, 4UL, 5UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 20UL );
+      checkCapacity( mat, 0UL, 5UL );
+      checkCapacity( mat, 3UL, 5UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix copy constructor";
+
+      OMT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 0UL, 2 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      OMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 0UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 0UL, 2 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix move constructor";
+
+      OMT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      OMT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AssemblyMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major AssemblyMatrix copy assignment";
+
+      MT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      MT mat2( 2UL, 2UL );
+      mat2.set( 1UL, 1UL, 4 );
+
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+   {
+      test_ = "Row-major AssemblyMatrix move assignment";
+
+      MT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      MT mat2( 2UL, 2UL );
+      mat2.set( 1UL, 1UL, 4 );
+
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+
+   //=====================================================================================
+   // Column-major assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major AssemblyMatrix copy assignment";
+
+      OMT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      OMT mat2( 2UL, 2UL );
+      mat2.set( 1UL, 1UL, 4 );
+
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix move assignment";
+
+      OMT mat1( 3UL, 4UL );
+      mat1.set( 0UL, 1UL, 1 );
+      mat1.set( 2UL, 3UL, 3 );
+
+      OMT mat2( 2UL, 2UL );
+      mat2.set( 1UL, 1UL, 4 );
+
+      mat2 = std::move( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 2UL );
+      checkValue   ( mat2, 0UL, 1UL, 1 );
+      checkValue   ( mat2, 2UL, 3UL, 3 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AssemblyMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// AssemblyMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::operator()";
+
+      MT mat( 3UL, 4UL );
+      mat.set( 1UL, 2UL, 5 );
+      mat.set( 1UL, 0UL, 2 );
+
+      checkValue( mat, 0UL, 0UL, 0 );
+      checkValue( mat, 1UL, 0UL, 2 );
+      checkValue( mat, 1UL, 1UL, 0 );
+      checkValue( mat, 1UL, 2UL, 5 );
+      checkValue( mat, 2UL, 3UL, 0 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::operator()";
+
+      OMT mat( 3UL, 4UL );
+      mat.set( 1UL, 2UL, 5 );
+      mat.set( 0UL, 2UL, 2 );
+
+      checkValue( mat, 0UL, 0UL, 0 );
+      checkValue( mat, 0UL, 2UL, 2 );
+      checkValue( mat, 1UL, 1UL, 0 );
+      checkValue( mat, 1UL, 2UL, 5 );
+      checkValue( mat, 2UL, 3UL, 0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the \c at() member function of the
+// AssemblyMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::at()";
+
+      MT mat( 3UL, 4UL );
+      mat.set( 1UL, 2UL, 5 );
+
+      if( mat.at( 1UL, 2UL ) != 5 || mat.at( 2UL, 3UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 5 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at( 3UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         mat.at( 0UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::at()";
+
+      OMT mat( 3UL, 4UL );
+      mat.set( 1UL, 2UL, 5 );
+
+      if( mat.at( 1UL, 2UL ) != 5 || mat.at( 2UL, 3UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 5 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at( 3UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AssemblyMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "Row-major AssemblyMatrix iterator";
+
+      MT mat( 3UL, 5UL );
+      mat.set( 1UL, 4UL, 3 );
+      mat.set( 1UL, 0UL, 1 );
+      mat.set( 1UL, 2UL, 2 );
+
+      const size_t number( mat.end( 1UL ) - mat.begin( 1UL ) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      MT::ConstIterator it( mat.cbegin( 1UL ) );
+
+      if( it->index() != 0UL || it->value() != 1 ||
+          (it+1)->index() != 2UL || (it+1)->value() != 2 ||
+          (it+2)->index() != 4UL || (it+2)->value() != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid order of elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( MT::Iterator element=mat.begin( 1UL ); element!=mat.end( 1UL ); ++element ) {
+         element->value() *= 2;
+      }
+
+      checkValue( mat, 1UL, 0UL, 2 );
+      checkValue( mat, 1UL, 2UL, 4 );
+      checkValue( mat, 1UL, 4UL, 6 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix iterator";
+
+      OMT mat( 5UL, 3UL );
+      mat.set( 4UL, 1UL, 3 );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 2UL, 1UL, 2 );
+
+      const size_t number( mat.end( 1UL ) - mat.begin( 1UL ) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      OMT::ConstIterator it( mat.cbegin( 1UL ) );
+
+      if( it->index() != 0UL || it->value() != 1 ||
+          (it+1)->index() != 2UL || (it+1)->value() != 2 ||
+          (it+2)->index() != 4UL || (it+2)->value() != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid order of elements detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::reset()";
+
+      MT mat( 3UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 1UL, 2UL, 2 );
+      mat.set( 2UL, 3UL, 3 );
+
+      reset( mat, 1UL );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkCapacity( mat, 1UL, 1UL );
+      checkValue   ( mat, 0UL, 1UL, 1 );
+      checkValue   ( mat, 1UL, 2UL, 0 );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkCapacity( mat, 3UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::reset()";
+
+      OMT mat( 3UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 1UL, 2UL, 2 );
+      mat.set( 2UL, 3UL, 3 );
+
+      reset( mat, 2UL );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkCapacity( mat, 2UL, 1UL );
+      checkValue   ( mat, 0UL, 1UL, 1 );
+      checkValue   ( mat, 1UL, 2UL, 0 );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkCapacity( mat, 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::clear()";
+
+      MT mat( 3UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::clear()";
+
+      OMT mat( 3UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member function of the AssemblyMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::reserve()";
+
+      MT mat( 3UL, 10UL );
+      mat.set( 1UL, 3UL, 1 );
+      mat.set( 1UL, 7UL, 2 );
+
+      mat.reserve( 1UL, 10UL );
+
+      checkCapacity( mat, 1UL, 10UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkValue   ( mat, 1UL, 3UL, 1 );
+      checkValue   ( mat, 1UL, 7UL, 2 );
+
+      mat.reserve( 1UL, 5UL );
+
+      checkCapacity( mat, 1UL, 10UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::reserve()";
+
+      OMT mat( 10UL, 3UL );
+      mat.set( 3UL, 1UL, 1 );
+      mat.set( 7UL, 1UL, 2 );
+
+      mat.reserve( 1UL, 10UL );
+
+      checkCapacity( mat, 1UL, 10UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkValue   ( mat, 3UL, 1UL, 1 );
+      checkValue   ( mat, 7UL, 1UL, 2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c shrinkToFit() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c shrinkToFit() member function of the AssemblyMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testShrinkToFit()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::shrinkToFit()";
+
+      MT mat( 3UL, 4UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 0UL, 3UL, 2 );
+      mat.set( 2UL, 2UL, 3 );
+
+      mat.shrinkToFit();
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat.capacity() != 3UL || mat.capacity( 1UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shrinking the matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValue( mat, 0UL, 1UL, 1 );
+      checkValue( mat, 0UL, 3UL, 2 );
+      checkValue( mat, 2UL, 2UL, 3 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::shrinkToFit()";
+
+      OMT mat( 3UL, 4UL, 4UL );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 2UL, 1UL, 2 );
+      mat.set( 2UL, 2UL, 3 );
+
+      mat.shrinkToFit();
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat.capacity() != 3UL || mat.capacity( 0UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shrinking the matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkValue( mat, 0UL, 1UL, 1 );
+      checkValue( mat, 2UL, 1UL, 2 );
+      checkValue( mat, 2UL, 2UL, 3 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major AssemblyMatrix swap";
+
+      MT mat1( 2UL, 3UL );
+      mat1.set( 0UL, 2UL, 1 );
+
+      MT mat2( 4UL, 1UL );
+      mat2.set( 3UL, 0UL, 2 );
+      mat2.set( 1UL, 0UL, 3 );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 4UL );
+      checkColumns ( mat1, 1UL );
+      checkNonZeros( mat1, 2UL );
+      checkValue   ( mat1, 3UL, 0UL, 2 );
+      checkValue   ( mat1, 1UL, 0UL, 3 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 1UL );
+      checkValue   ( mat2, 0UL, 2UL, 1 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix swap";
+
+      OMT mat1( 2UL, 3UL );
+      mat1.set( 0UL, 2UL, 1 );
+
+      OMT mat2( 4UL, 1UL );
+      mat2.set( 3UL, 0UL, 2 );
+      mat2.set( 1UL, 0UL, 3 );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 4UL );
+      checkColumns ( mat1, 1UL );
+      checkNonZeros( mat1, 2UL );
+      checkValue   ( mat1, 3UL, 0UL, 2 );
+      checkValue   ( mat1, 1UL, 0UL, 3 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 1UL );
+      checkValue   ( mat2, 0UL, 2UL, 1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::set()";
+
+      MT mat( 4UL, 20UL );
+
+      // Setting elements in random order beyond the initial capacity
+      for( size_t j=0UL; j<20UL; ++j ) {
+         const size_t index( ( j*7UL ) % 20UL );
+         mat.set( 2UL, index, int( index+1UL ) );
+      }
+
+      checkNonZeros( mat, 20UL );
+      checkNonZeros( mat, 2UL, 20UL );
+      checkNonZeros( mat, 1UL, 0UL );
+
+      for( size_t j=0UL; j<20UL; ++j ) {
+         checkValue( mat, 2UL, j, int( j+1UL ) );
+      }
+
+      // Overwriting an existing element
+      MT::Iterator pos = mat.set( 2UL, 5UL, -1 );
+
+      checkNonZeros( mat, 20UL );
+      checkValue   ( mat, 2UL, 5UL, -1 );
+
+      if( pos->index() != 5UL || pos->value() != -1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Index: " << pos->index() << "\n"
+             << "   Value: " << pos->value() << "\n"
+             << "   Expected index: 5\n"
+             << "   Expected value: -1\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::set()";
+
+      OMT mat( 20UL, 4UL );
+
+      for( size_t i=0UL; i<20UL; ++i ) {
+         const size_t index( ( i*7UL ) % 20UL );
+         mat.set( index, 2UL, int( index+1UL ) );
+      }
+
+      checkNonZeros( mat, 20UL );
+      checkNonZeros( mat, 2UL, 20UL );
+      checkNonZeros( mat, 1UL, 0UL );
+
+      for( size_t i=0UL; i<20UL; ++i ) {
+         checkValue( mat, i, 2UL, int( i+1UL ) );
+      }
+
+      mat.set( 5UL, 2UL, -1 );
+
+      checkNonZeros( mat, 20UL );
+      checkValue   ( mat, 5UL, 2UL, -1 );
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariants of the matrix are violated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::insert()";
+
+      MT mat( 3UL, 5UL );
+      mat.insert( 0UL, 3UL, 1 );
+      mat.insert( 0UL, 1UL, 2 );
+      mat.insert( 2UL, 4UL, 3 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkValue   ( mat, 0UL, 1UL, 2 );
+      checkValue   ( mat, 0UL, 3UL, 1 );
+      checkValue   ( mat, 2UL, 4UL, 3 );
+
+      try {
+         mat.insert( 0UL, 3UL, 4 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 3UL );
+      checkValue   ( mat, 0UL, 3UL, 1 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::insert()";
+
+      OMT mat( 5UL, 3UL );
+      mat.insert( 3UL, 0UL, 1 );
+      mat.insert( 1UL, 0UL, 2 );
+      mat.insert( 4UL, 2UL, 3 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkValue   ( mat, 1UL, 0UL, 2 );
+      checkValue   ( mat, 3UL, 0UL, 1 );
+      checkValue   ( mat, 4UL, 2UL, 3 );
+
+      try {
+         mat.insert( 3UL, 0UL, 4 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.compress() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 3UL );
+      checkValue   ( mat, 3UL, 0UL, 1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c add() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c add() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAdd()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::add()";
+
+      MT mat( 3UL, 4UL );
+      mat.add( 1UL, 2UL, 1 );
+      mat.add( 1UL, 0UL, 2 );
+      mat.add( 1UL, 2UL, 3 );
+      mat.add( 1UL, 0UL, 4 );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkValue   ( mat, 1UL, 0UL, 6 );
+      checkValue   ( mat, 1UL, 2UL, 4 );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::add()";
+
+      OMT mat( 3UL, 4UL );
+      mat.add( 1UL, 2UL, 1 );
+      mat.add( 0UL, 2UL, 2 );
+      mat.add( 1UL, 2UL, 3 );
+      mat.add( 0UL, 2UL, 4 );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+      checkValue   ( mat, 0UL, 2UL, 6 );
+      checkValue   ( mat, 1UL, 2UL, 4 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::erase()";
+
+      MT mat( 3UL, 5UL );
+      mat.set( 1UL, 0UL, 1 );
+      mat.set( 1UL, 2UL, 2 );
+      mat.set( 1UL, 4UL, 3 );
+
+      mat.erase( 1UL, 2UL );
+
+      checkNonZeros( mat, 2UL );
+      checkCapacity( mat, 1UL, 3UL );
+      checkValue   ( mat, 1UL, 0UL, 1 );
+      checkValue   ( mat, 1UL, 2UL, 0 );
+      checkValue   ( mat, 1UL, 4UL, 3 );
+
+      mat.erase( 1UL, 3UL );
+
+      checkNonZeros( mat, 2UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::erase()";
+
+      OMT mat( 5UL, 3UL );
+      mat.set( 0UL, 1UL, 1 );
+      mat.set( 2UL, 1UL, 2 );
+      mat.set( 4UL, 1UL, 3 );
+
+      mat.erase( 2UL, 1UL );
+
+      checkNonZeros( mat, 2UL );
+      checkCapacity( mat, 1UL, 3UL );
+      checkValue   ( mat, 0UL, 1UL, 1 );
+      checkValue   ( mat, 2UL, 1UL, 0 );
+      checkValue   ( mat, 4UL, 1UL, 3 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the AssemblyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::find()";
+
+      MT mat( 3UL, 40UL );
+      for( size_t j=0UL; j<40UL; j+=2UL ) {
+         mat.set( 1UL, j, int( j ) );
+      }
+
+      MT::Iterator pos( mat.find( 1UL, 12UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 12UL || pos->value() != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (1,12)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 1UL, 13UL ) != mat.end( 1UL ) || mat.find( 0UL, 12UL ) != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::find()";
+
+      OMT mat( 40UL, 3UL );
+      for( size_t i=0UL; i<40UL; i+=2UL ) {
+         mat.set( i, 1UL, int( i ) );
+      }
+
+      OMT::Iterator pos( mat.find( 12UL, 1UL ) );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 12UL || pos->value() != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (12,1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 13UL, 1UL ) != mat.end( 1UL ) || mat.find( 12UL, 0UL ) != mat.end( 0UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-existing element could be found\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the AssemblyMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::lowerBound()";
+
+      MT mat( 2UL, 40UL );
+      for( size_t j=0UL; j<40UL; j+=2UL ) {
+         mat.set( 0UL, j, int( j ) );
+      }
+
+      for( size_t j=0UL; j<40UL; ++j )
+      {
+         MT::ConstIterator pos( mat.lowerBound( 0UL, j ) );
+         const size_t expected( ( j+1UL ) & ~size_t(1) );
+
+         if( expected < 40UL && ( pos == mat.end( 0UL ) || pos->index() != expected ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lower bound for index " << j << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         if( expected >= 40UL && pos != mat.end( 0UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lower bound for index " << j << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::lowerBound()";
+
+      OMT mat( 6UL, 2UL );
+      mat.set( 1UL, 1UL, 1 );
+      mat.set( 4UL, 1UL, 2 );
+
+      OMT::Iterator pos1( mat.lowerBound( 2UL, 1UL ) );
+      OMT::Iterator pos2( mat.lowerBound( 5UL, 1UL ) );
+
+      if( pos1 == mat.end( 1UL ) || pos1->index() != 4UL || pos2 != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c compress() member function of the AssemblyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c compress() member function of the AssemblyMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompress()
+{
+   {
+      test_ = "Row-major AssemblyMatrix::compress()";
+
+      MT mat( 3UL, 4UL, 3UL );
+      mat.add( 2UL, 3UL, 4 );
+      mat.add( 0UL, 1UL, 1 );
+      mat.add( 2UL, 0UL, 3 );
+      mat.add( 0UL, 2UL, 2 );
+      mat.add( 2UL, 3UL, 1 );
+
+      const MT::ResultType C( mat.compress() );
+
+      checkRows    ( C, 3UL );
+      checkColumns ( C, 4UL );
+      checkNonZeros( C, 4UL );
+      checkNonZeros( C, 0UL, 2UL );
+      checkNonZeros( C, 1UL, 0UL );
+      checkNonZeros( C, 2UL, 2UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 0, 1, 2, 0 },
+                                                            { 0, 0, 0, 0 },
+                                                            { 3, 0, 0, 5 } };
+
+      if( C != ref || C.capacity() != 4UL || !isIntact( C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compression failed\n"
+             << " Details:\n"
+             << "   Capacity:\n" << C.capacity() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNonZeros( mat, 4UL );
+   }
+
+   {
+      test_ = "Column-major AssemblyMatrix::compress()";
+
+      OMT mat( 3UL, 4UL, 3UL );
+      mat.add( 2UL, 3UL, 4 );
+      mat.add( 0UL, 1UL, 1 );
+      mat.add( 2UL, 0UL, 3 );
+      mat.add( 0UL, 2UL, 2 );
+      mat.add( 2UL, 3UL, 1 );
+
+      const OMT::ResultType C( mat.compress() );
+
+      checkRows    ( C, 3UL );
+      checkColumns ( C, 4UL );
+      checkNonZeros( C, 4UL );
+      checkNonZeros( C, 0UL, 1UL );
+      checkNonZeros( C, 1UL, 1UL );
+      checkNonZeros( C, 2UL, 1UL );
+      checkNonZeros( C, 3UL, 1UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 0, 1, 2, 0 },
+                                                            { 0, 0, 0, 0 },
+                                                            { 3, 0, 0, 5 } };
+
+      if( C != ref || C.capacity() != 4UL || !isIntact( C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compression failed\n"
+             << " Details:\n"
+             << "   Capacity:\n" << C.capacity() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace assemblymatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running AssemblyMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_ASSEMBLYMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during AssemblyMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
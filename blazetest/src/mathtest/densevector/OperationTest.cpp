@@ -39,7 +39,10 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/dense/Fusion.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densevector/OperationTest.h>
 #include <blazetest/mathtest/IsEqual.h>
@@ -76,6 +79,7 @@ OperationTest::OperationTest()
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testFusedAssign();
 }
 //*************************************************************************************************
 
@@ -994,6 +998,156 @@ void OperationTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!rief Test of the fused assignment functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c fusedAssign(), \c fusedAddAssign(), and
+// \c fusedSubAssign() functions for dense vectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testFusedAssign()
+{
+   test_ = "fusedAssign() function";
+
+   // Fused assignment of two matrix/vector multiplications with a dense matrix
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+      blaze::DynamicVector<double,blaze::columnVector> x1( 1000UL ), x2( 1000UL ), y1, y2;
+      randomize( A );
+      randomize( x1 );
+      randomize( x2 );
+
+      fusedAssign( y1, A * x1, y2, A * x2 );
+
+      const blaze::DynamicVector<double,blaze::columnVector> ref1( A * x1 ), ref2( A * x2 );
+
+      if( y1 != ref1 || y2 != ref2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment failed\n"
+             << " Details:\n"
+             << "   Maximum deviation of y1: " << max( abs( y1 - ref1 ) ) << "\n"
+             << "   Maximum deviation of y2: " << max( abs( y2 - ref2 ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused assignment with subsequent reduction with a sparse matrix
+   {
+      const size_t N( 5000UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( N, N );
+      A.reserve( 3UL*N );
+      for( size_t i=0UL; i<N; ++i ) {
+         if( i > 0UL    ) A.append( i, i-1UL, -1.0 );
+         A.append( i, i, 4.0 );
+         if( i < N-1UL ) A.append( i, i+1UL, -1.0 );
+         A.finalize( i );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x( N ), b( N ), d( N ), r, h;
+      randomize( x );
+      randomize( b );
+      randomize( d );
+
+      const double rr( fusedAssign( blaze::SqrNorm(), r, A * x - b, h, A * d ) );
+
+      const blaze::DynamicVector<double,blaze::columnVector> rref( A * x - b ), href( A * d );
+
+      if( r != rref || h != href || !isEqual( rr, sqrNorm( rref ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment with reduction failed\n"
+             << " Details:\n"
+             << "   Result: " << rr << "\n"
+             << "   Expected result: " << sqrNorm( rref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused addition and subtraction assignment with subsequent reduction
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x( 10000UL ), r( 10000UL ), d( 10000UL ), h( 10000UL );
+      randomize( x );
+      randomize( r );
+      randomize( d );
+      randomize( h );
+
+      blaze::DynamicVector<double,blaze::columnVector> xref( x ), rref( r );
+
+      const double beta( fusedAddAssign( blaze::SqrNorm(), r, 0.5 * h, x, 0.5 * d ) );
+      rref += 0.5 * h;
+      xref += 0.5 * d;
+
+      if( r != rref || x != xref || !isEqual( beta, sqrNorm( rref ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused addition assignment failed\n"
+             << " Details:\n"
+             << "   Result: " << beta << "\n"
+             << "   Expected result: " << sqrNorm( rref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double norm( fusedSubAssign( blaze::L2Norm(), r, h ) );
+      const double maximum( fusedSubAssign( blaze::Max(), x, d ) );
+      rref -= h;
+      xref -= d;
+
+      if( r != rref || x != xref || !isEqual( norm, l2Norm( rref ) ) || !isEqual( maximum, max( xref ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result: " << norm << " / " << maximum << "\n"
+             << "   Expected result: " << l2Norm( rref ) << " / " << max( xref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused assignment with aliasing
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 500UL, 500UL );
+      blaze::DynamicVector<double,blaze::columnVector> x( 500UL ), y;
+      randomize( A );
+      randomize( x );
+
+      const blaze::DynamicVector<double,blaze::columnVector> ref1( A * x ), ref2( A * ref1 );
+
+      fusedAssign( x, A * x, y, A * ref1 );
+
+      if( x != ref1 || y != ref2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment with aliasing failed\n"
+             << " Details:\n"
+             << "   Maximum deviation of x: " << max( abs( x - ref1 ) ) << "\n"
+             << "   Maximum deviation of y: " << max( abs( y - ref2 ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused addition assignment with non-matching sizes
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x( 10UL ), y( 10UL ), z( 5UL );
+
+      try {
+         fusedAddAssign( x, y, z, y );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused addition assignment of vectors with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -175,6 +175,47 @@ void AliasingTest::testDMatDMatMult()
    }
 
 
+   //=====================================================================================
+   // Multiplication with bias
+   //=====================================================================================
+
+   // Assignment to the bias operand
+   {
+      test_ = "DMatDMatMult - Assignment to the bias operand";
+
+      initialize();
+
+      result_ = ( dA3x4_ * dB4x3_ ) + dC3x3_;
+      dC3x3_  = ( dA3x4_ * dB4x3_ ) + dC3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // Assignment to the scaled bias operand
+   {
+      test_ = "DMatDMatMult - Assignment to the scaled bias operand";
+
+      initialize();
+
+      result_ = 2 * ( dA3x4_ * dB4x3_ ) + 3 * dC3x3_;
+      dC3x3_  = 2 * ( dA3x4_ * dB4x3_ ) + 3 * dC3x3_;
+
+      checkResult( dC3x3_, result_ );
+   }
+
+   // Assignment to the bias operand of a map operation
+   {
+      test_ = "DMatDMatMult - Assignment to the bias operand of a map operation";
+
+      initialize();
+
+      result_ = abs( dD3x3_ + ( dA3x4_ * dB4x3_ ) * 2 );
+      dD3x3_  = abs( dD3x3_ + ( dA3x4_ * dB4x3_ ) * 2 );
+
+      checkResult( dD3x3_, result_ );
+   }
+
+
    //=====================================================================================
    // Multiplication with addition assignment
    //=====================================================================================